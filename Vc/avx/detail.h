@@ -448,6 +448,81 @@ template<typename Flags> struct LoadHelper<float, signed char, Flags> {
 };
 */
 
+// partial loads and stores{{{1
+// AVX provides masked loads and stores (which never fault on the masked-off entries) for
+// 32- and 64-bit entries. Vectors of 16-bit entries are handled as two SSE halves.
+Vc_INTRINSIC __m256i partial_mask32(std::size_t n)
+{
+    return AVX::avx_cast<__m256i>(_mm256_cmp_ps(_mm256_setr_ps(0, 1, 2, 3, 4, 5, 6, 7),
+                                                _mm256_set1_ps(float(n)), _CMP_LT_OQ));
+}
+Vc_INTRINSIC __m256i partial_mask64(std::size_t n)
+{
+    return AVX::avx_cast<__m256i>(
+        _mm256_cmp_pd(_mm256_setr_pd(0, 1, 2, 3), _mm256_set1_pd(double(n)), _CMP_LT_OQ));
+}
+
+Vc_INTRINSIC __m256 load32_partial(const float *mem, std::size_t n)
+{
+    return _mm256_maskload_ps(mem, partial_mask32(n));
+}
+Vc_INTRINSIC __m256d load32_partial(const double *mem, std::size_t n)
+{
+    return _mm256_maskload_pd(mem, partial_mask64(n));
+}
+template <typename T>
+Vc_INTRINSIC __m256i load32_partial(const T *mem, std::size_t n,
+                                    std::integral_constant<std::size_t, 4>)
+{
+    return AVX::avx_cast<__m256i>(
+        _mm256_maskload_ps(reinterpret_cast<const float *>(mem), partial_mask32(n)));
+}
+template <typename T>
+Vc_INTRINSIC __m256i load32_partial(const T *mem, std::size_t n,
+                                    std::integral_constant<std::size_t, 2>)
+{
+    if (n >= 8) {
+        return AVX::concat(_mm_loadu_si128(reinterpret_cast<const __m128i *>(mem)),
+                           load16_partial(mem + 8, n - 8));
+    }
+    return AVX::zeroExtend(load16_partial(mem, n));
+}
+template <typename T> Vc_INTRINSIC __m256i load32_partial(const T *mem, std::size_t n)
+{
+    return load32_partial(mem, n, std::integral_constant<std::size_t, sizeof(T)>());
+}
+
+Vc_INTRINSIC void store32_partial(float *mem, __m256 x, std::size_t n)
+{
+    _mm256_maskstore_ps(mem, partial_mask32(n), x);
+}
+Vc_INTRINSIC void store32_partial(double *mem, __m256d x, std::size_t n)
+{
+    _mm256_maskstore_pd(mem, partial_mask64(n), x);
+}
+template <typename T>
+Vc_INTRINSIC void store32_partial(T *mem, __m256i x, std::size_t n,
+                                  std::integral_constant<std::size_t, 4>)
+{
+    _mm256_maskstore_ps(reinterpret_cast<float *>(mem), partial_mask32(n),
+                        AVX::avx_cast<__m256>(x));
+}
+template <typename T>
+Vc_INTRINSIC void store32_partial(T *mem, __m256i x, std::size_t n,
+                                  std::integral_constant<std::size_t, 2>)
+{
+    if (n >= 8) {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(mem), AVX::lo128(x));
+        store16_partial(mem + 8, AVX::hi128(x), n - 8);
+    } else {
+        store16_partial(mem, AVX::lo128(x), n);
+    }
+}
+template <typename T> Vc_INTRINSIC void store32_partial(T *mem, __m256i x, std::size_t n)
+{
+    store32_partial(mem, x, n, std::integral_constant<std::size_t, sizeof(T)>());
+}
+
 // shifted{{{1
 template <int amount, typename T>
 Vc_INTRINSIC Vc_CONST enable_if<(sizeof(T) == 32 && amount >= 16), T> shifted(T k)
@@ -716,6 +791,64 @@ Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,   uint) { return AVX::mullo_epi32
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  short) { return AVX::mullo_epi16(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b, ushort) { return AVX::mullo_epi16(a, b); }
 
+// mulhi{{{1
+#ifdef Vc_IMPL_AVX2
+/**\internal
+ * Returns the high half of the full product of every pair of lanes.
+ */
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b,   uint)
+{
+    const __m256i ab02 = _mm256_mul_epu32(a, b);
+    const __m256i ab13 = _mm256_mul_epu32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi16(_mm256_srli_epi64(ab02, 32), ab13, 0xcc);
+}
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b,    int)
+{
+    const __m256i ab02 = _mm256_mul_epi32(a, b);
+    const __m256i ab13 = _mm256_mul_epi32(_mm256_srli_epi64(a, 32), _mm256_srli_epi64(b, 32));
+    return _mm256_blend_epi16(_mm256_srli_epi64(ab02, 32), ab13, 0xcc);
+}
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b,  short) { return _mm256_mulhi_epi16(a, b); }
+Vc_INTRINSIC __m256i mulhi(__m256i a, __m256i b, ushort) { return _mm256_mulhi_epu16(a, b); }
+
+// per-byte bit manipulation{{{1
+/**\internal
+ * AVX2 versions of the pshufb nibble-table helpers in sse/detail.h.
+ */
+Vc_INTRINSIC __m256i popcnt_epi8(__m256i x)
+{
+    const __m256i lut = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4));
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    return _mm256_add_epi8(
+        _mm256_shuffle_epi8(lut, _mm256_and_si256(x, nibble)),
+        _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble)));
+}
+Vc_INTRINSIC __m256i bitreverse_epi8(__m256i x)
+{
+    const __m256i lutLo = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+        0x00, char(0x80), 0x40, char(0xc0), 0x20, char(0xa0), 0x60, char(0xe0), 0x10,
+        char(0x90), 0x50, char(0xd0), 0x30, char(0xb0), 0x70, char(0xf0)));
+    const __m256i lutHi = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe, 0x1, 0x9, 0x5, 0xd, 0x3, 0xb,
+                      0x7, 0xf));
+    const __m256i nibble = _mm256_set1_epi8(0x0f);
+    return _mm256_or_si256(
+        _mm256_shuffle_epi8(lutLo, _mm256_and_si256(x, nibble)),
+        _mm256_shuffle_epi8(lutHi, _mm256_and_si256(_mm256_srli_epi16(x, 4), nibble)));
+}
+Vc_INTRINSIC __m256i byteswap_epi16(__m256i x)
+{
+    return _mm256_shuffle_epi8(x, _mm256_broadcastsi128_si256(_mm_setr_epi8(
+                                      1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14)));
+}
+Vc_INTRINSIC __m256i byteswap_epi32(__m256i x)
+{
+    return _mm256_shuffle_epi8(x, _mm256_broadcastsi128_si256(_mm_setr_epi8(
+                                      3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)));
+}
+#endif  // Vc_IMPL_AVX2
+
 // mul{{{1
 Vc_INTRINSIC __m256  div(__m256  a, __m256  b,  float) { return _mm256_div_ps(a, b); }
 Vc_INTRINSIC __m256d div(__m256d a, __m256d b, double) { return _mm256_div_pd(a, b); }
@@ -1325,6 +1458,27 @@ template <> Vc_INTRINSIC Vc_CONST int mask_to_int<32>(__m256i k)
     return movemask(k);
 }
 
+// mask_from_int{{{1
+// Broadcasts the bits and compares every entry against its own bit.
+template <typename R, size_t Size>
+Vc_INTRINSIC_L Vc_CONST_L R mask_from_int(unsigned bits) Vc_INTRINSIC_R Vc_CONST_R;
+template <> Vc_INTRINSIC Vc_CONST __m256i mask_from_int<__m256i, 4>(unsigned bits)
+{
+    const __m256i k = _mm256_setr_epi32(1, 1, 2, 2, 4, 4, 8, 8);
+    return AVX::cmpeq_epi32(AVX::and_si256(_mm256_set1_epi32(bits), k), k);
+}
+template <> Vc_INTRINSIC Vc_CONST __m256i mask_from_int<__m256i, 8>(unsigned bits)
+{
+    const __m256i k = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+    return AVX::cmpeq_epi32(AVX::and_si256(_mm256_set1_epi32(bits), k), k);
+}
+template <> Vc_INTRINSIC Vc_CONST __m256i mask_from_int<__m256i, 16>(unsigned bits)
+{
+    const __m256i k = _mm256_setr_epi16(1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024,
+                                        2048, 4096, 8192, 16384, -32768);
+    return AVX::cmpeq_epi16(AVX::and_si256(_mm256_set1_epi16(bits), k), k);
+}
+
 //InterleaveImpl{{{1
 template<typename V> struct InterleaveImpl<V, 16, 32> {
     template<typename I> static inline void interleave(typename V::EntryType *const data, const I &i,/*{{{*/
@@ -34,6 +34,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "../common/storage.h"
 #include "../common/bitscanintrinsics.h"
 #include "../common/maskbool.h"
+#include "../common/packedbits.h"
 #include "detail.h"
 #include "macros.h"
 
@@ -138,6 +139,16 @@ public:
 
         template<typename Flags = DefaultLoadTag> Vc_INTRINSIC void store(bool *mem, Flags = Flags()) const;
 
+        static Vc_INTRINSIC Mask fromBits(const std::uint64_t *bits, std::size_t offset)
+        {
+            return Detail::mask_from_int<__m256i, Size>(
+                Detail::load_bits<Size>(bits, offset));
+        }
+        Vc_INTRINSIC void storeBits(std::uint64_t *bits, std::size_t offset) const
+        {
+            Detail::store_bits<Size>(bits, offset, toInt());
+        }
+
         Vc_INTRINSIC Mask &operator=(const Mask &) = default;
         Vc_INTRINSIC_L Mask &operator=(const std::array<bool, Size> &values) Vc_INTRINSIC_R;
         Vc_INTRINSIC_L operator std::array<bool, Size>() const Vc_INTRINSIC_R;
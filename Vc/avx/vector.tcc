@@ -332,6 +332,29 @@ Vc_INTRINSIC void Vector<T, VectorAbi::Avx>::store(U *mem, Mask mask, Flags flag
     HV::template store<Flags>(mem, data(), mask.data());
 }
 
+// partial loads and stores {{{1
+template <typename T>
+Vc_INTRINSIC void Vector<T, VectorAbi::Avx>::load_partial(const EntryType *mem,
+                                                          std::size_t n)
+{
+    if (n >= Size) {
+        load(mem, Vc::Unaligned);
+    } else {
+        d.v() = Detail::load32_partial(mem, n);
+    }
+}
+
+template <typename T>
+Vc_INTRINSIC void Vector<T, VectorAbi::Avx>::store_partial(EntryType *mem,
+                                                           std::size_t n) const
+{
+    if (n >= Size) {
+        store(mem, Vc::Unaligned);
+    } else {
+        Detail::store32_partial(mem, d.v(), n);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////
 // integer ops {{{1
 #ifdef Vc_IMPL_AVX2
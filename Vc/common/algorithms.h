@@ -28,6 +28,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #ifndef VC_COMMON_ALGORITHMS_H_
 #define VC_COMMON_ALGORITHMS_H_
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
 #include "simdize.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -161,6 +166,550 @@ simd_for_each_n(InputIt first, std::size_t count, UnaryFunction f)
     return f;
 }
 
+// masked tail {{{1
+/**
+ * \ingroup Utilities
+ *
+ * Tag type selecting the masked-tail variants of simd_for_each and simd_for_each_n.
+ */
+struct MaskedTailTag {
+};
+
+/**
+ * \ingroup Utilities
+ *
+ * Pass this object as last argument to simd_for_each or simd_for_each_n to process the
+ * remainder of the range as one partially loaded vector instead of calling the functor
+ * once per remaining element:
+ *
+ * \code
+ * Vc::simd_for_each(data.begin(), data.end(), [](auto &v) { v = sqrt(v); }, Vc::MaskedTail);
+ * \endcode
+ *
+ * The entries of the last vector beyond the end of the range are zero and the functor must
+ * tolerate them (e.g. not divide by them or reduce them with multiplication). Results for
+ * these entries are discarded. This requires a contiguous range of an arithmetic type.
+ */
+constexpr MaskedTailTag MaskedTail = {};
+
+template <class InputIt, class UnaryFunction,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline enable_if<
+    std::is_arithmetic<ValueType>::value &&
+        Traits::is_functor_argument_immutable<UnaryFunction, simdize<ValueType>>::value,
+    UnaryFunction>
+simd_for_each_n(InputIt first, std::size_t count, UnaryFunction f, MaskedTailTag)
+{
+    typedef simdize<ValueType> V;
+    for (; count >= V::size(); count -= V::size(), first += V::size()) {
+        f(V(std::addressof(*first), Vc::Unaligned));
+    }
+    if (count > 0) {
+        V tmp;
+        tmp.load_partial(std::addressof(*first), count);
+        f(tmp);
+    }
+    return f;
+}
+
+template <class InputIt, class UnaryFunction,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline enable_if<
+    std::is_arithmetic<ValueType>::value &&
+        !Traits::is_functor_argument_immutable<UnaryFunction, simdize<ValueType>>::value,
+    UnaryFunction>
+simd_for_each_n(InputIt first, std::size_t count, UnaryFunction f, MaskedTailTag)
+{
+    typedef simdize<ValueType> V;
+    for (; count >= V::size(); count -= V::size(), first += V::size()) {
+        V tmp(std::addressof(*first), Vc::Unaligned);
+        f(tmp);
+        tmp.store(std::addressof(*first), Vc::Unaligned);
+    }
+    if (count > 0) {
+        V tmp;
+        tmp.load_partial(std::addressof(*first), count);
+        f(tmp);
+        tmp.store_partial(std::addressof(*first), count);
+    }
+    return f;
+}
+
+template <class InputIt, class UnaryFunction>
+inline UnaryFunction simd_for_each(InputIt first, InputIt last, UnaryFunction f,
+                                   MaskedTailTag tag)
+{
+    return simd_for_each_n(first, std::distance(first, last), std::move(f), tag);
+}
+
+// search algorithms {{{1
+namespace Common
+{
+/**\internal
+ * Returns the index of the first element after \p p that starts a V::MemoryAlignment
+ * aligned vector, or V::Size if there is none (or \p p is not even aligned to its element
+ * type).
+ */
+template <typename V, typename T> inline std::size_t elements_to_alignment(const T *p)
+{
+    const std::size_t misalignment =
+        reinterpret_cast<std::uintptr_t>(p) % V::MemoryAlignment;
+    if (misalignment == 0 || misalignment % sizeof(T) != 0) {
+        return V::Size;
+    }
+    return V::Size - misalignment / sizeof(T);
+}
+
+/**\internal
+ * Returns the index of the first lane where `test(i)` (the mask for the vector starting
+ * at element \p i) is set, or \p n if there is none. Ranges shorter than one vector are
+ * tested element by element with \p test1.
+ *
+ * The first vector is loaded from \p p. The loop then continues at the next aligned
+ * address, so that the (unaligned) loads of the body never cross a cache line. The tail is
+ * an overlapping load of the last V::Size elements. Overlapping lanes never contain a
+ * match, thus the first set lane is the correct result in all cases.
+ */
+template <typename V, typename T, typename Test, typename Test1>
+inline std::size_t find_first_impl(const T *p, std::size_t n, const Test &test,
+                                   const Test1 &test1)
+{
+    if (n < V::Size) {
+        for (std::size_t i = 0; i < n; ++i) {
+            if (test1(i)) {
+                return i;
+            }
+        }
+        return n;
+    }
+    auto m = test(0);
+    if (any_of(m)) {
+        return m.firstOne();
+    }
+    std::size_t i = elements_to_alignment<V>(p);
+    for (; i + V::Size <= n; i += V::Size) {
+        m = test(i);
+        if (Vc_IS_UNLIKELY(any_of(m))) {
+            return i + m.firstOne();
+        }
+    }
+    if (i < n) {
+        i = n - V::Size;
+        m = test(i);
+        if (any_of(m)) {
+            return i + m.firstOne();
+        }
+    }
+    return n;
+}
+
+/**\internal
+ * Returns the number of set lanes in `test(i)` over the whole range, using the same
+ * traversal as find_first_impl. Lanes loaded twice (in the head and in the tail) are
+ * masked off once.
+ */
+template <typename V, typename T, typename Test, typename Test1>
+inline std::size_t count_impl(const T *p, std::size_t n, const Test &test,
+                              const Test1 &test1)
+{
+    using M = typename V::mask_type;
+    std::size_t count = 0;
+    if (n < V::Size) {
+        for (std::size_t i = 0; i < n; ++i) {
+            count += test1(i) ? 1 : 0;
+        }
+        return count;
+    }
+    std::size_t i = elements_to_alignment<V>(p);
+    count += (test(0) && M::generate([i](int k) { return std::size_t(k) < i; })).count();
+    for (; i + V::Size <= n; i += V::Size) {
+        count += test(i).count();
+    }
+    if (i < n) {
+        const std::size_t skip = i - (n - V::Size);
+        count += (test(n - V::Size) &&
+                  M::generate([skip](int k) { return std::size_t(k) >= skip; }))
+                     .count();
+    }
+    return count;
+}
+
+/**\internal
+ * Predicate comparing scalars and vectors for equality with a fixed value.
+ */
+template <typename T> struct equal_to_value {
+    T value;
+    template <typename U> Vc_INTRINSIC auto operator()(const U &x) const -> decltype(x == U(value))
+    {
+        return x == U(value);
+    }
+};
+template <typename T> inline equal_to_value<T> make_equal_to(const T &value)
+{
+    return {value};
+}
+
+template <typename T, typename Pred>
+inline std::size_t find_if_impl(const T *p, std::size_t n, Pred &pred, std::true_type)
+{
+    using V = Vector<T>;
+    using V1 = simdize<T, 1>;
+    return find_first_impl<V>(
+        p, n, [&](std::size_t i) { return pred(V(p + i, Vc::Unaligned)); },
+        [&](std::size_t i) { return any_of(pred(V1(p + i, Vc::Unaligned))); });
+}
+
+template <typename T, typename Pred>
+inline std::size_t find_if_impl(const T *p, std::size_t n, Pred &pred, std::false_type)
+{
+    std::size_t i = 0;
+    while (i < n && !any_of(pred(p[i]))) {
+        ++i;
+    }
+    return i;
+}
+
+template <typename T, typename Pred>
+inline std::size_t count_if_impl(const T *p, std::size_t n, Pred &pred, std::true_type)
+{
+    using V = Vector<T>;
+    using V1 = simdize<T, 1>;
+    return count_impl<V>(
+        p, n, [&](std::size_t i) { return pred(V(p + i, Vc::Unaligned)); },
+        [&](std::size_t i) { return any_of(pred(V1(p + i, Vc::Unaligned))); });
+}
+
+template <typename T, typename Pred>
+inline std::size_t count_if_impl(const T *p, std::size_t n, Pred &pred, std::false_type)
+{
+    std::size_t count = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        count += any_of(pred(p[i])) ? 1 : 0;
+    }
+    return count;
+}
+
+/**\internal
+ * Binary search that narrows the range down to a few vectors and then counts the
+ * elements that compare less (or not greater, for \p Upper) than \p value. Since the range
+ * is sorted, that count is the offset of the bound inside the remaining window.
+ */
+template <bool Upper, typename T>
+inline std::size_t bound_impl(const T *p, std::size_t n, const T &value, std::true_type)
+{
+    using V = Vector<T>;
+    constexpr std::size_t Window = 4 * V::Size;
+    std::size_t base = 0;
+    while (n > Window) {
+        const std::size_t half = n / 2;
+        const T &x = p[base + half];
+        const bool right = Upper ? !(value < x) : x < value;
+        base = right ? base + half + 1 : base;
+        n = right ? n - half - 1 : half;
+    }
+    const T *window = p + base;
+    const V value_v = value;
+    return base + count_impl<V>(window, n,
+                                [&](std::size_t i) {
+                                    const V x(window + i, Vc::Unaligned);
+                                    return Upper ? !(value_v < x) : x < value_v;
+                                },
+                                [&](std::size_t i) {
+                                    return Upper ? !(value < window[i]) : window[i] < value;
+                                });
+}
+
+template <bool Upper, typename T>
+inline std::size_t bound_impl(const T *p, std::size_t n, const T &value, std::false_type)
+{
+    return (Upper ? std::upper_bound(p, p + n, value) : std::lower_bound(p, p + n, value)) -
+           p;
+}
+
+template <typename T>
+inline std::size_t mismatch_impl(const T *a, std::size_t n, const T *b, std::true_type)
+{
+    using V = Vector<T>;
+    return find_first_impl<V>(
+        a, n,
+        [&](std::size_t i) { return V(a + i, Vc::Unaligned) != V(b + i, Vc::Unaligned); },
+        [&](std::size_t i) { return a[i] != b[i]; });
+}
+
+template <typename T>
+inline std::size_t mismatch_impl(const T *a, std::size_t n, const T *b, std::false_type)
+{
+    return std::mismatch(a, a + n, b).first - a;
+}
+
+/**\internal
+ * Finds the first smallest (or, for \p Max, largest) element. The range is reduced in
+ * blocks of vectors with min/max, so the loop never needs to track indexes. Only the block
+ * holding the first extremum is scanned a second time to determine the index.
+ */
+template <bool Max, typename T>
+inline std::size_t extreme_element_impl(const T *p, std::size_t n, std::true_type)
+{
+    using V = Vector<T>;
+    constexpr std::size_t Block = 64 * V::Size;
+    if (n < V::Size) {
+        return (Max ? std::max_element(p, p + n) : std::min_element(p, p + n)) - p;
+    }
+    T best = p[0];
+    std::size_t bestBlock = 0;
+    for (std::size_t b = 0; b < n; b += Block) {
+        const std::size_t len = std::min(Block, n - b);
+        T m;
+        if (len < V::Size) {
+            m = *(Max ? std::max_element(p + b, p + b + len)
+                      : std::min_element(p + b, p + b + len));
+        } else {
+            V acc(p + b, Vc::Unaligned);
+            std::size_t j = V::Size;
+            for (; j + V::Size <= len; j += V::Size) {
+                const V x(p + b + j, Vc::Unaligned);
+                acc = Max ? Vc::max(acc, x) : Vc::min(acc, x);
+            }
+            if (j < len) {
+                const V x(p + b + len - V::Size, Vc::Unaligned);
+                acc = Max ? Vc::max(acc, x) : Vc::min(acc, x);
+            }
+            m = Max ? acc.max() : acc.min();
+        }
+        if (Max ? best < m : m < best) {
+            best = m;
+            bestBlock = b;
+        }
+    }
+    const T *block = p + bestBlock;
+    const V best_v = best;
+    return bestBlock + find_first_impl<V>(
+                           block, std::min(Block, n - bestBlock),
+                           [&](std::size_t i) { return V(block + i, Vc::Unaligned) == best_v; },
+                           [&](std::size_t i) { return block[i] == best; });
+}
+
+template <bool Max, typename T>
+inline std::size_t extreme_element_impl(const T *p, std::size_t n, std::false_type)
+{
+    return (Max ? std::max_element(p, p + n) : std::min_element(p, p + n)) - p;
+}
+}  // namespace Common
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::find_if` algorithm for contiguous ranges.
+ *
+ * \p pred is called with `Vc::Vector<` *iterator value type* `>` objects and must return
+ * the corresponding mask. For ranges shorter than one vector it is called with
+ * `simdize<` *iterator value type* `, 1>` objects instead, so a generic lambda or a functor
+ * with a templated call operator is required. Element types without a Vc::Vector are
+ * passed to \p pred as scalars.
+ *
+ * \code
+ * auto it = Vc::find_if(data.begin(), data.end(), [](auto v) { return v > 1.f; });
+ * \endcode
+ *
+ * \param first, last The contiguous range to search.
+ * \param pred The vectorized predicate.
+ * \return Iterator to the first element for which \p pred returned \c true, or \p last.
+ */
+template <class InputIt, class UnaryPredicate>
+inline InputIt find_if(InputIt first, InputIt last, UnaryPredicate pred)
+{
+    using T = typename std::iterator_traits<InputIt>::value_type;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return last;
+    }
+    return first + Common::find_if_impl(std::addressof(*first), n, pred,
+                                        Traits::is_valid_vector_argument<T>());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::find` algorithm for contiguous ranges.
+ *
+ * \return Iterator to the first element equal to \p value, or \p last.
+ */
+template <class InputIt, class T>
+inline InputIt find(InputIt first, InputIt last, const T &value)
+{
+    using U = typename std::iterator_traits<InputIt>::value_type;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return last;
+    }
+    auto pred = Common::make_equal_to(static_cast<U>(value));
+    return first + Common::find_if_impl(std::addressof(*first), n, pred,
+                                        Traits::is_valid_vector_argument<U>());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::count_if` algorithm for contiguous ranges.
+ *
+ * \p pred has the same requirements as for Vc::find_if.
+ *
+ * \return The number of elements for which \p pred returned \c true.
+ */
+template <class InputIt, class UnaryPredicate>
+inline typename std::iterator_traits<InputIt>::difference_type count_if(
+    InputIt first, InputIt last, UnaryPredicate pred)
+{
+    using T = typename std::iterator_traits<InputIt>::value_type;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return 0;
+    }
+    return Common::count_if_impl(std::addressof(*first), n, pred,
+                                 Traits::is_valid_vector_argument<T>());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::count` algorithm for contiguous ranges.
+ *
+ * \return The number of elements equal to \p value.
+ */
+template <class InputIt, class T>
+inline typename std::iterator_traits<InputIt>::difference_type count(InputIt first,
+                                                                     InputIt last,
+                                                                     const T &value)
+{
+    using U = typename std::iterator_traits<InputIt>::value_type;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return 0;
+    }
+    auto pred = Common::make_equal_to(static_cast<U>(value));
+    return Common::count_if_impl(std::addressof(*first), n, pred,
+                                 Traits::is_valid_vector_argument<U>());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::lower_bound` algorithm for sorted contiguous ranges.
+ *
+ * The binary search stops as soon as the remaining range fits into four vectors. The
+ * bound is then determined by counting the elements less than \p value in that window.
+ *
+ * \return Iterator to the first element not less than \p value, or \p last.
+ */
+template <class ForwardIt, class T>
+inline ForwardIt lower_bound(ForwardIt first, ForwardIt last, const T &value)
+{
+    using U = typename std::iterator_traits<ForwardIt>::value_type;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return last;
+    }
+    return first + Common::bound_impl<false>(std::addressof(*first), n,
+                                             static_cast<U>(value),
+                                             Traits::is_valid_vector_argument<U>());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::upper_bound` algorithm for sorted contiguous ranges.
+ *
+ * \return Iterator to the first element greater than \p value, or \p last.
+ * \see lower_bound
+ */
+template <class ForwardIt, class T>
+inline ForwardIt upper_bound(ForwardIt first, ForwardIt last, const T &value)
+{
+    using U = typename std::iterator_traits<ForwardIt>::value_type;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return last;
+    }
+    return first + Common::bound_impl<true>(std::addressof(*first), n,
+                                            static_cast<U>(value),
+                                            Traits::is_valid_vector_argument<U>());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::mismatch` algorithm for two contiguous ranges of the same
+ * element type. The second range must be at least as long as the first.
+ *
+ * \return The pair of iterators to the first elements that differ, or \p last1 and the
+ *         corresponding iterator into the second range.
+ */
+template <class InputIt1, class InputIt2>
+inline std::pair<InputIt1, InputIt2> mismatch(InputIt1 first1, InputIt1 last1,
+                                              InputIt2 first2)
+{
+    using T = typename std::iterator_traits<InputIt1>::value_type;
+    static_assert(
+        std::is_same<T, typename std::iterator_traits<InputIt2>::value_type>::value,
+        "Vc::mismatch requires both ranges to have the same value_type");
+    const std::size_t n = std::distance(first1, last1);
+    if (n == 0) {
+        return {first1, first2};
+    }
+    const std::size_t i =
+        Common::mismatch_impl(std::addressof(*first1), n, std::addressof(*first2),
+                              Traits::is_valid_vector_argument<T>());
+    return {first1 + i, first2 + i};
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::min_element` algorithm for contiguous ranges.
+ *
+ * \return Iterator to the first smallest element, or \p last if the range is empty.
+ * \note The result is unspecified if a floating-point range contains NaNs.
+ */
+template <class ForwardIt> inline ForwardIt min_element(ForwardIt first, ForwardIt last)
+{
+    using T = typename std::iterator_traits<ForwardIt>::value_type;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return last;
+    }
+    return first + Common::extreme_element_impl<false>(
+                       std::addressof(*first), n, Traits::is_valid_vector_argument<T>());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::max_element` algorithm for contiguous ranges.
+ *
+ * \return Iterator to the first largest element, or \p last if the range is empty.
+ * \note The result is unspecified if a floating-point range contains NaNs.
+ */
+template <class ForwardIt> inline ForwardIt max_element(ForwardIt first, ForwardIt last)
+{
+    using T = typename std::iterator_traits<ForwardIt>::value_type;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return last;
+    }
+    return first + Common::extreme_element_impl<true>(
+                       std::addressof(*first), n, Traits::is_valid_vector_argument<T>());
+}
+// }}}1
+
 }  // namespace Vc
 
 #endif // VC_COMMON_ALGORITHMS_H_
@@ -0,0 +1,830 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_ARRAYEXPRESSION_H_
+#define VC_COMMON_ARRAYEXPRESSION_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include "memorybase.h"
+#include "parallel.h"
+#include "span.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/**
+ * \defgroup ArrayExpressions Whole-array expressions
+ * \ingroup Containers
+ *
+ * Arithmetic on one-dimensional Vc::Memory objects and Vc::span views is evaluated
+ * lazily: an operator returns a small expression object that only records its operands.
+ * The assignment to a destination then evaluates the complete expression in a single
+ * vectorized loop, without temporary arrays and with one pass over memory:
+ * \code
+ * Vc::Memory<float_v> a(n), b(n), c(n), d(n), e(n);
+ * a = b * c + d * e;                      // one loop, contracted to fma(b, c, d * e)
+ * a += 2.f * b;                           // compound assignment
+ * Vc::where(b > 0.f, a) = Vc::sqrt(b);    // masked assignment
+ * Vc::parallel_assign(a, b * c + d, 4);   // the same loop split across 4 threads
+ * Vc::assign(Vc::span<float>(ptr, n), a - b);  // spans as destination
+ * \endcode
+ *
+ * Operands are 1-D Memory objects, spans of vectorizable entry types, other expressions,
+ * and arithmetic scalars (which are broadcast). All array operands of one expression must
+ * use the same vector type and have the same number of entries. Memory operands are read
+ * with aligned loads; the loop switches to unaligned accesses as soon as a span is
+ * involved. The remainder that does not fill a whole vector is handled with partial
+ * loads and stores, so that no memory past the end of a span is touched.
+ *
+ * With FMA support (`Vc_IMPL_FMA` or `Vc_IMPL_FMA4`) floating-point expressions of the
+ * form `a * b + c`, `c + a * b`, and `a * b - c` are evaluated with Vc::fma.
+ *
+ * \note Comparisons between two bare Memory objects keep comparing the whole arrays (see
+ * MemoryBase). Wrap one of them with Vc::make_expression to compare entry-wise.
+ *
+ * \note The destination may be one of the operands, but it must not partially overlap
+ * any of them.
+ *
+ * \headerfile arrayexpression.h <Vc/array_expression>
+ */
+
+template <typename T> struct is_array_expression : public std::false_type {};
+
+// memory access {{{1
+/**\internal
+ * Selects the entries `[i, i + V::Size)` of every array operand in the main loop.
+ */
+template <typename Flags> struct ArrayVectorAccess {
+    std::size_t i;
+
+    template <typename V, typename T> Vc_INTRINSIC V load(const T *mem) const
+    {
+        return V(mem + i, Flags());
+    }
+};
+
+/**\internal
+ * Selects the last `n < V::Size` entries starting at \p i. Entries past the end are set to
+ * one so that a division in the remainder cannot trap.
+ */
+struct ArrayTailAccess {
+    std::size_t i, n;
+
+    template <typename V, typename T> Vc_INTRINSIC V load(const T *mem) const
+    {
+        V x = V::One();
+        x.load_partial(mem + i, n);
+        where(V::IndexesFromZero() >= V(static_cast<T>(n))) | x = V::One();
+        return x;
+    }
+};
+
+// terminals {{{1
+/**\internal
+ * Array operand: \p Aligned is \c true for Memory objects, whose data starts on a vector
+ * boundary.
+ */
+template <typename V, bool Aligned> class ArrayTerminal
+{
+    using T = typename V::EntryType;
+
+public:
+    using vector_type = V;
+    static constexpr bool aligned = Aligned;
+
+    ArrayTerminal(const T *mem, std::size_t n) : m_mem(mem), m_size(n) {}
+
+    std::size_t size() const { return m_size; }
+    template <typename A> Vc_INTRINSIC V get(const A &access) const
+    {
+        return access.template load<V>(m_mem);
+    }
+
+private:
+    const T *m_mem;
+    std::size_t m_size;
+};
+
+/**\internal
+ * Scalar operand, broadcast to all entries.
+ */
+template <typename V> class ArrayScalar
+{
+public:
+    using vector_type = V;
+    static constexpr bool aligned = true;
+
+    ArrayScalar(typename V::EntryType x) : m_value(x) {}
+
+    std::size_t size() const { return std::size_t(-1); }
+    template <typename A> Vc_INTRINSIC V get(const A &) const { return m_value; }
+
+private:
+    V m_value;
+};
+
+template <typename V, bool A> struct is_array_expression<ArrayTerminal<V, A>> : public std::true_type {};
+template <typename V> struct is_array_expression<ArrayScalar<V>> : public std::true_type {};
+
+// operations {{{1
+namespace ArrayOperations
+{
+#define Vc_ARRAY_BINARY_OPERATION(name_, op_)                                            \
+    struct name_ {                                                                       \
+        template <typename L, typename R>                                                \
+        Vc_INTRINSIC auto operator()(const L &l, const R &r) const -> decltype(l op_ r)  \
+        {                                                                                \
+            return l op_ r;                                                              \
+        }                                                                                \
+    }
+Vc_ARRAY_BINARY_OPERATION(Plus, +);
+Vc_ARRAY_BINARY_OPERATION(Minus, -);
+Vc_ARRAY_BINARY_OPERATION(Multiplies, *);
+Vc_ARRAY_BINARY_OPERATION(Divides, /);
+Vc_ARRAY_BINARY_OPERATION(Less, <);
+Vc_ARRAY_BINARY_OPERATION(LessEqual, <=);
+Vc_ARRAY_BINARY_OPERATION(Greater, >);
+Vc_ARRAY_BINARY_OPERATION(GreaterEqual, >=);
+Vc_ARRAY_BINARY_OPERATION(EqualTo, ==);
+Vc_ARRAY_BINARY_OPERATION(NotEqualTo, !=);
+Vc_ARRAY_BINARY_OPERATION(LogicalAnd, &&);
+Vc_ARRAY_BINARY_OPERATION(LogicalOr, ||);
+#undef Vc_ARRAY_BINARY_OPERATION
+
+#define Vc_ARRAY_FUNCTION(name_, expr_)                                                  \
+    struct name_ {                                                                       \
+        template <typename A> Vc_INTRINSIC A operator()(const A &a) const { return expr_; } \
+    }
+Vc_ARRAY_FUNCTION(Negate, -a);
+Vc_ARRAY_FUNCTION(LogicalNot, !a);
+Vc_ARRAY_FUNCTION(Abs, Vc::abs(a));
+Vc_ARRAY_FUNCTION(Sqrt, Vc::sqrt(a));
+#undef Vc_ARRAY_FUNCTION
+
+struct Min {
+    template <typename V> Vc_INTRINSIC V operator()(const V &a, const V &b) const
+    {
+        return Vc::min(a, b);
+    }
+};
+struct Max {
+    template <typename V> Vc_INTRINSIC V operator()(const V &a, const V &b) const
+    {
+        return Vc::max(a, b);
+    }
+};
+struct Fma {
+    template <typename V>
+    Vc_INTRINSIC V operator()(const V &a, const V &b, const V &c) const
+    {
+        return Vc::fma(a, b, c);
+    }
+};
+struct Select {
+    template <typename M, typename V>
+    Vc_INTRINSIC V operator()(const M &k, const V &a, const V &b) const
+    {
+        return Vc::iif(k, a, b);
+    }
+};
+}  // namespace ArrayOperations
+
+/**\internal
+ * Whether `a * b + c` is contracted into `fma(a, b, c)`. Without hardware support
+ * Vc::fma is emulated and considerably slower than a multiplication and an addition.
+ */
+template <typename V>
+struct ArrayContractsFma
+    : public std::integral_constant<bool,
+#if defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4
+                                    std::is_floating_point<typename V::EntryType>::value
+#else
+                                    false
+#endif
+                                    > {
+};
+
+// expression nodes {{{1
+template <typename Op, typename A> class ArrayUnary
+{
+public:
+    using vector_type = typename A::vector_type;
+    static constexpr bool aligned = A::aligned;
+
+    ArrayUnary(const A &a) : m_a(a) {}
+
+    std::size_t size() const { return m_a.size(); }
+    template <typename X>
+    Vc_INTRINSIC auto get(const X &access) const -> decltype(Op()(std::declval<const A &>().get(access)))
+    {
+        return Op()(m_a.get(access));
+    }
+
+private:
+    A m_a;
+};
+
+template <typename Op, typename L, typename R> class ArrayBinary
+{
+    static_assert(std::is_same<typename L::vector_type, typename R::vector_type>::value,
+                  "all operands of an array expression must use the same vector type");
+
+public:
+    using vector_type = typename L::vector_type;
+    static constexpr bool aligned = L::aligned && R::aligned;
+
+    ArrayBinary(const L &l, const R &r) : m_l(l), m_r(r) {}
+
+    std::size_t size() const
+    {
+        Vc_ASSERT(m_l.size() == m_r.size() || m_l.size() == std::size_t(-1) ||
+                  m_r.size() == std::size_t(-1));
+        return std::min(m_l.size(), m_r.size());
+    }
+    const L &left() const { return m_l; }
+    const R &right() const { return m_r; }
+
+    template <typename X>
+    Vc_INTRINSIC auto get(const X &access) const
+        -> decltype(Op()(std::declval<const L &>().get(access),
+                         std::declval<const R &>().get(access)));
+
+private:
+    L m_l;
+    R m_r;
+};
+
+template <typename Op, typename A, typename B, typename C> class ArrayTernary
+{
+    static_assert(std::is_same<typename B::vector_type, typename C::vector_type>::value &&
+                      std::is_same<typename A::vector_type, typename C::vector_type>::value,
+                  "all operands of an array expression must use the same vector type");
+
+public:
+    using vector_type = typename C::vector_type;
+    static constexpr bool aligned = A::aligned && B::aligned && C::aligned;
+
+    ArrayTernary(const A &a, const B &b, const C &c) : m_a(a), m_b(b), m_c(c) {}
+
+    std::size_t size() const
+    {
+        return std::min(m_a.size(), std::min(m_b.size(), m_c.size()));
+    }
+    template <typename X>
+    Vc_INTRINSIC auto get(const X &access) const
+        -> decltype(Op()(std::declval<const A &>().get(access),
+                         std::declval<const B &>().get(access),
+                         std::declval<const C &>().get(access)))
+    {
+        return Op()(m_a.get(access), m_b.get(access), m_c.get(access));
+    }
+
+private:
+    A m_a;
+    B m_b;
+    C m_c;
+};
+
+template <typename Op, typename A>
+struct is_array_expression<ArrayUnary<Op, A>> : public std::true_type {};
+template <typename Op, typename L, typename R>
+struct is_array_expression<ArrayBinary<Op, L, R>> : public std::true_type {};
+template <typename Op, typename A, typename B, typename C>
+struct is_array_expression<ArrayTernary<Op, A, B, C>> : public std::true_type {};
+
+// fma contraction {{{1
+template <typename Op, typename L, typename R, typename X>
+Vc_INTRINSIC auto evaluate_binary(Op op, const L &l, const R &r, const X &access)
+    -> decltype(op(l.get(access), r.get(access)))
+{
+    return op(l.get(access), r.get(access));
+}
+
+template <typename A, typename B, typename R, typename X>
+Vc_INTRINSIC enable_if<ArrayContractsFma<typename R::vector_type>::value,
+                       typename R::vector_type>
+evaluate_binary(ArrayOperations::Plus,
+                const ArrayBinary<ArrayOperations::Multiplies, A, B> &l, const R &r,
+                const X &access)
+{
+    return Vc::fma(l.left().get(access), l.right().get(access), r.get(access));
+}
+
+template <typename L, typename A, typename B, typename X>
+Vc_INTRINSIC enable_if<ArrayContractsFma<typename L::vector_type>::value,
+                       typename L::vector_type>
+evaluate_binary(ArrayOperations::Plus, const L &l,
+                const ArrayBinary<ArrayOperations::Multiplies, A, B> &r, const X &access)
+{
+    return Vc::fma(r.left().get(access), r.right().get(access), l.get(access));
+}
+
+template <typename A, typename B, typename C, typename D, typename X>
+Vc_INTRINSIC enable_if<ArrayContractsFma<typename A::vector_type>::value,
+                       typename A::vector_type>
+evaluate_binary(ArrayOperations::Plus,
+                const ArrayBinary<ArrayOperations::Multiplies, A, B> &l,
+                const ArrayBinary<ArrayOperations::Multiplies, C, D> &r, const X &access)
+{
+    return Vc::fma(l.left().get(access), l.right().get(access), r.get(access));
+}
+
+template <typename A, typename B, typename R, typename X>
+Vc_INTRINSIC enable_if<ArrayContractsFma<typename R::vector_type>::value,
+                       typename R::vector_type>
+evaluate_binary(ArrayOperations::Minus,
+                const ArrayBinary<ArrayOperations::Multiplies, A, B> &l, const R &r,
+                const X &access)
+{
+    return Vc::fma(l.left().get(access), l.right().get(access), -r.get(access));
+}
+
+template <typename Op, typename L, typename R>
+template <typename X>
+Vc_INTRINSIC auto ArrayBinary<Op, L, R>::get(const X &access) const
+    -> decltype(Op()(std::declval<const L &>().get(access),
+                     std::declval<const R &>().get(access)))
+{
+    return evaluate_binary(Op(), m_l, m_r, access);
+}
+
+// operands {{{1
+template <typename V, typename P, typename RM>
+std::true_type is_memory_1d(const MemoryBase<V, P, 1, RM> *);
+std::false_type is_memory_1d(...);
+template <typename V, typename P, typename RM>
+V memory_vector_type(const MemoryBase<V, P, 1, RM> *);
+template <typename T, std::ptrdiff_t Extent> T *span_pointer(const span<T, Extent> *);
+
+/**\internal
+ * Maps the types that may appear as array operands to their expression node: `type` and
+ * `make(x)`.
+ */
+template <typename U, typename = void> struct ArrayOperand : public std::false_type {};
+
+template <typename E>
+struct ArrayOperand<E, typename std::enable_if<is_array_expression<E>::value>::type>
+    : public std::true_type {
+    using type = E;
+    static const E &make(const E &x) { return x; }
+};
+
+template <typename M>
+struct ArrayOperand<
+    M, typename std::enable_if<decltype(is_memory_1d(std::declval<M *>()))::value>::type>
+    : public std::true_type {
+    using type = ArrayTerminal<decltype(memory_vector_type(std::declval<M *>())), true>;
+    static type make(const M &x) { return {x.entries(), x.entriesCount()}; }
+};
+
+template <typename S>
+struct ArrayOperand<S, typename std::enable_if<Traits::is_valid_vector_argument<
+                           typename std::remove_const<typename std::remove_pointer<decltype(
+                               span_pointer(std::declval<S *>()))>::type>::type>::value>::type>
+    : public std::true_type {
+    using T = typename std::remove_pointer<decltype(span_pointer(std::declval<S *>()))>::type;
+    using type = ArrayTerminal<Vector<typename std::remove_const<T>::type>, false>;
+    static type make(const S &x) { return {x.data(), static_cast<std::size_t>(x.size())}; }
+};
+
+template <typename U> using array_operand = ArrayOperand<typename std::decay<U>::type>;
+
+/**\internal
+ * The expression node for \p U when combined with \p Other: scalars become ArrayScalar
+ * of the vector type of \p Other. Without any array operand there is no `type`, which
+ * removes the operators below from overload resolution.
+ */
+template <typename U, typename Other, bool = array_operand<U>::value,
+          bool = array_operand<Other>::value>
+struct ArrayArgument {
+};
+template <typename U, typename Other, bool B> struct ArrayArgument<U, Other, true, B> {
+    using type = typename array_operand<U>::type;
+    static Vc_INTRINSIC type make(const U &x) { return array_operand<U>::make(x); }
+};
+template <typename U, typename Other> struct ArrayArgument<U, Other, false, true> {
+    using V = typename array_operand<Other>::type::vector_type;
+    using type = ArrayScalar<V>;
+    static Vc_INTRINSIC type make(const U &x)
+    {
+        return type(static_cast<typename V::EntryType>(x));
+    }
+};
+
+template <typename U>
+struct is_bare_memory
+    : public decltype(is_memory_1d(std::declval<typename std::decay<U>::type *>())) {
+};
+
+/**\internal
+ * The right-hand sides that Memory::operator= and the compound assignment operators of
+ * MemoryBase evaluate as array expressions (Memory objects have their own overloads).
+ */
+template <typename E>
+struct is_array_assignable<E, typename std::enable_if<array_operand<E>::value &&
+                                                      !is_bare_memory<E>::value>::type>
+    : public std::true_type {
+};
+
+/**\internal
+ * Whether `L op R` forms an expression: at least one array operand, the other one an
+ * array operand or arithmetic scalar.
+ */
+template <typename L, typename R>
+struct is_array_operation
+    : public std::integral_constant<
+          bool, (array_operand<L>::value && (array_operand<R>::value ||
+                                             std::is_arithmetic<typename std::decay<R>::type>::value)) ||
+                    (array_operand<R>::value &&
+                     std::is_arithmetic<typename std::decay<L>::type>::value)> {
+};
+
+/**\internal
+ * Comparisons of two bare Memory objects are members of MemoryBase and return \c bool.
+ */
+template <typename L, typename R>
+struct is_array_comparison
+    : public std::integral_constant<bool, is_array_operation<L, R>::value &&
+                                              !(is_bare_memory<L>::value &&
+                                                is_bare_memory<R>::value)> {
+};
+
+template <typename Op, typename L, typename R>
+using array_binary = ArrayBinary<Op, typename ArrayArgument<L, R>::type,
+                                 typename ArrayArgument<R, L>::type>;
+
+template <typename Op, typename L, typename R>
+Vc_INTRINSIC array_binary<Op, L, R> make_array_binary(const L &l, const R &r)
+{
+    return {ArrayArgument<L, R>::make(l), ArrayArgument<R, L>::make(r)};
+}
+
+// operators {{{1
+#define Vc_ARRAY_OPERATOR(op_, name_, condition_)                                        \
+    template <typename L, typename R>                                                    \
+    Vc_INTRINSIC enable_if<condition_, array_binary<ArrayOperations::name_, L, R>>       \
+    operator op_(const L &l, const R &r)                                                 \
+    {                                                                                    \
+        return make_array_binary<ArrayOperations::name_>(l, r);                          \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_ARRAY_OPERATOR(+, Plus, (is_array_operation<L, R>::value));
+Vc_ARRAY_OPERATOR(-, Minus, (is_array_operation<L, R>::value));
+Vc_ARRAY_OPERATOR(*, Multiplies, (is_array_operation<L, R>::value));
+Vc_ARRAY_OPERATOR(/, Divides, (is_array_operation<L, R>::value));
+Vc_ARRAY_OPERATOR(==, EqualTo, (is_array_comparison<L, R>::value));
+Vc_ARRAY_OPERATOR(!=, NotEqualTo, (is_array_comparison<L, R>::value));
+Vc_ARRAY_OPERATOR(<, Less, (is_array_comparison<L, R>::value));
+Vc_ARRAY_OPERATOR(<=, LessEqual, (is_array_comparison<L, R>::value));
+Vc_ARRAY_OPERATOR(>, Greater, (is_array_comparison<L, R>::value));
+Vc_ARRAY_OPERATOR(>=, GreaterEqual, (is_array_comparison<L, R>::value));
+Vc_ARRAY_OPERATOR(&&, LogicalAnd, (is_array_expression<L>::value && is_array_expression<R>::value));
+Vc_ARRAY_OPERATOR(||, LogicalOr, (is_array_expression<L>::value && is_array_expression<R>::value));
+#undef Vc_ARRAY_OPERATOR
+
+template <typename A>
+Vc_INTRINSIC enable_if<array_operand<A>::value,
+                       ArrayUnary<ArrayOperations::Negate, typename array_operand<A>::type>>
+operator-(const A &a)
+{
+    return {array_operand<A>::make(a)};
+}
+
+template <typename A>
+Vc_INTRINSIC enable_if<is_array_expression<A>::value, ArrayUnary<ArrayOperations::LogicalNot, A>>
+operator!(const A &a)
+{
+    return {a};
+}
+
+// functions {{{1
+/**
+ * \ingroup ArrayExpressions
+ * Returns \p x as an array expression. This is only needed to compare two Memory objects
+ * entry-wise (see \ref ArrayExpressions).
+ */
+template <typename A>
+Vc_INTRINSIC enable_if<array_operand<A>::value, typename array_operand<A>::type>
+make_expression(const A &x)
+{
+    return array_operand<A>::make(x);
+}
+
+#define Vc_ARRAY_FUNCTION(name_, op_)                                                    \
+    template <typename A>                                                                \
+    Vc_INTRINSIC enable_if<array_operand<A>::value,                                     \
+                           ArrayUnary<ArrayOperations::op_, typename array_operand<A>::type>> \
+    name_(const A &a)                                                                    \
+    {                                                                                    \
+        return {array_operand<A>::make(a)};                                              \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_ARRAY_FUNCTION(abs, Abs);
+Vc_ARRAY_FUNCTION(sqrt, Sqrt);
+#undef Vc_ARRAY_FUNCTION
+
+#define Vc_ARRAY_FUNCTION(name_, op_)                                                    \
+    template <typename L, typename R>                                                    \
+    Vc_INTRINSIC enable_if<is_array_operation<L, R>::value,                             \
+                           array_binary<ArrayOperations::op_, L, R>>                     \
+    name_(const L &l, const R &r)                                                        \
+    {                                                                                    \
+        return make_array_binary<ArrayOperations::op_>(l, r);                            \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_ARRAY_FUNCTION(min, Min);
+Vc_ARRAY_FUNCTION(max, Max);
+#undef Vc_ARRAY_FUNCTION
+
+/**\internal
+ * The vector type of the first array operand among \p Ts.
+ */
+template <typename... Ts> struct ArrayVectorType;
+template <typename T, typename... Ts> struct ArrayVectorType<T, Ts...> {
+    using type = typename std::conditional<array_operand<T>::value, T,
+                                           typename ArrayVectorType<Ts...>::type>::type;
+};
+template <> struct ArrayVectorType<> {
+    using type = void;
+};
+
+template <typename... Ts>
+using array_ternary_operand = typename ArrayVectorType<Ts...>::type;
+
+template <typename A, typename B, typename C>
+using is_array_ternary = std::integral_constant<
+    bool, (array_operand<A>::value || array_operand<B>::value || array_operand<C>::value) &&
+              (array_operand<A>::value || std::is_arithmetic<A>::value) &&
+              (array_operand<B>::value || std::is_arithmetic<B>::value) &&
+              (array_operand<C>::value || std::is_arithmetic<C>::value)>;
+
+template <typename Op, typename A, typename B, typename C, typename O>
+using array_ternary = ArrayTernary<Op, typename ArrayArgument<A, O>::type,
+                                   typename ArrayArgument<B, O>::type,
+                                   typename ArrayArgument<C, O>::type>;
+
+/**
+ * \ingroup ArrayExpressions
+ * Lazily evaluated `a * b + c` (with a single rounding if the target supports FMA).
+ */
+template <typename A, typename B, typename C,
+          typename O = array_ternary_operand<A, B, C>>
+Vc_INTRINSIC enable_if<is_array_ternary<A, B, C>::value,
+                       array_ternary<ArrayOperations::Fma, A, B, C, O>>
+fma(const A &a, const B &b, const C &c)
+{
+    return {ArrayArgument<A, O>::make(a), ArrayArgument<B, O>::make(b),
+            ArrayArgument<C, O>::make(c)};
+}
+
+/**
+ * \ingroup ArrayExpressions
+ * Lazily evaluated entry-wise selection: `k[i] ? a[i] : b[i]`. \p k must be an expression
+ * that yields a mask, e.g. a comparison.
+ */
+template <typename K, typename A, typename B, typename O = array_ternary_operand<A, B, K>>
+Vc_INTRINSIC enable_if<is_array_expression<K>::value &&
+                               (array_operand<A>::value || std::is_arithmetic<A>::value) &&
+                           (array_operand<B>::value || std::is_arithmetic<B>::value),
+                       ArrayTernary<ArrayOperations::Select, K,
+                                    typename ArrayArgument<A, O>::type,
+                                    typename ArrayArgument<B, O>::type>>
+iif(const K &k, const A &a, const B &b)
+{
+    return {k, ArrayArgument<A, O>::make(a), ArrayArgument<B, O>::make(b)};
+}
+
+// evaluation {{{1
+/**\internal
+ * The assignment operators supported for array destinations.
+ */
+template <Operator O> struct ArrayAssign;
+#define Vc_ARRAY_ASSIGN(name_, op_, load_)                                               \
+    template <> struct ArrayAssign<Operator::name_> {                                    \
+        static constexpr bool loads = load_;                                             \
+        template <typename V> static Vc_INTRINSIC void apply(V &lhs, const V &rhs)       \
+        {                                                                                \
+            lhs op_ rhs;                                                                 \
+        }                                                                                \
+        template <typename V, typename M>                                                \
+        static Vc_INTRINSIC void apply(V &lhs, const V &rhs, const M &mask)              \
+        {                                                                                \
+            where(mask) | lhs op_ rhs;                                                   \
+        }                                                                                \
+    }
+Vc_ARRAY_ASSIGN(Assign, =, false);
+Vc_ARRAY_ASSIGN(PlusAssign, +=, true);
+Vc_ARRAY_ASSIGN(MinusAssign, -=, true);
+Vc_ARRAY_ASSIGN(MultiplyAssign, *=, true);
+Vc_ARRAY_ASSIGN(DivideAssign, /=, true);
+#undef Vc_ARRAY_ASSIGN
+
+/**\internal
+ * Placeholder for the mask of an unmasked assignment.
+ */
+struct ArrayNoMask {
+    using vector_type = void;
+    static constexpr bool aligned = true;
+    std::size_t size() const { return std::size_t(-1); }
+    template <typename X> bool get(const X &) const { return true; }
+};
+
+template <Operator O, typename V>
+Vc_INTRINSIC void array_apply(V &lhs, const V &rhs, bool)
+{
+    ArrayAssign<O>::apply(lhs, rhs);
+}
+template <Operator O, typename V, typename M>
+Vc_INTRINSIC void array_apply(V &lhs, const V &rhs, const M &mask)
+{
+    ArrayAssign<O>::apply(lhs, rhs, mask);
+}
+
+/**\internal
+ * Evaluates `dst[i] op= e[i]` where `mask[i]` for all `i` in `[begin, end)`. \p begin
+ * must be a multiple of `V::Size`.
+ */
+template <Operator O, typename Flags, typename V, typename M, typename E>
+inline void evaluate_array(typename V::EntryType *dst, std::size_t begin,
+                           std::size_t end, const M &mask_, const E &e_)
+{
+    // Local copies of the expression trees: vector stores may alias anything, which would
+    // otherwise force a reload of every operand pointer after each store.
+    const M mask = mask_;
+    const E e = e_;
+    constexpr bool Loads = ArrayAssign<O>::loads || !std::is_same<M, ArrayNoMask>::value;
+    std::size_t i = begin;
+    for (; i + V::Size <= end; i += V::Size) {
+        const ArrayVectorAccess<Flags> access = {i};
+        V lhs;
+        if (Loads) {
+            lhs.load(dst + i, Flags());
+        }
+        array_apply<O>(lhs, static_cast<V>(e.get(access)), mask.get(access));
+        lhs.store(dst + i, Flags());
+    }
+    if (i < end) {
+        const ArrayTailAccess access = {i, end - i};
+        V lhs = V::Zero();
+        if (Loads) {
+            lhs.load_partial(dst + i, end - i);
+        }
+        array_apply<O>(lhs, static_cast<V>(e.get(access)), mask.get(access));
+        lhs.store_partial(dst + i, end - i);
+    }
+}
+
+/**\internal
+ * Destinations of array assignments: 1-D Memory objects and spans of mutable entries.
+ */
+template <typename D, typename = void> struct ArrayDestination : public std::false_type {};
+template <typename M>
+struct ArrayDestination<
+    M, typename std::enable_if<decltype(is_memory_1d(std::declval<M *>()))::value>::type>
+    : public std::true_type {
+    using V = decltype(memory_vector_type(std::declval<M *>()));
+    static constexpr bool aligned = true;
+    static typename V::EntryType *data(M &x) { return x.entries(); }
+    static std::size_t size(const M &x) { return x.entriesCount(); }
+};
+template <typename S>
+struct ArrayDestination<
+    S, typename std::enable_if<Traits::is_valid_vector_argument<typename std::remove_pointer<
+           decltype(span_pointer(std::declval<S *>()))>::type>::value>::type>
+    : public std::true_type {
+    using T = typename std::remove_pointer<decltype(span_pointer(std::declval<S *>()))>::type;
+    using V = Vector<T>;
+    static constexpr bool aligned = false;
+    static T *data(const S &x) { return x.data(); }
+    static std::size_t size(const S &x) { return x.size(); }
+};
+
+template <typename D> using array_destination = ArrayDestination<typename std::decay<D>::type>;
+
+/**\internal
+ * The expression node for the right-hand side \p U of an assignment to \p D.
+ */
+template <typename U, typename D, bool = array_operand<U>::value> struct ArrayRhs {
+    using type = typename array_operand<U>::type;
+    static type make(const U &x) { return array_operand<U>::make(x); }
+};
+template <typename U, typename D> struct ArrayRhs<U, D, false> {
+    using V = typename array_destination<D>::V;
+    using type = ArrayScalar<V>;
+    static type make(const U &x) { return type(static_cast<typename V::EntryType>(x)); }
+};
+
+template <Operator O, typename D, typename M, typename E>
+inline void assign_array(D &dst, const M &mask, const E &e, unsigned threads)
+{
+    using Dst = array_destination<D>;
+    using V = typename Dst::V;
+    static_assert(std::is_same<V, typename E::vector_type>::value,
+                  "the destination and the expression must use the same vector type");
+    typename V::EntryType *mem = Dst::data(dst);
+    const std::size_t n = Dst::size(dst);
+    Vc_ASSERT(e.size() == n || e.size() == std::size_t(-1));
+    Vc_ASSERT(mask.size() == n || mask.size() == std::size_t(-1));
+    const auto &&chunk = [&](unsigned, std::size_t begin, std::size_t end) {
+        if (Dst::aligned && E::aligned && M::aligned) {
+            evaluate_array<O, AlignedTag, V>(mem, begin, end, mask, e);
+        } else {
+            evaluate_array<O, UnalignedTag, V>(mem, begin, end, mask, e);
+        }
+    };
+    constexpr std::size_t Grain = 1 << 16;
+    parallel_chunks(n, threads == 1 ? 1 : thread_count(n, threads, Grain), V::Size, chunk);
+}
+
+template <Operator O, typename D, typename E>
+inline void assign_expression(D &dst, const E &x)
+{
+    assign_array<O>(dst, ArrayNoMask(), array_operand<E>::make(x), 1);
+}
+
+template <typename D, typename U>
+using enable_if_array_assignment =
+    enable_if<array_destination<D>::value &&
+              (array_operand<U>::value || std::is_arithmetic<U>::value)>;
+
+/**
+ * \ingroup ArrayExpressions
+ * Evaluates \p x into the 1-D Memory object or span \p dst. \p x may be an expression, a
+ * Memory object, a span, or a scalar.
+ */
+template <typename D, typename U, typename = enable_if_array_assignment<D, U>>
+inline void assign(D &&dst, const U &x)
+{
+    assign_array<Operator::Assign>(dst, ArrayNoMask(), ArrayRhs<U, D>::make(x), 1);
+}
+
+/**
+ * \ingroup ArrayExpressions
+ * Multithreaded variant of Vc::assign for large arrays.
+ *
+ * \param dst The 1-D Memory object or span to write.
+ * \param x The expression to evaluate.
+ * \param threads The number of threads to use. 0 selects
+ *                `std::thread::hardware_concurrency()`. Arrays too short to be worth
+ *                splitting are evaluated on the calling thread.
+ */
+template <typename D, typename U, typename = enable_if_array_assignment<D, U>>
+inline void parallel_assign(D &&dst, const U &x, unsigned threads = 0)
+{
+    assign_array<Operator::Assign>(dst, ArrayNoMask(), ArrayRhs<U, D>::make(x), threads);
+}
+
+/**\internal
+ * Masked assignment to arrays: `Vc::where(make_expression(a) > b, dst) = expr;`
+ */
+template <Operator O, typename D, typename M, typename U>
+inline enable_if<array_destination<D>::value && is_array_expression<M>::value, void>
+conditional_assign(D &lhs, const M &mask, const U &rhs)
+{
+    assign_array<O>(lhs, mask, ArrayRhs<U, D>::make(rhs), 1);
+}
+//}}}1
+}  // namespace Common
+
+using Common::abs;
+using Common::assign;
+using Common::fma;
+using Common::iif;
+using Common::make_expression;
+using Common::max;
+using Common::min;
+using Common::parallel_assign;
+using Common::sqrt;
+}  // namespace Vc
+
+#endif  // VC_COMMON_ARRAYEXPRESSION_H_
+
+// vim: foldmethod=marker
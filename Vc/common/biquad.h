@@ -0,0 +1,340 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_BIQUAD_H_
+#define VC_COMMON_BIQUAD_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+#include "../vector.h"
+#include "../Allocator"
+#include "transpose.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+// biquad_coefficients{{{1
+/**
+ * \ingroup Math
+ *
+ * The coefficients of one second-order section, normalized to \f$a_0 = 1\f$:
+ *
+ * \f[H(z) = \frac{b_0 + b_1 z^{-1} + b_2 z^{-2}}{1 + a_1 z^{-1} + a_2 z^{-2}}\f]
+ *
+ * The factory functions implement the low- and high-pass filters of R. Bristow-Johnson's
+ * "Audio EQ Cookbook". \p frequency is the cutoff divided by the sample rate.
+ */
+template <typename T> struct biquad_coefficients {
+    T b0 = 1, b1 = 0, b2 = 0, a1 = 0, a2 = 0;
+
+    /// Passes the input through unchanged.
+    static biquad_coefficients identity() { return {}; }
+
+    /// A second-order low-pass with quality factor \p q (\f$1/\sqrt 2\f$: Butterworth).
+    static biquad_coefficients lowpass(T frequency, T q = T(0.70710678118654752440))
+    {
+        return cookbook(frequency, q, false);
+    }
+    /// A second-order high-pass with quality factor \p q.
+    static biquad_coefficients highpass(T frequency, T q = T(0.70710678118654752440))
+    {
+        return cookbook(frequency, q, true);
+    }
+
+private:
+    static biquad_coefficients cookbook(T frequency, T q, bool high)
+    {
+        const double w = 2 * 3.14159265358979323846 * frequency;
+        const double alpha = std::sin(w) / (2 * q), c = std::cos(w);
+        const double a0 = 1 + alpha;
+        biquad_coefficients r;
+        r.b1 = static_cast<T>((high ? -(1 + c) : 1 - c) / a0);
+        r.b0 = r.b2 = static_cast<T>((high ? (1 + c) : 1 - c) / (2 * a0));
+        r.a1 = static_cast<T>(-2 * c / a0);
+        r.a2 = static_cast<T>((1 - alpha) / a0);
+        return r;
+    }
+};
+
+// biquad_bank{{{1
+/**
+ * \ingroup Math
+ *
+ * \c V::Size independent channels, each filtered by its own cascade of the same number
+ * of biquad sections. The coefficients and the state (transposed direct form II) are
+ * stored as vectors with one channel per lane, so the recursion, which cannot be
+ * vectorized along time, is vectorized across channels instead.
+ *
+ * Frames of interleaved samples (one value per channel, the channels adjacent in memory)
+ * are loaded as whole vectors. Planar buffers (one array per channel) are converted in
+ * blocks of \c V::Size frames with in-register transposes. For more channels than fit
+ * into a native vector use a Vc::SimdArray, e.g. `SimdArray<float, 32>`.
+ *
+ * The coefficients of single channels and sections can be changed at any time; the
+ * state of the filter is kept and nothing is reallocated.
+ *
+ * \code
+ * Vc::biquad_bank<Vc::float_v> bank(2);  // two sections, e.g. a 4th-order low-pass
+ * for (std::size_t c = 0; c < bank.channels(); ++c) {
+ *     bank.set(0, c, Vc::biquad_coefficients<float>::lowpass(cutoff[c]));
+ *     bank.set(1, c, Vc::biquad_coefficients<float>::lowpass(cutoff[c]));
+ * }
+ * bank.process(frames, frames, frameCount);  // in place
+ * \endcode
+ *
+ * \tparam V A \c float or \c double Vc::Vector or Vc::SimdArray.
+ */
+template <typename V> class biquad_bank
+{
+    static_assert(Traits::is_simd_vector<V>::value &&
+                      std::is_floating_point<typename V::EntryType>::value,
+                  "Vc::biquad_bank<V> requires a float or double Vector or SimdArray.");
+    using T = typename V::EntryType;
+
+public:
+    using value_type = T;
+    using vector_type = V;
+    using coefficients = biquad_coefficients<T>;
+
+    /// Creates \p sections sections per channel, all set to identity() and at rest.
+    explicit biquad_bank(std::size_t sections) : m_sections(sections) {}
+
+    /// Returns the number of channels, \c V::Size.
+    static constexpr std::size_t channels() { return V::Size; }
+    /// Returns the number of sections per channel.
+    std::size_t sections() const { return m_sections.size(); }
+
+    /// Sets section \p section of all channels to \p c.
+    void set(std::size_t section, const coefficients &c)
+    {
+        Section &s = m_sections[section];
+        s.b0 = c.b0;
+        s.b1 = c.b1;
+        s.b2 = c.b2;
+        s.a1 = c.a1;
+        s.a2 = c.a2;
+    }
+    /// Sets section \p section of channel \p channel to \p c.
+    void set(std::size_t section, std::size_t channel, const coefficients &c)
+    {
+        Section &s = m_sections[section];
+        s.b0[channel] = c.b0;
+        s.b1[channel] = c.b1;
+        s.b2[channel] = c.b2;
+        s.a1[channel] = c.a1;
+        s.a2[channel] = c.a2;
+    }
+    /// Returns the coefficients of section \p section of channel \p channel.
+    coefficients get(std::size_t section, std::size_t channel) const
+    {
+        const Section &s = m_sections[section];
+        coefficients c;
+        c.b0 = s.b0[channel];
+        c.b1 = s.b1[channel];
+        c.b2 = s.b2[channel];
+        c.a1 = s.a1[channel];
+        c.a2 = s.a2[channel];
+        return c;
+    }
+
+    /// Clears the state of all channels.
+    void reset()
+    {
+        for (Section &s : m_sections) {
+            s.z1 = V(0);
+            s.z2 = V(0);
+        }
+    }
+    /// Clears the state of channel \p channel.
+    void reset(std::size_t channel)
+    {
+        for (Section &s : m_sections) {
+            s.z1[channel] = 0;
+            s.z2[channel] = 0;
+        }
+    }
+
+    /// Filters one frame, \p x holding one sample per channel.
+    V process(V x)
+    {
+        for (Section &s : m_sections) {
+            x = s.step(x);
+        }
+        return x;
+    }
+
+    /**
+     * Filters \p frames interleaved frames. Frame \c f starts at `in + f * stride` and
+     * is written to `out + f * stride`, so a bank can work on \c channels() adjacent
+     * channels of a wider stream. \p in and \p out may be equal.
+     */
+    void process(const T *in, T *out, std::size_t frames, std::size_t stride = V::Size)
+    {
+        V block[Block];
+        while (frames > 0) {
+            const std::size_t n = std::min(frames, Block);
+            for (std::size_t f = 0; f < n; ++f) {
+                block[f] = V(in + f * stride, Vc::Unaligned);
+            }
+            run(block, n);
+            for (std::size_t f = 0; f < n; ++f) {
+                block[f].store(out + f * stride, Vc::Unaligned);
+            }
+            in += n * stride;
+            out += n * stride;
+            frames -= n;
+        }
+    }
+
+    /**
+     * Filters \p frames samples of every channel in planar layout: channel \c c is read
+     * from `in[c]` and written to `out[c]`. \p in and \p out may be equal.
+     */
+    void process(const T *const *in, T *const *out, std::size_t frames)
+    {
+        // the transpose needs a power-of-two number of channels
+        constexpr std::size_t W = (V::Size & (V::Size - 1)) == 0 ? V::Size : Block + 1;
+        V block[Block];
+        for (std::size_t f0 = 0; f0 < frames; f0 += Block) {
+            const std::size_t n = std::min(frames - f0, Block);
+            std::size_t f = 0;
+            for (; f + W <= n; f += W) {
+                for (std::size_t c = 0; c < W; ++c) {
+                    block[f + c] = V(in[c] + f0 + f, Vc::Unaligned);
+                }
+                Detail::transpose_square(block + f);
+            }
+            for (; f < n; ++f) {
+                block[f] = V([&](std::size_t c) { return in[c][f0 + f]; });
+            }
+            run(block, n);
+            for (f = 0; f + W <= n; f += W) {
+                Detail::transpose_square(block + f);
+                for (std::size_t c = 0; c < W; ++c) {
+                    block[f + c].store(out[c] + f0 + f, Vc::Unaligned);
+                }
+            }
+            for (; f < n; ++f) {
+                for (std::size_t c = 0; c < V::Size; ++c) {
+                    out[c][f0 + f] = block[f][c];
+                }
+            }
+        }
+    }
+
+private:
+    struct Section {
+        V b0 = V(1), b1 = V(0), b2 = V(0), a1 = V(0), a2 = V(0);
+        V z1 = V(0), z2 = V(0);
+
+        // The multiply-adds are explicit where the target has FMA. Otherwise the compiler
+        // contracts them (Vc builds with -ffp-contract=fast) depending on the context
+        // step is inlined into, and the planar and the per-frame paths would differ.
+        Vc_INTRINSIC V step(const V &x)
+        {
+#if defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4 || defined __FMA__ || defined __FMA4__ || \
+    defined __FP_FAST_FMA || defined __FP_FAST_FMAF
+            const V y = Vc::fma(b0, x, z1);
+            z1 = Vc::fma(b1, x, Vc::fma(-a1, y, z2));
+            z2 = Vc::fma(b2, x, -(a2 * y));
+#else
+            const V y = b0 * x + z1;
+            z1 = b1 * x - a1 * y + z2;
+            z2 = b2 * x - a2 * y;
+#endif
+            return y;
+        }
+    };
+
+    // Frames per block. The block is run through the sections in groups of up to four,
+    // whose coefficients and state stay in registers.
+    static constexpr std::size_t Block = 64;
+
+    void run(V *block, std::size_t n)
+    {
+        Section *s = m_sections.data();
+        std::size_t remaining = m_sections.size();
+        for (; remaining >= 4; remaining -= 4, s += 4) {
+            runGroup<4>(s, block, n);
+        }
+        if (remaining >= 2) {
+            runGroup<2>(s, block, n);
+            remaining -= 2;
+            s += 2;
+        }
+        if (remaining == 1) {
+            runGroup<1>(s, block, n);
+        }
+    }
+
+    /**\internal
+     * Runs \p K consecutive sections over the block as a pipeline: in step \c f section
+     * \c k filters frame `f - k`, which section `k - 1` filtered in the previous step.
+     * The K recursions are independent within a step, which hides the latency of each.
+     */
+    template <std::size_t K>
+    static void runGroup(Section *sections, V *block, std::size_t n)
+    {
+        Section s[K];
+        for (std::size_t k = 0; k < K; ++k) {
+            s[k] = sections[k];
+        }
+        const std::size_t steps = n + K - 1;
+        std::size_t f = 0;
+        for (; f < std::min(K - 1, steps); ++f) {  // fill the pipeline
+            for (std::size_t k = f < n ? 0 : f - n + 1; k <= f; ++k) {
+                block[f - k] = s[k].step(block[f - k]);
+            }
+        }
+        for (; f < n; ++f) {
+            for (std::size_t k = 0; k < K; ++k) {
+                block[f - k] = s[k].step(block[f - k]);
+            }
+        }
+        for (; f < steps; ++f) {  // drain it
+            for (std::size_t k = f - n + 1; k < K; ++k) {
+                block[f - k] = s[k].step(block[f - k]);
+            }
+        }
+        for (std::size_t k = 0; k < K; ++k) {
+            sections[k].z1 = s[k].z1;
+            sections[k].z2 = s[k].z2;
+        }
+    }
+
+    std::vector<Section, Vc::Allocator<Section>> m_sections;
+};
+template <typename V> constexpr std::size_t biquad_bank<V>::Block;
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_BIQUAD_H_
+
+// vim: foldmethod=marker
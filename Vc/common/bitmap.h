@@ -0,0 +1,277 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_BITMAP_H_
+#define VC_COMMON_BITMAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include "../vector.h"
+#include "bits.h"
+#include "iterators.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ *
+ * Operations on packed bitmaps as produced by Mask::storeBits, bytes::match_bits and the
+ * batched filter tests: bit \c i of a bitmap with \c n bits is bit `i % 64` of word `i /
+ * 64`, and the unused bits of the last word are clear.
+ *
+ * Predicates are evaluated one vector at a time and stored with Mask::storeBits, the
+ * bitmaps of several predicates are combined here, and the result is turned into a
+ * selection vector of row indexes for the next operator:
+ *
+ * \code
+ * std::vector<std::uint64_t> a(Vc::bitmap::words(n)), b(a.size());
+ * for (std::size_t i = 0; i < n; i += float_v::Size) {
+ *     (float_v(&price[i]) < limit).storeBits(a.data(), i);
+ *     (int_v(&qty[i]) > 0).storeBits(b.data(), i);
+ * }
+ * Vc::bitmap::bit_and(a.data(), b.data(), a.data(), n);
+ * std::vector<Vc::uint> rows(n);
+ * rows.resize(Vc::bitmap::to_selection(a.data(), n, rows.data()));
+ * \endcode
+ */
+namespace bitmap
+{
+namespace Detail
+{
+// helpers{{{1
+/**\internal
+ * The mask of the used bits of the last word of a bitmap with \p n bits.
+ */
+Vc_INTRINSIC std::uint64_t tail_mask(std::size_t n)
+{
+    return n % 64 == 0 ? ~std::uint64_t(0) : (std::uint64_t(1) << (n % 64)) - 1;
+}
+
+struct And {
+    template <typename T> Vc_INTRINSIC T operator()(const T &a, const T &b) const
+    {
+        return a & b;
+    }
+};
+struct Or {
+    template <typename T> Vc_INTRINSIC T operator()(const T &a, const T &b) const
+    {
+        return a | b;
+    }
+};
+struct AndNot {
+    template <typename T> Vc_INTRINSIC T operator()(const T &a, const T &b) const
+    {
+        return a & ~b;
+    }
+};
+
+/**\internal
+ * Applies \p op to the words of \p a and \p b. The bulk is processed as \c uint_v (two
+ * entries per word), the remaining words one at a time. \p out may alias \p a or \p b.
+ */
+template <typename Op>
+Vc_INTRINSIC void combine(const std::uint64_t *a, const std::uint64_t *b,
+                          std::uint64_t *out, std::size_t n, Op op)
+{
+    constexpr std::size_t WordsPerVector = uint_v::Size / 2;
+    const std::size_t count = (n + 63) / 64;
+    std::size_t i = 0;
+    if (WordsPerVector > 0) {
+        for (; i + WordsPerVector <= count; i += WordsPerVector) {
+            const uint_v x(reinterpret_cast<const uint *>(a + i), Vc::Unaligned);
+            const uint_v y(reinterpret_cast<const uint *>(b + i), Vc::Unaligned);
+            op(x, y).store(reinterpret_cast<uint *>(out + i), Vc::Unaligned);
+        }
+    }
+    for (; i < count; ++i) {
+        out[i] = op(a[i], b[i]);
+    }
+}
+
+/**\internal
+ * For every byte value the positions of its set bits, in ascending order.
+ */
+struct SelectionTable {
+    unsigned char index[256][8];
+    unsigned char count[256];
+
+    SelectionTable()
+    {
+        for (unsigned b = 0; b < 256; ++b) {
+            unsigned char n = 0;
+            for (unsigned char i = 0; i < 8; ++i) {
+                index[b][i] = 0;
+                if (b & (1u << i)) {
+                    index[b][n++] = i;
+                }
+            }
+            count[b] = n;
+        }
+    }
+};
+inline const SelectionTable &selection_table()
+{
+    static const SelectionTable table;
+    return table;
+}
+//}}}1
+}  // namespace Detail
+
+/// Returns the number of 64-bit words of a bitmap with \p n bits.
+constexpr std::size_t words(std::size_t n) { return (n + 63) / 64; }
+
+/// Stores `a & b` of the bitmaps \p a and \p b with \p n bits to \p out.
+inline void bit_and(const std::uint64_t *a, const std::uint64_t *b, std::uint64_t *out,
+                    std::size_t n)
+{
+    Detail::combine(a, b, out, n, Detail::And());
+}
+
+/// Stores `a | b` of the bitmaps \p a and \p b with \p n bits to \p out.
+inline void bit_or(const std::uint64_t *a, const std::uint64_t *b, std::uint64_t *out,
+                   std::size_t n)
+{
+    Detail::combine(a, b, out, n, Detail::Or());
+}
+
+/// Stores `a & ~b` of the bitmaps \p a and \p b with \p n bits to \p out.
+inline void bit_andnot(const std::uint64_t *a, const std::uint64_t *b,
+                       std::uint64_t *out, std::size_t n)
+{
+    Detail::combine(a, b, out, n, Detail::AndNot());
+}
+
+/**
+ * Returns the number of set bits among the first \p n bits of \p bits. Bits past \p n
+ * in the last word are ignored.
+ */
+inline std::size_t popcount(const std::uint64_t *bits, std::size_t n)
+{
+    constexpr std::size_t WordsPerVector = uint_v::Size / 2;
+    const std::size_t full = n / 64;
+    std::size_t total = 0;
+    std::size_t i = 0;
+    if (WordsPerVector > 0) {
+        // every lane gains at most 32 per iteration; flush before it can overflow
+        constexpr std::size_t MaxIterations = std::size_t(1) << 20;
+        while (i + WordsPerVector <= full) {
+            uint_v acc = uint_v::Zero();
+            for (std::size_t k = 0; k < MaxIterations && i + WordsPerVector <= full;
+                 ++k, i += WordsPerVector) {
+                acc += Vc::popcount(
+                    uint_v(reinterpret_cast<const uint *>(bits + i), Vc::Unaligned));
+            }
+            total += acc.sum();
+        }
+    }
+    for (; i < full; ++i) {
+        total += Vc::Detail::popcount_scalar(uint(bits[i])) +
+                 Vc::Detail::popcount_scalar(uint(bits[i] >> 32));
+    }
+    if (n % 64 != 0) {
+        const std::uint64_t w = bits[full] & Detail::tail_mask(n);
+        total += Vc::Detail::popcount_scalar(uint(w)) +
+                 Vc::Detail::popcount_scalar(uint(w >> 32));
+    }
+    return total;
+}
+
+/**
+ * Calls `f(i)` for the index \c i of every set bit among the first \p n bits, in
+ * ascending order. Zero words are skipped, the set bits of the others are visited with
+ * Common::BitmaskIterator.
+ */
+template <typename F>
+inline void for_each(const std::uint64_t *bits, std::size_t n, F &&f)
+{
+    const std::size_t count = words(n);
+    for (std::size_t w = 0; w < count; ++w) {
+        std::uint64_t word = bits[w];
+        if (w + 1 == count) {
+            word &= Detail::tail_mask(n);
+        }
+        // BitmaskIterator holds a size_t (or unsigned long), i.e. possibly 32 bits only
+        for (std::size_t half = 0; word != 0; ++half, word >>= 32) {
+            const uint m = uint(word);
+            if (m == 0) {
+                continue;
+            }
+            const std::size_t base = 64 * w + 32 * half;
+            for (Common::BitmaskIterator it(m), end(0); it != end; ++it) {
+                f(base + *it);
+            }
+        }
+    }
+}
+
+/**
+ * Writes the indexes of the set bits among the first \p n bits to \p out, in ascending
+ * order, and returns their number. \p out must have room for \p n entries.
+ *
+ * Every byte of the bitmap is expanded with a table of the bit positions of all 256
+ * byte values: a converting \c uint_v load of its eight positions, an addition of the
+ * byte's offset, and an unaligned store that advances by the number of set bits. The
+ * stores may write up to eight entries past the returned count, but never past `out +
+ * n`.
+ */
+inline std::size_t to_selection(const std::uint64_t *bits, std::size_t n, uint *out)
+{
+    const auto &table = Detail::selection_table();
+    std::size_t count = 0;
+    const std::size_t fullBytes = n / 8;
+    for (std::size_t w = 0; w * 8 < fullBytes; ++w) {
+        const std::uint64_t word = bits[w];
+        if (word == 0) {
+            continue;
+        }
+        const std::size_t bytes = fullBytes - w * 8 < 8 ? fullBytes - w * 8 : 8;
+        for (std::size_t j = 0; j < bytes; ++j) {
+            const unsigned b = (word >> (8 * j)) & 0xff;
+            const uint_v base(uint(64 * w + 8 * j));
+            for (std::size_t k = 0; k < 8; k += uint_v::Size) {
+                (uint_v(&table.index[b][k], Vc::Unaligned) + base)
+                    .store(out + count + k, Vc::Unaligned);
+            }
+            count += table.count[b];
+        }
+    }
+    for (std::size_t i = fullBytes * 8; i < n; ++i) {
+        if ((bits[i / 64] >> (i % 64)) & 1) {
+            out[count++] = uint(i);
+        }
+    }
+    return count;
+}
+//}}}1
+}  // namespace bitmap
+}  // namespace Vc
+
+#endif  // VC_COMMON_BITMAP_H_
+
+// vim: foldmethod=marker
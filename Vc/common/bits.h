@@ -0,0 +1,349 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+#ifndef VC_COMMON_BITS_H_
+#define VC_COMMON_BITS_H_
+
+#include <type_traits>
+#include "../vector.h"
+#include "../type_traits"
+#include "bitscanintrinsics.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+/**\internal
+ * Tag type for overloading on the number of bytes of a vector entry.
+ */
+template <std::size_t N> using EntrySize = std::integral_constant<std::size_t, N>;
+
+// repeatByte{{{1
+/**\internal
+ * Returns \p b repeated over all bytes of \p U, e.g. 0x55 -> 0x55555555 for uint.
+ */
+template <typename U> constexpr U repeatByte(unsigned char b)
+{
+    return static_cast<U>(static_cast<U>(~U(0)) / 0xff * b);
+}
+
+// scalar kernels{{{1
+/**\internal
+ * Per-entry kernels for VectorAbi::Scalar. They map to single instructions wherever
+ * the compiler exposes them.
+ */
+Vc_INTRINSIC uint popcount_scalar(uint x)
+{
+#if defined Vc_GCC || defined Vc_CLANG || defined Vc_APPLECLANG
+    return __builtin_popcount(x);
+#else
+    x -= (x >> 1) & 0x55555555u;
+    x = (x & 0x33333333u) + ((x >> 2) & 0x33333333u);
+    return (((x + (x >> 4)) & 0x0f0f0f0fu) * 0x01010101u) >> 24;
+#endif
+}
+Vc_INTRINSIC ushort byteswap_scalar(ushort x)
+{
+    return static_cast<ushort>((x >> 8) | (x << 8));
+}
+Vc_INTRINSIC uint byteswap_scalar(uint x)
+{
+#if defined Vc_GCC || defined Vc_CLANG || defined Vc_APPLECLANG
+    return __builtin_bswap32(x);
+#else
+    return (x >> 24) | ((x >> 8) & 0xff00u) | ((x << 8) & 0xff0000u) | (x << 24);
+#endif
+}
+
+// popcount_bytes{{{1
+/**\internal
+ * Returns the number of set bits of every byte of the unsigned vector \p x.
+ */
+template <typename V, typename Abi> Vc_INTRINSIC V popcount_bytes(V x, Abi)
+{
+    using U = typename V::EntryType;
+    x -= (x >> 1) & V(repeatByte<U>(0x55));
+    x = (x & V(repeatByte<U>(0x33))) + ((x >> 2) & V(repeatByte<U>(0x33)));
+    return (x + (x >> 4)) & V(repeatByte<U>(0x0f));
+}
+#ifdef Vc_IMPL_SSSE3
+template <typename V> Vc_INTRINSIC V popcount_bytes(V x, VectorAbi::Sse)
+{
+    return V(popcnt_epi8(x.data()));
+}
+#endif
+#ifdef Vc_IMPL_AVX2
+template <typename V> Vc_INTRINSIC V popcount_bytes(V x, VectorAbi::Avx)
+{
+    return V(popcnt_epi8(x.data()));
+}
+#endif
+
+// bitreverse_bytes{{{1
+/**\internal
+ * Reverses the bit order within every byte of the unsigned vector \p x.
+ */
+template <typename V, typename Abi> Vc_INTRINSIC V bitreverse_bytes(V x, Abi)
+{
+    using U = typename V::EntryType;
+    const V m1(repeatByte<U>(0x55)), m2(repeatByte<U>(0x33)), m4(repeatByte<U>(0x0f));
+    x = ((x >> 1) & m1) | ((x & m1) << 1);
+    x = ((x >> 2) & m2) | ((x & m2) << 2);
+    return ((x >> 4) & m4) | ((x & m4) << 4);
+}
+#ifdef Vc_IMPL_SSSE3
+template <typename V> Vc_INTRINSIC V bitreverse_bytes(V x, VectorAbi::Sse)
+{
+    return V(bitreverse_epi8(x.data()));
+}
+#endif
+#ifdef Vc_IMPL_AVX2
+template <typename V> Vc_INTRINSIC V bitreverse_bytes(V x, VectorAbi::Avx)
+{
+    return V(bitreverse_epi8(x.data()));
+}
+#endif
+
+// byteswap{{{1
+/**\internal
+ * Reverses the byte order of every entry of the unsigned vector \p x.
+ */
+template <typename V> Vc_INTRINSIC V byteswap_swar(const V &x, EntrySize<2>)
+{
+    return (x >> 8) | (x << 8);
+}
+template <typename V> Vc_INTRINSIC V byteswap_swar(const V &x, EntrySize<4>)
+{
+    const V m(0x00ff00ffu);
+    const V y = ((x >> 8) & m) | ((x & m) << 8);
+    return (y >> 16) | (y << 16);
+}
+template <typename V, typename Abi, std::size_t N>
+Vc_INTRINSIC V byteswap(const V &x, Abi, EntrySize<N> size)
+{
+    return byteswap_swar(x, size);
+}
+template <typename V, std::size_t N>
+Vc_INTRINSIC V byteswap(const V &x, VectorAbi::Scalar, EntrySize<N>)
+{
+    return V(byteswap_scalar(x.data()));
+}
+#ifdef Vc_IMPL_SSSE3
+template <typename V>
+Vc_INTRINSIC V byteswap(const V &x, VectorAbi::Sse, EntrySize<2>)
+{
+    return V(byteswap_epi16(x.data()));
+}
+template <typename V>
+Vc_INTRINSIC V byteswap(const V &x, VectorAbi::Sse, EntrySize<4>)
+{
+    return V(byteswap_epi32(x.data()));
+}
+#endif
+#ifdef Vc_IMPL_AVX2
+template <typename V>
+Vc_INTRINSIC V byteswap(const V &x, VectorAbi::Avx, EntrySize<2>)
+{
+    return V(byteswap_epi16(x.data()));
+}
+template <typename V>
+Vc_INTRINSIC V byteswap(const V &x, VectorAbi::Avx, EntrySize<4>)
+{
+    return V(byteswap_epi32(x.data()));
+}
+#endif
+
+// popcount{{{1
+/**\internal
+ * Sums the per-byte counts \p b within every entry. The result of a 16-bit entry fits
+ * into 5 bits, the one of a 32-bit entry into 6 bits.
+ */
+template <typename V> Vc_INTRINSIC V sum_bytes(const V &b, EntrySize<2>)
+{
+    return (b + (b >> 8)) & V(0x1f);
+}
+template <typename V> Vc_INTRINSIC V sum_bytes(V b, EntrySize<4>)
+{
+    b += b >> 8;
+    b += b >> 16;
+    return b & V(0x3f);
+}
+template <typename V, typename Abi, std::size_t N>
+Vc_INTRINSIC V popcount(const V &x, Abi, EntrySize<N> size)
+{
+    return sum_bytes(popcount_bytes(x, Abi()), size);
+}
+template <typename V, std::size_t N>
+Vc_INTRINSIC V popcount(const V &x, VectorAbi::Scalar, EntrySize<N>)
+{
+    return V(popcount_scalar(x.data()));
+}
+
+// countl_zero{{{1
+template <typename V, typename Abi, std::size_t N>
+Vc_INTRINSIC V countl_zero(V x, Abi, EntrySize<N> size)
+{
+    // smear the highest set bit into all lower bits, the leading zeros are what is left
+    for (std::size_t shift = 1; shift < 8 * N; shift *= 2) {
+        x |= x >> int(shift);
+    }
+    return popcount(~x, Abi(), size);
+}
+template <typename V, std::size_t N>
+Vc_INTRINSIC V countl_zero(const V &x, VectorAbi::Scalar, EntrySize<N>)
+{
+    using U = typename V::EntryType;
+    return V(x.data() == 0 ? U(8 * N) : U(8 * N - 1 - _bit_scan_reverse(x.data())));
+}
+
+// countr_zero{{{1
+template <typename V, typename Abi, std::size_t N>
+Vc_INTRINSIC V countr_zero(const V &x, Abi, EntrySize<N> size)
+{
+    // ~x & (x - 1) has exactly the trailing zeros of x set
+    return popcount(~x & (x - V(1)), Abi(), size);
+}
+template <typename V, std::size_t N>
+Vc_INTRINSIC V countr_zero(const V &x, VectorAbi::Scalar, EntrySize<N>)
+{
+    using U = typename V::EntryType;
+    return V(x.data() == 0 ? U(8 * N) : U(_bit_scan_forward(x.data())));
+}
+
+// as_unsigned{{{1
+template <typename T, typename Abi>
+using UnsignedVector = Vector<typename std::make_unsigned<T>::type, Abi>;
+
+template <typename T, typename Abi>
+Vc_INTRINSIC UnsignedVector<T, Abi> as_unsigned(const Vector<T, Abi> &x)
+{
+    return simd_cast<UnsignedVector<T, Abi>>(x);
+}
+template <typename T, typename Abi, typename U>
+Vc_INTRINSIC Vector<T, Abi> from_unsigned(const Vector<U, Abi> &x)
+{
+    return simd_cast<Vector<T, Abi>>(x);
+}
+//}}}1
+}  // namespace Detail
+
+template <typename T>
+using is_bit_manipulable =
+    std::integral_constant<bool, std::is_integral<T>::value &&
+                                     (sizeof(T) == 2 || sizeof(T) == 4)>;
+
+/**
+ * \name Per-entry bit manipulation
+ * \ingroup Utilities
+ *
+ * The counterparts of the C++20 `<bit>` functions for \c int_v, \c uint_v, \c short_v,
+ * and \c ushort_v. Every entry is treated as its unsigned bit pattern; signed vectors
+ * return the same bits reinterpreted as signed.
+ *
+ * With SSSE3 (and AVX2 for 256-bit vectors) the per-byte steps are pshufb nibble table
+ * lookups. The scalar implementation uses the popcnt/bsf/bsr/bswap instructions via the
+ * compiler builtins.
+ *
+ * \headerfile bits.h <Vc/bit>
+ */
+///@{
+/// Returns the number of set bits of every entry of \p x.
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if<is_bit_manipulable<T>::value, Vector<T, Abi>> popcount(
+    const Vector<T, Abi> &x)
+{
+    return Detail::from_unsigned<T>(Detail::popcount(
+        Detail::as_unsigned(x), Abi(), Detail::EntrySize<sizeof(T)>()));
+}
+
+/// Returns the number of consecutive zero bits of every entry of \p x, starting at the
+/// most significant bit. Zero entries yield the number of bits of \p T.
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if<is_bit_manipulable<T>::value, Vector<T, Abi>> countl_zero(
+    const Vector<T, Abi> &x)
+{
+    return Detail::from_unsigned<T>(Detail::countl_zero(
+        Detail::as_unsigned(x), Abi(), Detail::EntrySize<sizeof(T)>()));
+}
+
+/// Returns the number of consecutive zero bits of every entry of \p x, starting at the
+/// least significant bit. Zero entries yield the number of bits of \p T.
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if<is_bit_manipulable<T>::value, Vector<T, Abi>> countr_zero(
+    const Vector<T, Abi> &x)
+{
+    return Detail::from_unsigned<T>(Detail::countr_zero(
+        Detail::as_unsigned(x), Abi(), Detail::EntrySize<sizeof(T)>()));
+}
+
+/// Rotates the bits of every entry of \p x left by \p s. \p s is taken modulo the number
+/// of bits of \p T, negative values rotate right.
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if<is_bit_manipulable<T>::value, Vector<T, Abi>> rotl(
+    const Vector<T, Abi> &x, int s)
+{
+    constexpr int Bits = 8 * sizeof(T);
+    const auto u = Detail::as_unsigned(x);
+    return Detail::from_unsigned<T>((u << (s & (Bits - 1))) | (u >> (-s & (Bits - 1))));
+}
+
+/// Rotates the bits of every entry of \p x right by \p s. \p s is taken modulo the number
+/// of bits of \p T, negative values rotate left.
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if<is_bit_manipulable<T>::value, Vector<T, Abi>> rotr(
+    const Vector<T, Abi> &x, int s)
+{
+    constexpr int Bits = 8 * sizeof(T);
+    const auto u = Detail::as_unsigned(x);
+    return Detail::from_unsigned<T>((u >> (s & (Bits - 1))) | (u << (-s & (Bits - 1))));
+}
+
+/// Reverses the byte order of every entry of \p x.
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if<is_bit_manipulable<T>::value, Vector<T, Abi>> byteswap(
+    const Vector<T, Abi> &x)
+{
+    return Detail::from_unsigned<T>(Detail::byteswap(
+        Detail::as_unsigned(x), Abi(), Detail::EntrySize<sizeof(T)>()));
+}
+
+/// Reverses the bit order of every entry of \p x.
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if<is_bit_manipulable<T>::value, Vector<T, Abi>> bit_reverse(
+    const Vector<T, Abi> &x)
+{
+    const auto u = Detail::as_unsigned(x);
+    return Detail::from_unsigned<T>(
+        Detail::byteswap(Detail::bitreverse_bytes(u, Abi()), Abi(),
+                         Detail::EntrySize<sizeof(T)>()));
+}
+///@}
+}  // namespace Vc
+
+#endif  // VC_COMMON_BITS_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,307 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+#ifndef VC_COMMON_BULK_H_
+#define VC_COMMON_BULK_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include "../vector.h"
+#include "memory.h"
+#if defined __x86_64__ || defined __amd64__ || defined __amd64 || defined __x86_64 ||    \
+    defined _M_AMD64 || defined __i386__
+#include "../cpuid.h"
+#define Vc_HAVE_CPUID_ 1
+#endif
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// streaming threshold {{{1
+/**\internal
+ * Returns the size of the destination (in Bytes) above which copy, fill, and convert
+ * use streaming stores: half of the L3 cache, i.e. the point where source and destination
+ * together no longer fit. Without cache information a fixed 4 MiB is used.
+ */
+inline std::size_t default_streaming_threshold()
+{
+#ifdef Vc_HAVE_CPUID_
+    CpuId::init();
+    if (CpuId::L3Data() > 0) {
+        return CpuId::L3Data() / 2;
+    }
+    if (CpuId::L2Data() > 0) {
+        return CpuId::L2Data() / 2;
+    }
+#endif
+    return std::size_t(4) << 20;
+}
+
+inline std::size_t &streaming_threshold_storage()
+{
+    static std::size_t threshold = default_streaming_threshold();
+    return threshold;
+}
+
+// streaming_fence {{{1
+/**\internal
+ * Orders the preceding non-temporal stores before all subsequent stores, so that another
+ * thread that observes a later store also observes the streamed data.
+ */
+Vc_INTRINSIC void streaming_fence()
+{
+#ifdef Vc_IMPL_SSE
+    _mm_sfence();
+#endif
+}
+
+// sources {{{1
+/**\internal
+ * The value sources for bulk_store: `get(i)` returns the vector for the destination
+ * entries `[i, i + V::Size)`, `get(i, n)` only needs the first \p n entries to be valid,
+ * and `prefetch(i)` requests the source data a few cachelines ahead of \p i.
+ */
+template <typename V> struct BulkFill {
+    V value;
+    Vc_INTRINSIC V get(std::size_t) const { return value; }
+    Vc_INTRINSIC V get(std::size_t, std::size_t) const { return value; }
+    Vc_INTRINSIC void prefetch(std::size_t) const {}
+};
+
+template <typename V, typename From> struct BulkConvert {
+    using FromV = SimdArray<From, V::Size>;
+    const From *src;
+
+    Vc_INTRINSIC V get(std::size_t i) const
+    {
+        return simd_cast<V>(FromV(src + i, Vc::Unaligned));
+    }
+    Vc_INTRINSIC V get(std::size_t i, std::size_t n) const
+    {
+        FromV x;
+        x.load_partial(src + i, n);
+        return simd_cast<V>(x);
+    }
+    Vc_INTRINSIC void prefetch(std::size_t i) const
+    {
+        const char *addr = reinterpret_cast<const char *>(src + i) + PrefetchFlag<>::L1Stride;
+        for (std::size_t b = 0; b < V::Size * sizeof(From); b += 64) {
+            prefetchForOneRead(addr + b);
+        }
+    }
+};
+
+template <typename V> struct BulkConvert<V, typename V::EntryType> {
+    const typename V::EntryType *src;
+
+    Vc_INTRINSIC V get(std::size_t i) const { return V(src + i, Vc::Unaligned); }
+    Vc_INTRINSIC V get(std::size_t i, std::size_t n) const
+    {
+        V x;
+        x.load_partial(src + i, n);
+        return x;
+    }
+    Vc_INTRINSIC void prefetch(std::size_t i) const
+    {
+        const char *addr = reinterpret_cast<const char *>(src + i) + PrefetchFlag<>::L1Stride;
+        for (std::size_t b = 0; b < sizeof(V); b += 64) {
+            prefetchForOneRead(addr + b);
+        }
+    }
+};
+
+// bulk_store {{{1
+/**\internal
+ * Writes `src.get(i)` to `dst[0..n)`. A partial head vector aligns the destination, so
+ * that the body consists of aligned stores only. If the destination is larger than the
+ * streaming threshold, the body uses non-temporal stores, prefetches the source, and ends
+ * with a streaming_fence().
+ */
+template <typename V, typename Source>
+inline void bulk_store(typename V::EntryType *dst, std::size_t n, const Source &src)
+{
+    using T = typename V::EntryType;
+    // one cacheline of destination per iteration of the streaming loop
+    constexpr std::size_t Unroll = sizeof(V) >= 64 ? 1 : 64 / sizeof(V);
+    constexpr std::size_t Step = Unroll * V::Size;
+
+    const std::size_t misalignment =
+        reinterpret_cast<std::uintptr_t>(dst) % V::MemoryAlignment;
+    if (misalignment % sizeof(T) != 0) {
+        // dst is not even aligned on EntryType, vector alignment is unreachable
+        std::size_t i = 0;
+        for (; i + V::Size <= n; i += V::Size) {
+            src.get(i).store(dst + i, Vc::Unaligned);
+        }
+        if (i < n) {
+            src.get(i, n - i).store_partial(dst + i, n - i);
+        }
+        return;
+    }
+
+    std::size_t i = 0;
+    if (misalignment != 0) {
+        i = std::min(n, (V::MemoryAlignment - misalignment) / sizeof(T));
+        src.get(0, i).store_partial(dst, i);
+    }
+    if ((n - i) * sizeof(T) >= streaming_threshold_storage()) {
+        for (; i + Step <= n; i += Step) {
+            src.prefetch(i);
+            for (std::size_t k = 0; k < Step; k += V::Size) {
+                src.get(i + k).store(dst + i + k, Vc::Streaming);
+            }
+        }
+        for (; i + V::Size <= n; i += V::Size) {
+            src.get(i).store(dst + i, Vc::Streaming);
+        }
+        streaming_fence();
+    } else {
+        for (; i + V::Size <= n; i += V::Size) {
+            src.get(i).store(dst + i, Vc::Aligned);
+        }
+    }
+    if (i < n) {
+        src.get(i, n - i).store_partial(dst + i, n - i);
+    }
+}
+
+// scalar fallbacks {{{1
+template <typename From, typename To>
+inline void convert_impl(const From *src, To *dst, std::size_t n, std::true_type)
+{
+    bulk_store<Vector<To>>(dst, n, BulkConvert<Vector<To>, From>{src});
+}
+template <typename From, typename To>
+inline void convert_impl(const From *src, To *dst, std::size_t n, std::false_type)
+{
+    std::transform(src, src + n, dst, [](const From &x) { return static_cast<To>(x); });
+}
+
+template <typename T> inline void fill_impl(T *dst, std::size_t n, T value, std::true_type)
+{
+    bulk_store<Vector<T>>(dst, n, BulkFill<Vector<T>>{Vector<T>(value)});
+}
+template <typename T> inline void fill_impl(T *dst, std::size_t n, T value, std::false_type)
+{
+    std::fill_n(dst, n, value);
+}
+//}}}1
+}  // namespace Common
+
+/**
+ * \ingroup Utilities
+ * \headerfile bulk.h <Vc/algorithm>
+ *
+ * Returns the destination size (in Bytes) above which Vc::copy, Vc::fill, and Vc::convert
+ * switch to non-temporal (streaming) stores.
+ *
+ * The default is half of the L3 cache size as reported by CpuId::L3Data(): beyond that
+ * point the written data would evict the source (and everything else) from the cache
+ * before it is read again, while streaming stores bypass the cache and avoid the read for
+ * ownership of every destination cacheline.
+ */
+inline std::size_t streaming_threshold() { return Common::streaming_threshold_storage(); }
+
+/**
+ * \ingroup Utilities
+ * \headerfile bulk.h <Vc/algorithm>
+ *
+ * Overrides the value returned by streaming_threshold(). Use 0 to always stream and \c
+ * SIZE_MAX to never stream.
+ *
+ * \warning This function must not be called concurrently with Vc::copy, Vc::fill, or
+ * Vc::convert.
+ */
+inline void set_streaming_threshold(std::size_t bytes)
+{
+    Common::streaming_threshold_storage() = bytes;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile bulk.h <Vc/algorithm>
+ *
+ * Converts \p n values from \p src to \p dst, where every value is converted as if by
+ * simd_cast (e.g. \c double to \c float, \c float to \c int, or \c int to \c short).
+ *
+ * The first few values are converted with a partial vector such that all other stores to
+ * \p dst are aligned. Above streaming_threshold() the stores are non-temporal and the
+ * source is prefetched ahead of the loads. Types without a Vc::Vector are converted with a
+ * scalar loop.
+ *
+ * \param src The beginning of the source range. It need not be aligned.
+ * \param dst The beginning of the destination range. It must not overlap the source.
+ * \param n The number of values to convert.
+ */
+template <typename To, typename From>
+inline void convert(const From *src, To *dst, std::size_t n)
+{
+    Common::convert_impl(
+        src, dst, n,
+        std::integral_constant<bool, Traits::is_valid_vector_argument<From>::value &&
+                                         Traits::is_valid_vector_argument<To>::value>());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile bulk.h <Vc/algorithm>
+ *
+ * Copies \p n values from \p src to \p dst, like `std::memcpy`, but switches to
+ * non-temporal stores above streaming_threshold().
+ *
+ * \param src The beginning of the source range. It need not be aligned.
+ * \param dst The beginning of the destination range. It must not overlap the source.
+ * \param n The number of values to copy.
+ *
+ * \see convert
+ */
+template <typename T> inline void copy(const T *src, T *dst, std::size_t n)
+{
+    Vc::convert(src, dst, n);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile bulk.h <Vc/algorithm>
+ *
+ * Assigns \p value to the \p n values starting at \p dst, switching to non-temporal stores
+ * above streaming_threshold().
+ */
+template <typename T, typename U> inline void fill(T *dst, std::size_t n, const U &value)
+{
+    Common::fill_impl(dst, n, static_cast<T>(value),
+                      Traits::is_valid_vector_argument<T>());
+}
+}  // namespace Vc
+
+#undef Vc_HAVE_CPUID_
+
+#endif  // VC_COMMON_BULK_H_
+
+// vim: foldmethod=marker
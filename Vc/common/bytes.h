@@ -0,0 +1,552 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_BYTES_H_
+#define VC_COMMON_BYTES_H_
+
+#include <cstdint>
+#include <cstring>
+#include "../global.h"
+#include "bitscanintrinsics.h"
+#include "macros.h"
+#ifdef Vc_IMPL_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef Vc_IMPL_AVX2
+#include <immintrin.h>
+#endif
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ *
+ * Kernels for scanning and transforming byte strings (logs, CSV, JSON).
+ *
+ * Vc::Vector has no 8-bit entry types on x86, therefore these kernels work on blocks of
+ * 16 (SSE) or 32 (AVX2) bytes directly and turn comparison results into bitmasks, in the
+ * same way Mask::toInt() and Mask::firstOne() are used for the wider types. With the
+ * Scalar implementation all functions use plain loops.
+ */
+namespace bytes
+{
+/**
+ * A set of distinct byte values, e.g. the delimiters of a CSV dialect or the structural
+ * characters of JSON.
+ *
+ * Sets of up to \ref Capacity members are matched with one vector compare per member.
+ * Larger sets are supported, but the kernels then fall back to a scalar table lookup.
+ */
+class byte_set
+{
+public:
+    static constexpr std::size_t Capacity = 16;
+
+    /// Creates the set of all bytes in the NUL-terminated string \p chars.
+    byte_set(const char *chars) : byte_set(chars, std::strlen(chars)) {}
+
+    /// Creates the set of the \p n bytes at \p chars (which may include NUL).
+    byte_set(const char *chars, std::size_t n)
+    {
+        std::memset(m_table, 0, sizeof(m_table));
+        for (std::size_t i = 0; i < n; ++i) {
+            insert(chars[i]);
+        }
+    }
+
+    /// Returns the number of distinct bytes in the set.
+    std::size_t size() const { return m_size; }
+    /// Returns whether the set is small enough for the vectorized kernels.
+    bool is_small() const { return m_size <= Capacity; }
+    /// Returns the \p i-th byte of the set, for `i < min(size(), Capacity)`.
+    char operator[](std::size_t i) const
+    {
+        Vc_ASSERT(i < m_size && i < Capacity);
+        return m_chars[i];
+    }
+    /// Returns whether \p c is a member of the set.
+    bool contains(char c) const
+    {
+        const unsigned char u = c;
+        return (m_table[u / 64] >> (u % 64)) & 1;
+    }
+
+private:
+    void insert(char c)
+    {
+        if (contains(c)) {
+            return;
+        }
+        const unsigned char u = c;
+        m_table[u / 64] |= std::uint64_t(1) << (u % 64);
+        if (m_size < Capacity) {
+            m_chars[m_size] = c;
+        }
+        ++m_size;
+    }
+
+    char m_chars[Capacity] = {};
+    std::size_t m_size = 0;
+    std::uint64_t m_table[4];
+};
+
+namespace Detail
+{
+// scalar kernels {{{1
+inline const char *find_scalar(const char *first, const char *last, char c)
+{
+    for (; first != last && *first != c; ++first) {
+    }
+    return first;
+}
+
+inline const char *find_first_of_scalar(const char *first, const char *last,
+                                        const byte_set &set)
+{
+    for (; first != last && !set.contains(*first); ++first) {
+    }
+    return first;
+}
+
+inline std::size_t count_scalar(const char *first, const char *last, char c)
+{
+    std::size_t n = 0;
+    for (; first != last; ++first) {
+        n += *first == c ? 1 : 0;
+    }
+    return n;
+}
+
+/**\internal
+ * Sets bit `i % 64` of `bits[i / 64]` for every byte at offset \p i in \p set. \p offset is
+ * the bit position of \p first inside `bits[0]`.
+ */
+inline void match_bits_scalar(const char *first, const char *last, const byte_set &set,
+                              std::uint64_t *bits, std::size_t offset = 0)
+{
+    for (std::size_t i = offset; first != last; ++first, ++i) {
+        if (i % 64 == 0) {
+            bits[i / 64] = 0;
+        }
+        if (set.contains(*first)) {
+            bits[i / 64] |= std::uint64_t(1) << (i % 64);
+        }
+    }
+}
+
+/**\internal
+ * Validates UTF-8 (RFC 3629: no overlong encodings, no surrogates, nothing above
+ * U+10FFFF) starting at \p p. Returns a pointer past the last valid sequence that was
+ * checked, which is \p last on success. Returns \c nullptr on an encoding error. If \p
+ * stopAtAscii is set, the function returns as soon as it reaches an ASCII byte, so that the
+ * caller can continue with its vectorized ASCII scan.
+ */
+inline const char *validate_utf8_scalar(const char *p, const char *last, bool stopAtAscii)
+{
+    while (p != last) {
+        const unsigned char c = *p;
+        if (c < 0x80) {
+            if (stopAtAscii) {
+                return p;
+            }
+            ++p;
+            continue;
+        }
+        std::size_t len;
+        unsigned char lo = 0x80, hi = 0xbf;  // valid range of the second byte
+        if (c >= 0xc2 && c <= 0xdf) {
+            len = 2;
+        } else if (c >= 0xe0 && c <= 0xef) {
+            len = 3;
+            lo = c == 0xe0 ? 0xa0 : 0x80;  // overlong
+            hi = c == 0xed ? 0x9f : 0xbf;  // surrogates
+        } else if (c >= 0xf0 && c <= 0xf4) {
+            len = 4;
+            lo = c == 0xf0 ? 0x90 : 0x80;  // overlong
+            hi = c == 0xf4 ? 0x8f : 0xbf;  // > U+10FFFF
+        } else {
+            return nullptr;
+        }
+        if (std::size_t(last - p) < len) {
+            return nullptr;
+        }
+        const unsigned char c1 = p[1];
+        if (c1 < lo || c1 > hi) {
+            return nullptr;
+        }
+        for (std::size_t i = 2; i < len; ++i) {
+            if ((static_cast<unsigned char>(p[i]) & 0xc0) != 0x80) {
+                return nullptr;
+            }
+        }
+        p += len;
+    }
+    return p;
+}
+
+template <bool Upper> inline void convert_case_scalar(const char *first, const char *last, char *out)
+{
+    for (; first != last; ++first, ++out) {
+        const char c = *first;
+        const bool convert = Upper ? (c >= 'a' && c <= 'z') : (c >= 'A' && c <= 'Z');
+        *out = convert ? static_cast<char>(c ^ 0x20) : c;
+    }
+}
+
+#if defined Vc_IMPL_AVX2 || defined Vc_IMPL_SSE2
+// ByteBlock {{{1
+/**\internal
+ * Thin wrapper around one SSE or AVX2 register of bytes. Comparisons return the
+ * per-byte results as a bitmask (one bit per byte, like Mask::toInt()).
+ */
+struct ByteBlock {
+#ifdef Vc_IMPL_AVX2
+    using Register = __m256i;
+    static constexpr std::size_t Size = 32;
+    Register d;
+
+    static Vc_INTRINSIC ByteBlock load(const char *p)
+    {
+        return {_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p))};
+    }
+    Vc_INTRINSIC void store(char *p) const
+    {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), d);
+    }
+    static Vc_INTRINSIC ByteBlock broadcast(char c) { return {_mm256_set1_epi8(c)}; }
+    static Vc_INTRINSIC ByteBlock zero() { return {_mm256_setzero_si256()}; }
+    /// 0xff where equal
+    Vc_INTRINSIC ByteBlock operator==(ByteBlock b) const
+    {
+        return {_mm256_cmpeq_epi8(d, b.d)};
+    }
+    /// 0xff where greater (signed)
+    Vc_INTRINSIC ByteBlock operator>(ByteBlock b) const
+    {
+        return {_mm256_cmpgt_epi8(d, b.d)};
+    }
+    Vc_INTRINSIC ByteBlock operator|(ByteBlock b) const { return {_mm256_or_si256(d, b.d)}; }
+    Vc_INTRINSIC ByteBlock operator&(ByteBlock b) const { return {_mm256_and_si256(d, b.d)}; }
+    Vc_INTRINSIC ByteBlock operator^(ByteBlock b) const { return {_mm256_xor_si256(d, b.d)}; }
+    Vc_INTRINSIC ByteBlock operator-(ByteBlock b) const { return {_mm256_sub_epi8(d, b.d)}; }
+    /// The most significant bit of every byte.
+    Vc_INTRINSIC std::uint32_t bits() const { return _mm256_movemask_epi8(d); }
+    /// Sums the unsigned bytes into one integer.
+    Vc_INTRINSIC std::uint64_t sum() const
+    {
+        const __m256i s = _mm256_sad_epu8(d, _mm256_setzero_si256());
+        return std::uint64_t(_mm256_extract_epi64(s, 0)) + _mm256_extract_epi64(s, 1) +
+               _mm256_extract_epi64(s, 2) + _mm256_extract_epi64(s, 3);
+    }
+#else
+    using Register = __m128i;
+    static constexpr std::size_t Size = 16;
+    Register d;
+
+    static Vc_INTRINSIC ByteBlock load(const char *p)
+    {
+        return {_mm_loadu_si128(reinterpret_cast<const __m128i *>(p))};
+    }
+    Vc_INTRINSIC void store(char *p) const
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(p), d);
+    }
+    static Vc_INTRINSIC ByteBlock broadcast(char c) { return {_mm_set1_epi8(c)}; }
+    static Vc_INTRINSIC ByteBlock zero() { return {_mm_setzero_si128()}; }
+    Vc_INTRINSIC ByteBlock operator==(ByteBlock b) const { return {_mm_cmpeq_epi8(d, b.d)}; }
+    Vc_INTRINSIC ByteBlock operator>(ByteBlock b) const { return {_mm_cmpgt_epi8(d, b.d)}; }
+    Vc_INTRINSIC ByteBlock operator|(ByteBlock b) const { return {_mm_or_si128(d, b.d)}; }
+    Vc_INTRINSIC ByteBlock operator&(ByteBlock b) const { return {_mm_and_si128(d, b.d)}; }
+    Vc_INTRINSIC ByteBlock operator^(ByteBlock b) const { return {_mm_xor_si128(d, b.d)}; }
+    Vc_INTRINSIC ByteBlock operator-(ByteBlock b) const { return {_mm_sub_epi8(d, b.d)}; }
+    Vc_INTRINSIC std::uint32_t bits() const { return _mm_movemask_epi8(d); }
+    Vc_INTRINSIC std::uint64_t sum() const
+    {
+        const __m128i s = _mm_sad_epu8(d, _mm_setzero_si128());
+        return std::uint64_t(_mm_cvtsi128_si32(s)) +
+               std::uint64_t(_mm_cvtsi128_si32(_mm_unpackhi_epi64(s, s)));
+    }
+#endif
+};
+
+/**\internal
+ * The members of a byte_set broadcast to ByteBlocks, so that testing a block for
+ * membership is one compare per member.
+ */
+struct BroadcastSet {
+    ByteBlock members[byte_set::Capacity];
+    std::size_t size;
+
+    explicit BroadcastSet(const byte_set &set) : size(set.size())
+    {
+        Vc_ASSERT(set.is_small());
+        for (std::size_t i = 0; i < size; ++i) {
+            members[i] = ByteBlock::broadcast(set[i]);
+        }
+    }
+
+    /// 0xff where \p x holds a member of the set
+    Vc_INTRINSIC ByteBlock match(ByteBlock x) const
+    {
+        ByteBlock r = ByteBlock::zero();
+        for (std::size_t i = 0; i < size; ++i) {
+            r = r | (x == members[i]);
+        }
+        return r;
+    }
+};
+
+// vectorized kernels {{{1
+/**\internal
+ * Returns the first byte for which \p match yields 0xff. Four blocks are tested per
+ * iteration with a single movemask, so that the loop is bound by the loads. Returns the
+ * start of the unprocessed tail (less than one block) if nothing was found.
+ */
+template <typename Match>
+Vc_INTRINSIC const char *find_block_impl(const char *first, const char *last,
+                                         const Match &match)
+{
+    constexpr std::size_t N = ByteBlock::Size;
+    for (; std::size_t(last - first) >= 4 * N; first += 4 * N) {
+        const ByteBlock m0 = match(ByteBlock::load(first));
+        const ByteBlock m1 = match(ByteBlock::load(first + N));
+        const ByteBlock m2 = match(ByteBlock::load(first + 2 * N));
+        const ByteBlock m3 = match(ByteBlock::load(first + 3 * N));
+        if (Vc_IS_UNLIKELY(((m0 | m1) | (m2 | m3)).bits() != 0)) {
+            break;
+        }
+    }
+    for (; std::size_t(last - first) >= N; first += N) {
+        const std::uint32_t m = match(ByteBlock::load(first)).bits();
+        if (m != 0) {
+            return first + _bit_scan_forward(m);
+        }
+    }
+    return first;
+}
+
+inline const char *find_simd(const char *first, const char *last, char c)
+{
+    const ByteBlock c_v = ByteBlock::broadcast(c);
+    first = find_block_impl(first, last, [&](ByteBlock x) { return x == c_v; });
+    return find_scalar(first, last, c);
+}
+
+inline const char *find_first_of_simd(const char *first, const char *last,
+                                      const byte_set &set)
+{
+    if (!set.is_small()) {
+        return find_first_of_scalar(first, last, set);
+    }
+    const BroadcastSet members(set);
+    first = find_block_impl(first, last, [&](ByteBlock x) { return members.match(x); });
+    return find_first_of_scalar(first, last, set);
+}
+
+inline std::size_t count_simd(const char *first, const char *last, char c)
+{
+    constexpr std::size_t N = ByteBlock::Size;
+    const ByteBlock c_v = ByteBlock::broadcast(c);
+    std::size_t n = 0;
+    while (std::size_t(last - first) >= N) {
+        // the byte counters are incremented by subtracting the -1 of every match; they
+        // must be flushed before they can overflow
+        ByteBlock counters = ByteBlock::zero();
+        for (int i = 0; i < 255 && std::size_t(last - first) >= N; ++i, first += N) {
+            counters = counters - (ByteBlock::load(first) == c_v);
+        }
+        n += counters.sum();
+    }
+    return n + count_scalar(first, last, c);
+}
+
+inline void match_bits_simd(const char *first, const char *last, const byte_set &set,
+                            std::uint64_t *bits)
+{
+    constexpr std::size_t N = ByteBlock::Size;
+    if (!set.is_small()) {
+        match_bits_scalar(first, last, set, bits);
+        return;
+    }
+    const BroadcastSet members(set);
+    for (; last - first >= 64; first += 64, ++bits) {
+        std::uint64_t m = 0;
+        for (std::size_t i = 0; i < 64; i += N) {
+            m |= std::uint64_t(members.match(ByteBlock::load(first + i)).bits()) << i;
+        }
+        *bits = m;
+    }
+    match_bits_scalar(first, last, set, bits);
+}
+
+inline bool validate_utf8_simd(const char *first, const char *last)
+{
+    constexpr std::size_t N = ByteBlock::Size;
+    while (first != last) {
+        // skip ASCII blocks; the sign bit of every byte is set for non-ASCII
+        for (; std::size_t(last - first) >= N; first += N) {
+            const std::uint32_t m = ByteBlock::load(first).bits();
+            if (m != 0) {
+                first += _bit_scan_forward(m);
+                break;
+            }
+        }
+        first = validate_utf8_scalar(first, last, std::size_t(last - first) >= N);
+        if (!first) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template <bool Upper>
+inline void convert_case_simd(const char *first, const char *last, char *out)
+{
+    constexpr std::size_t N = ByteBlock::Size;
+    // signed compares: bytes >= 0x80 are negative and thus never in range
+    const ByteBlock lo = ByteBlock::broadcast(Upper ? 'a' - 1 : 'A' - 1);
+    const ByteBlock hi = ByteBlock::broadcast(Upper ? 'z' + 1 : 'Z' + 1);
+    const ByteBlock flip = ByteBlock::broadcast(0x20);
+    for (; std::size_t(last - first) >= N; first += N, out += N) {
+        const ByteBlock x = ByteBlock::load(first);
+        (x ^ ((x > lo) & (hi > x) & flip)).store(out);
+    }
+    convert_case_scalar<Upper>(first, last, out);
+}
+#endif  // Vc_IMPL_AVX2 || Vc_IMPL_SSE2
+// }}}1
+}  // namespace Detail
+
+/**
+ * Returns a pointer to the first byte equal to \p c in `[first, last)`, or \p last.
+ */
+inline const char *find(const char *first, const char *last, char c)
+{
+#ifdef Vc_IMPL_SSE2
+    return Detail::find_simd(first, last, c);
+#else
+    return Detail::find_scalar(first, last, c);
+#endif
+}
+
+/**
+ * Returns a pointer to the first byte in `[first, last)` that is a member of \p set, or
+ * \p last. This is the kernel for splitting records at any of several delimiters.
+ *
+ * \code
+ * const Vc::bytes::byte_set delimiters(",\n\"");
+ * const char *end = Vc::bytes::find_first_of(line, lineEnd, delimiters);
+ * \endcode
+ */
+inline const char *find_first_of(const char *first, const char *last, const byte_set &set)
+{
+#ifdef Vc_IMPL_SSE2
+    return Detail::find_first_of_simd(first, last, set);
+#else
+    return Detail::find_first_of_scalar(first, last, set);
+#endif
+}
+
+/**
+ * Returns the number of bytes equal to \p c in `[first, last)`, e.g. the number of
+ * lines with `c = '\n'`.
+ */
+inline std::size_t count(const char *first, const char *last, char c)
+{
+#ifdef Vc_IMPL_SSE2
+    return Detail::count_simd(first, last, c);
+#else
+    return Detail::count_scalar(first, last, c);
+#endif
+}
+
+/**
+ * Classifies every byte of `[first, last)` against \p set and stores the result as a
+ * bitmap: bit `i % 64` of `bits[i / 64]` is set iff `first[i]` is a member of \p set.
+ * \p bits must have room for `(last - first + 63) / 64` words. Unused bits of the last
+ * word are zero.
+ *
+ * Calling this with the structural characters `"{}[]:,"`, the quote and the backslash of
+ * JSON yields the bitmaps that a stage-1 JSON parser combines with bit operations.
+ */
+inline void match_bits(const char *first, const char *last, const byte_set &set,
+                       std::uint64_t *bits)
+{
+#ifdef Vc_IMPL_SSE2
+    Detail::match_bits_simd(first, last, set, bits);
+#else
+    Detail::match_bits_scalar(first, last, set, bits);
+#endif
+}
+
+/**
+ * Returns whether `[first, last)` is valid UTF-8 according to RFC 3629.
+ *
+ * ASCII runs are skipped a whole block at a time. Multi-byte sequences are validated
+ * with a scalar decoder until the next ASCII byte, so mostly-ASCII input (logs, CSV)
+ * runs at close to the speed of a plain scan.
+ */
+inline bool validate_utf8(const char *first, const char *last)
+{
+#ifdef Vc_IMPL_SSE2
+    return Detail::validate_utf8_simd(first, last);
+#else
+    return Detail::validate_utf8_scalar(first, last, false) != nullptr;
+#endif
+}
+
+/**
+ * Writes `[first, last)` to \p out with the ASCII letters `A-Z` converted to lower case.
+ * All other bytes are copied unchanged. \p out may equal \p first.
+ */
+inline void to_lower(const char *first, const char *last, char *out)
+{
+#ifdef Vc_IMPL_SSE2
+    Detail::convert_case_simd<false>(first, last, out);
+#else
+    Detail::convert_case_scalar<false>(first, last, out);
+#endif
+}
+
+/**
+ * Writes `[first, last)` to \p out with the ASCII letters `a-z` converted to upper case.
+ * All other bytes are copied unchanged. \p out may equal \p first.
+ */
+inline void to_upper(const char *first, const char *last, char *out)
+{
+#ifdef Vc_IMPL_SSE2
+    Detail::convert_case_simd<true>(first, last, out);
+#else
+    Detail::convert_case_scalar<true>(first, last, out);
+#endif
+}
+}  // namespace bytes
+}  // namespace Vc
+
+#endif  // VC_COMMON_BYTES_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,396 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+#ifndef VC_COMMON_CHECKSUM_H_
+#define VC_COMMON_CHECKSUM_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include "../vector.h"
+#if (defined __x86_64__ || defined __amd64__ || defined _M_AMD64) &&                     \
+    (defined Vc_GCC || defined Vc_CLANG || defined Vc_APPLECLANG || defined Vc_MSVC)
+#include "../cpuid.h"
+#include <nmmintrin.h>
+#include <wmmintrin.h>
+#define Vc_CHECKSUM_X86_64_ 1
+#if defined Vc_MSVC
+#define Vc_TARGET_SSE42_
+#define Vc_TARGET_PCLMUL_
+#else
+#define Vc_TARGET_SSE42_ __attribute__((target("sse4.2")))
+#define Vc_TARGET_PCLMUL_ __attribute__((target("sse4.2,pclmul")))
+#endif
+#endif
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ *
+ * Checksums of contiguous buffers, compatible with the usual reference implementations
+ * (the same results as zlib's adler32, the iSCSI/SSE4.2 CRC-32C, and XXH64).
+ *
+ * The instructions used for CRC-32C are selected at runtime: PCLMULQDQ folding of four
+ * independent 128-bit streams, the SSE4.2 crc32 instruction for short buffers and the
+ * final reduction, or a table-driven implementation on CPUs that lack them. Adler-32 is
+ * computed in \c uint_v lanes, and XXH64 uses its four independent 64-bit stripes.
+ */
+namespace checksum
+{
+namespace Detail
+{
+// loads{{{1
+Vc_INTRINSIC std::uint32_t load32(const unsigned char *p)
+{
+    return std::uint32_t(p[0]) | std::uint32_t(p[1]) << 8 | std::uint32_t(p[2]) << 16 |
+           std::uint32_t(p[3]) << 24;
+}
+Vc_INTRINSIC std::uint64_t load64(const unsigned char *p)
+{
+    return load32(p) | std::uint64_t(load32(p + 4)) << 32;
+}
+
+// crc32c, table driven{{{1
+/**\internal
+ * Slicing-by-8 tables for the reflected CRC-32C polynomial 0x82f63b78.
+ */
+struct Crc32cTables {
+    std::uint32_t t[8][256];
+
+    Crc32cTables()
+    {
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            std::uint32_t c = i;
+            for (int b = 0; b < 8; ++b) {
+                c = (c >> 1) ^ (0x82f63b78u & (0u - (c & 1u)));
+            }
+            t[0][i] = c;
+        }
+        for (std::uint32_t i = 0; i < 256; ++i) {
+            for (int k = 1; k < 8; ++k) {
+                t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xff];
+            }
+        }
+    }
+};
+
+inline const Crc32cTables &crc32cTables()
+{
+    static const Crc32cTables tables;
+    return tables;
+}
+
+/**\internal
+ * Advances the (non-inverted) CRC state \p crc by \p n bytes at \p p, eight bytes per
+ * step.
+ */
+inline std::uint32_t crc32c_table(std::uint32_t crc, const unsigned char *p,
+                                  std::size_t n)
+{
+    const auto &t = crc32cTables().t;
+    for (; n >= 8; n -= 8, p += 8) {
+        const std::uint32_t lo = load32(p) ^ crc;
+        const std::uint32_t hi = load32(p + 4);
+        crc = t[7][lo & 0xff] ^ t[6][(lo >> 8) & 0xff] ^ t[5][(lo >> 16) & 0xff] ^
+              t[4][lo >> 24] ^ t[3][hi & 0xff] ^ t[2][(hi >> 8) & 0xff] ^
+              t[1][(hi >> 16) & 0xff] ^ t[0][hi >> 24];
+    }
+    for (; n > 0; --n, ++p) {
+        crc = (crc >> 8) ^ t[0][(crc ^ *p) & 0xff];
+    }
+    return crc;
+}
+
+#ifdef Vc_CHECKSUM_X86_64_
+// crc32c, SSE4.2{{{1
+Vc_TARGET_SSE42_ inline std::uint32_t crc32c_sse42(std::uint32_t crc,
+                                                   const unsigned char *p, std::size_t n)
+{
+    std::uint64_t c = crc;
+    for (; n >= 8; n -= 8, p += 8) {
+        c = _mm_crc32_u64(c, load64(p));
+    }
+    crc = static_cast<std::uint32_t>(c);
+    for (; n > 0; --n, ++p) {
+        crc = _mm_crc32_u8(crc, *p);
+    }
+    return crc;
+}
+
+// crc32c, PCLMULQDQ folding{{{1
+/**\internal
+ * Multiplies the two halves of \p x by the constants in \p k and adds the products, which
+ * moves \p x forward in the message by the distance \p k was computed for.
+ *
+ * The constants are `reflect32(x^n mod P) << 1`, with n = D + 32 for the low half and
+ * n = D - 32 for the high half, when folding over a distance of D bits.
+ */
+Vc_TARGET_PCLMUL_ inline __m128i crc32c_fold(__m128i x, __m128i k)
+{
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00),
+                         _mm_clmulepi64_si128(x, k, 0x11));
+}
+
+/**\internal
+ * Folds four 16-byte accumulators over 64-byte strides. The remaining 128 bits are
+ * congruent to the whole message (modulo P), so the crc32 instruction computes the final
+ * remainder from them.
+ */
+Vc_TARGET_PCLMUL_ inline std::uint32_t crc32c_pclmul(std::uint32_t crc,
+                                                     const unsigned char *p,
+                                                     std::size_t n)
+{
+    if (n < 128) {
+        return crc32c_sse42(crc, p, n);
+    }
+    const auto load = [](const unsigned char *q) {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i *>(q));
+    };
+    __m128i x0 = _mm_xor_si128(load(p), _mm_cvtsi32_si128(crc));
+    __m128i x1 = load(p + 16);
+    __m128i x2 = load(p + 32);
+    __m128i x3 = load(p + 48);
+    p += 64;
+    n -= 64;
+    const __m128i k512 = _mm_set_epi64x(0x9e4addf8, 0x740eef02);
+    for (; n >= 64; n -= 64, p += 64) {
+        x0 = _mm_xor_si128(crc32c_fold(x0, k512), load(p));
+        x1 = _mm_xor_si128(crc32c_fold(x1, k512), load(p + 16));
+        x2 = _mm_xor_si128(crc32c_fold(x2, k512), load(p + 32));
+        x3 = _mm_xor_si128(crc32c_fold(x3, k512), load(p + 48));
+    }
+    const __m128i k128 = _mm_set_epi64x(0x14cd00bd6, 0xf20c0dfe);
+    __m128i x = _mm_xor_si128(crc32c_fold(x0, k128), x1);
+    x = _mm_xor_si128(crc32c_fold(x, k128), x2);
+    x = _mm_xor_si128(crc32c_fold(x, k128), x3);
+    for (; n >= 16; n -= 16, p += 16) {
+        x = _mm_xor_si128(crc32c_fold(x, k128), load(p));
+    }
+    std::uint64_t c = _mm_crc32_u64(0, _mm_cvtsi128_si64(x));
+    c = _mm_crc32_u64(c, _mm_extract_epi64(x, 1));
+    return crc32c_sse42(static_cast<std::uint32_t>(c), p, n);
+}
+
+// crc32c dispatch{{{1
+enum class Crc32cImpl { Table, Sse42, Pclmul };
+
+inline Crc32cImpl crc32c_detect()
+{
+    CpuId::init();
+    if (!CpuId::hasSse42()) {
+        return Crc32cImpl::Table;
+    }
+    return CpuId::hasPclmulqdq() ? Crc32cImpl::Pclmul : Crc32cImpl::Sse42;
+}
+#endif  // Vc_CHECKSUM_X86_64_
+
+inline std::uint32_t crc32c_update(std::uint32_t crc, const unsigned char *p,
+                                   std::size_t n)
+{
+#ifdef Vc_CHECKSUM_X86_64_
+    static const Crc32cImpl impl = crc32c_detect();
+    switch (impl) {
+    case Crc32cImpl::Pclmul:
+        return crc32c_pclmul(crc, p, n);
+    case Crc32cImpl::Sse42:
+        return crc32c_sse42(crc, p, n);
+    case Crc32cImpl::Table:
+        break;
+    }
+#endif
+    return crc32c_table(crc, p, n);
+}
+
+// adler32{{{1
+constexpr std::uint32_t AdlerBase = 65521;
+// the largest n such that 255 n (n + 1) / 2 + (n + 1) (AdlerBase - 1) fits into 32 bits
+constexpr std::size_t AdlerNMax = 5552;
+
+inline void adler32_scalar(std::uint32_t &s1, std::uint32_t &s2, const unsigned char *p,
+                           std::size_t n)
+{
+    while (n > 0) {
+        const std::size_t block = n < AdlerNMax ? n : AdlerNMax;
+        n -= block;
+        for (std::size_t i = 0; i < block; ++i) {
+            s1 += p[i];
+            s2 += s1;
+        }
+        p += block;
+        s1 %= AdlerBase;
+        s2 %= AdlerBase;
+    }
+}
+
+/**\internal
+ * Splits the buffer into \c uint_v::Size interleaved streams: lane i sums the bytes at
+ * offsets i, i + W, i + 2W, ... into \c s1 and the running sums into \c s2. Combining
+ * the lanes at the end of a block weighs every byte by its distance to the end of the
+ * block, as the sequential definition does.
+ */
+inline void adler32_vector(std::uint32_t &s1, std::uint32_t &s2, const unsigned char *&p,
+                           std::size_t &n)
+{
+    constexpr std::size_t W = uint_v::Size;
+    // the per-lane s2 of 4 * MaxIterations bytes stays below 2^32
+    constexpr std::size_t MaxIterations = 1024;
+    while (n >= 4 * W) {
+        std::size_t iterations = n / (4 * W);
+        iterations = iterations < MaxIterations ? iterations : MaxIterations;
+        uint_v vs1 = uint_v::Zero();
+        uint_v vs2 = uint_v::Zero();
+        for (std::size_t i = 0; i < iterations; ++i, p += 4 * W) {
+            const uint_v c0(p, Vc::Unaligned);
+            const uint_v c1(p + W, Vc::Unaligned);
+            const uint_v c2(p + 2 * W, Vc::Unaligned);
+            const uint_v c3(p + 3 * W, Vc::Unaligned);
+            vs2 += (vs1 << 2) + (c0 << 1) + c0 + (c1 << 1) + c2;
+            vs1 += (c0 + c1) + (c2 + c3);
+        }
+        const std::uint64_t bytes = iterations * 4 * W;
+        // the lanes of vs2 may add up to more than 32 bits
+        std::uint64_t sum2 = 0;
+        for (std::size_t i = 0; i < W; ++i) {
+            sum2 += vs2[i];
+        }
+        const std::uint64_t weighted =
+            ((uint_v(uint(W)) - uint_v::IndexesFromZero()) * vs1).sum();
+        s2 = static_cast<std::uint32_t>((s2 + bytes * s1 + W * sum2 + weighted) %
+                                        AdlerBase);
+        s1 = static_cast<std::uint32_t>((s1 + std::uint64_t(vs1.sum())) % AdlerBase);
+        n -= bytes;
+    }
+}
+
+// xxh64{{{1
+constexpr std::uint64_t XXH64Prime1 = 0x9e3779b185ebca87ull;
+constexpr std::uint64_t XXH64Prime2 = 0xc2b2ae3d27d4eb4full;
+constexpr std::uint64_t XXH64Prime3 = 0x165667b19e3779f9ull;
+constexpr std::uint64_t XXH64Prime4 = 0x85ebca77c2b2ae63ull;
+constexpr std::uint64_t XXH64Prime5 = 0x27d4eb2f165667c5ull;
+
+Vc_INTRINSIC std::uint64_t rotl64(std::uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+Vc_INTRINSIC std::uint64_t xxh64_round(std::uint64_t acc, std::uint64_t input)
+{
+    return rotl64(acc + input * XXH64Prime2, 31) * XXH64Prime1;
+}
+
+Vc_INTRINSIC std::uint64_t xxh64_merge(std::uint64_t h, std::uint64_t acc)
+{
+    return (h ^ xxh64_round(0, acc)) * XXH64Prime1 + XXH64Prime4;
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * Returns the CRC-32C (Castagnoli) of the \p n bytes at \p data. Pass the result of a
+ * previous call as \p crc to continue a checksum over several buffers.
+ */
+inline std::uint32_t crc32c(const void *data, std::size_t n, std::uint32_t crc = 0)
+{
+    return ~Detail::crc32c_update(~crc, static_cast<const unsigned char *>(data), n);
+}
+
+/**
+ * Returns the Adler-32 checksum of the \p n bytes at \p data. Pass the result of a
+ * previous call as \p adler to continue a checksum over several buffers.
+ */
+inline std::uint32_t adler32(const void *data, std::size_t n, std::uint32_t adler = 1)
+{
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+    std::uint32_t s1 = adler & 0xffff;
+    std::uint32_t s2 = adler >> 16;
+    if (uint_v::Size > 1) {
+        Detail::adler32_vector(s1, s2, p, n);
+    }
+    Detail::adler32_scalar(s1, s2, p, n);
+    return s2 << 16 | s1;
+}
+
+/**
+ * Returns the 64-bit xxHash (XXH64) of the \p n bytes at \p data.
+ *
+ * Vc has no vectors of 64-bit integers (and SSE/AVX2 no 64-bit multiplication), therefore
+ * the four 64-bit stripes of the algorithm are independent scalar dependency chains.
+ */
+inline std::uint64_t xxh64(const void *data, std::size_t n, std::uint64_t seed = 0)
+{
+    using namespace Detail;
+    const unsigned char *p = static_cast<const unsigned char *>(data);
+    const unsigned char *const end = p + n;
+    std::uint64_t h;
+    if (n >= 32) {
+        std::uint64_t v1 = seed + XXH64Prime1 + XXH64Prime2;
+        std::uint64_t v2 = seed + XXH64Prime2;
+        std::uint64_t v3 = seed;
+        std::uint64_t v4 = seed - XXH64Prime1;
+        for (; end - p >= 32; p += 32) {
+            v1 = xxh64_round(v1, load64(p));
+            v2 = xxh64_round(v2, load64(p + 8));
+            v3 = xxh64_round(v3, load64(p + 16));
+            v4 = xxh64_round(v4, load64(p + 24));
+        }
+        h = rotl64(v1, 1) + rotl64(v2, 7) + rotl64(v3, 12) + rotl64(v4, 18);
+        h = xxh64_merge(h, v1);
+        h = xxh64_merge(h, v2);
+        h = xxh64_merge(h, v3);
+        h = xxh64_merge(h, v4);
+    } else {
+        h = seed + XXH64Prime5;
+    }
+    h += n;
+    for (; end - p >= 8; p += 8) {
+        h = rotl64(h ^ xxh64_round(0, load64(p)), 27) * XXH64Prime1 + XXH64Prime4;
+    }
+    if (end - p >= 4) {
+        h = rotl64(h ^ (load32(p) * XXH64Prime1), 23) * XXH64Prime2 + XXH64Prime3;
+        p += 4;
+    }
+    for (; p != end; ++p) {
+        h = rotl64(h ^ (*p * XXH64Prime5), 11) * XXH64Prime1;
+    }
+    h ^= h >> 33;
+    h *= XXH64Prime2;
+    h ^= h >> 29;
+    h *= XXH64Prime3;
+    return h ^ (h >> 32);
+}
+}  // namespace checksum
+}  // namespace Vc
+
+#undef Vc_CHECKSUM_X86_64_
+#undef Vc_TARGET_SSE42_
+#undef Vc_TARGET_PCLMUL_
+
+#endif  // VC_COMMON_CHECKSUM_H_
+
+// vim: foldmethod=marker
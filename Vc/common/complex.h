@@ -0,0 +1,313 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_COMPLEX_H_
+#define VC_COMMON_COMPLEX_H_
+
+#include <complex>
+#include <cstddef>
+#include <type_traits>
+#include "../vector.h"
+#include "deinterleave.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// complex_fma{{{1
+/**\internal
+ * `a * b + c`, contracted into one instruction if the target has FMA. Without hardware
+ * support Vc::fma is emulated and slower than a multiplication and an addition.
+ */
+template <typename V> Vc_INTRINSIC V complex_fma(const V &a, const V &b, const V &c)
+{
+#if defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4
+    return Vc::fma(a, b, c);
+#else
+    const V ab = a * b;  // a named temporary keeps the fixed_size operators unambiguous
+    return ab + c;
+#endif
+}
+
+// load_complex / store_complex{{{1
+/**\internal
+ * Converts between interleaved `re, im` pairs in memory and split vectors of real and
+ * imaginary parts. Native vectors use the in-register (de)interleaving of deinterleave.h
+ * and Vector::interleaveLow/High; SimdArrays recurse into their native parts.
+ */
+template <typename T, typename A>
+Vc_INTRINSIC void load_complex(Vector<T, A> &re, Vector<T, A> &im, const T *mem)
+{
+    Vc::deinterleave(&re, &im, mem, Vc::Unaligned);
+}
+template <typename T, typename A>
+Vc_INTRINSIC void store_complex(const Vector<T, A> &re, const Vector<T, A> &im, T *mem)
+{
+    re.interleaveLow(im).store(mem, Vc::Unaligned);
+    re.interleaveHigh(im).store(mem + Vector<T, A>::Size, Vc::Unaligned);
+}
+template <typename T, std::size_t N, typename V>
+void load_complex(SimdArray<T, N, V, N> &re, SimdArray<T, N, V, N> &im, const T *mem);
+template <typename T, std::size_t N, typename V>
+void store_complex(const SimdArray<T, N, V, N> &re, const SimdArray<T, N, V, N> &im,
+                   T *mem);
+template <typename T, std::size_t N, typename V, std::size_t M>
+void load_complex(SimdArray<T, N, V, M> &re, SimdArray<T, N, V, M> &im, const T *mem);
+template <typename T, std::size_t N, typename V, std::size_t M>
+void store_complex(const SimdArray<T, N, V, M> &re, const SimdArray<T, N, V, M> &im,
+                   T *mem);
+template <typename T, int N>
+Vc_INTRINSIC void load_complex(Vector<T, simd_abi::fixed_size<N>> &re,
+                               Vector<T, simd_abi::fixed_size<N>> &im, const T *mem)
+{
+    load_complex(static_cast<SimdArray<T, N> &>(re), static_cast<SimdArray<T, N> &>(im),
+                 mem);
+}
+template <typename T, int N>
+Vc_INTRINSIC void store_complex(const Vector<T, simd_abi::fixed_size<N>> &re,
+                                const Vector<T, simd_abi::fixed_size<N>> &im, T *mem)
+{
+    store_complex(static_cast<const SimdArray<T, N> &>(re),
+                  static_cast<const SimdArray<T, N> &>(im), mem);
+}
+template <typename T, std::size_t N, typename V>
+Vc_INTRINSIC void load_complex(SimdArray<T, N, V, N> &re, SimdArray<T, N, V, N> &im,
+                               const T *mem)
+{
+    load_complex(internal_data(re), internal_data(im), mem);
+}
+template <typename T, std::size_t N, typename V>
+Vc_INTRINSIC void store_complex(const SimdArray<T, N, V, N> &re,
+                                const SimdArray<T, N, V, N> &im, T *mem)
+{
+    store_complex(internal_data(re), internal_data(im), mem);
+}
+template <typename T, std::size_t N, typename V, std::size_t M>
+Vc_INTRINSIC void load_complex(SimdArray<T, N, V, M> &re, SimdArray<T, N, V, M> &im,
+                               const T *mem)
+{
+    auto &re0 = internal_data0(re);
+    load_complex(re0, internal_data0(im), mem);
+    load_complex(internal_data1(re), internal_data1(im), mem + 2 * re0.size());
+}
+template <typename T, std::size_t N, typename V, std::size_t M>
+Vc_INTRINSIC void store_complex(const SimdArray<T, N, V, M> &re,
+                                const SimdArray<T, N, V, M> &im, T *mem)
+{
+    const auto &re0 = internal_data0(re);
+    store_complex(re0, internal_data0(im), mem);
+    store_complex(internal_data1(re), internal_data1(im), mem + 2 * re0.size());
+}
+//}}}1
+}  // namespace Detail
+
+// complex{{{1
+/**
+ * \ingroup Math
+ *
+ * \c V::Size complex numbers, stored as one vector of real parts and one vector of
+ * imaginary parts (split or SoA layout). Arithmetic therefore needs no shuffles, and
+ * products and quotients are contracted into FMAs if the target supports them.
+ *
+ * Arrays of \c std::complex are converted on load() and store() with the in-register
+ * (de)interleaving of Vc::deinterleave and Vector::interleaveLow/High:
+ *
+ * \code
+ * // y[i] = a * x[i] + y[i] over arrays of std::complex<float>
+ * const Vc::complex<float_v> va = a;
+ * for (std::size_t i = 0; i < n; i += float_v::Size) {
+ *     (va * Vc::complex<float_v>(&x[i]) + Vc::complex<float_v>(&y[i])).store(&y[i]);
+ * }
+ * \endcode
+ *
+ * Unlike \c std::complex, multiplication and division use the textbook formulas without
+ * the special handling of infinities and NaNs (like GCC's `-fcx-limited-range`).
+ *
+ * \tparam V A \c float or \c double Vc::Vector or Vc::SimdArray.
+ */
+template <typename V> class complex
+{
+    static_assert(Traits::is_simd_vector<V>::value &&
+                      std::is_floating_point<typename V::EntryType>::value,
+                  "Vc::complex<V> requires a float or double Vector or SimdArray.");
+    using T = typename V::EntryType;
+
+public:
+    using value_type = V;
+    using mask_type = typename V::mask_type;
+    using EntryType = T;
+    static constexpr std::size_t Size = V::Size;
+
+    /// Initializes all entries to zero.
+    Vc_INTRINSIC complex() : m_re(V(0)), m_im(V(0)) {}
+    /// Initializes the real parts to \p re and the imaginary parts to \p im.
+    Vc_INTRINSIC complex(const V &re, const V &im = V(0)) : m_re(re), m_im(im) {}
+    /// Broadcasts \p z to all entries.
+    Vc_INTRINSIC complex(const std::complex<T> &z) : m_re(z.real()), m_im(z.imag()) {}
+    /// Loads \c Size complex numbers from \p mem.
+    explicit Vc_INTRINSIC complex(const std::complex<T> *mem) { load(mem); }
+
+    /// Loads \c Size complex numbers from \p mem.
+    Vc_INTRINSIC void load(const std::complex<T> *mem)
+    {
+        // std::complex<T> is laid out as T[2] ([complex.numbers])
+        Detail::load_complex(m_re, m_im, reinterpret_cast<const T *>(mem));
+    }
+    /// Stores the \c Size complex numbers to \p mem.
+    Vc_INTRINSIC void store(std::complex<T> *mem) const
+    {
+        Detail::store_complex(m_re, m_im, reinterpret_cast<T *>(mem));
+    }
+
+    /// Returns the real parts.
+    Vc_INTRINSIC const V &real() const { return m_re; }
+    /// Returns the imaginary parts.
+    Vc_INTRINSIC const V &imag() const { return m_im; }
+    /// Sets the real parts.
+    Vc_INTRINSIC void real(const V &re) { m_re = re; }
+    /// Sets the imaginary parts.
+    Vc_INTRINSIC void imag(const V &im) { m_im = im; }
+
+    /// Returns entry \p i.
+    Vc_INTRINSIC std::complex<T> operator[](std::size_t i) const
+    {
+        return {m_re[i], m_im[i]};
+    }
+
+    Vc_INTRINSIC complex operator+() const { return *this; }
+    Vc_INTRINSIC complex operator-() const { return {-m_re, -m_im}; }
+
+    Vc_INTRINSIC complex &operator+=(const complex &z) { return *this = *this + z; }
+    Vc_INTRINSIC complex &operator-=(const complex &z) { return *this = *this - z; }
+    Vc_INTRINSIC complex &operator*=(const complex &z) { return *this = *this * z; }
+    Vc_INTRINSIC complex &operator/=(const complex &z) { return *this = *this / z; }
+    Vc_INTRINSIC complex &operator+=(const V &x) { return *this = *this + x; }
+    Vc_INTRINSIC complex &operator-=(const V &x) { return *this = *this - x; }
+    Vc_INTRINSIC complex &operator*=(const V &x) { return *this = *this * x; }
+    Vc_INTRINSIC complex &operator/=(const V &x) { return *this = *this / x; }
+
+    // the operators are friends so that real vectors, scalars, and std::complex convert
+    friend Vc_INTRINSIC complex operator+(const complex &a, const complex &b)
+    {
+        return {a.m_re + b.m_re, a.m_im + b.m_im};
+    }
+    friend Vc_INTRINSIC complex operator-(const complex &a, const complex &b)
+    {
+        return {a.m_re - b.m_re, a.m_im - b.m_im};
+    }
+    friend Vc_INTRINSIC complex operator+(const complex &a, const V &x)
+    {
+        return {a.m_re + x, a.m_im};
+    }
+    friend Vc_INTRINSIC complex operator+(const V &x, const complex &a) { return a + x; }
+    friend Vc_INTRINSIC complex operator-(const complex &a, const V &x)
+    {
+        return {a.m_re - x, a.m_im};
+    }
+    friend Vc_INTRINSIC complex operator-(const V &x, const complex &a)
+    {
+        return {x - a.m_re, -a.m_im};
+    }
+    friend Vc_INTRINSIC complex operator*(const complex &a, const complex &b)
+    {
+        return {Detail::complex_fma(a.m_re, b.m_re, -(a.m_im * b.m_im)),
+                Detail::complex_fma(a.m_re, b.m_im, a.m_im * b.m_re)};
+    }
+    friend Vc_INTRINSIC complex operator*(const complex &a, const V &x)
+    {
+        return {a.m_re * x, a.m_im * x};
+    }
+    friend Vc_INTRINSIC complex operator*(const V &x, const complex &a) { return a * x; }
+    /// Computes `a * conj(b) / norm(b)`.
+    friend Vc_INTRINSIC complex operator/(const complex &a, const complex &b)
+    {
+        const V scale = V(1) / norm(b);
+        return {Detail::complex_fma(a.m_re, b.m_re, a.m_im * b.m_im) * scale,
+                Detail::complex_fma(a.m_im, b.m_re, -(a.m_re * b.m_im)) * scale};
+    }
+    friend Vc_INTRINSIC complex operator/(const complex &a, const V &x)
+    {
+        const V scale = V(1) / x;
+        return {a.m_re * scale, a.m_im * scale};
+    }
+
+    friend Vc_INTRINSIC mask_type operator==(const complex &a, const complex &b)
+    {
+        return a.m_re == b.m_re && a.m_im == b.m_im;
+    }
+    friend Vc_INTRINSIC mask_type operator!=(const complex &a, const complex &b)
+    {
+        return a.m_re != b.m_re || a.m_im != b.m_im;
+    }
+
+    /// Returns the complex conjugates.
+    friend Vc_INTRINSIC complex conj(const complex &z) { return {z.m_re, -z.m_im}; }
+    /// Returns the squared magnitudes.
+    friend Vc_INTRINSIC V norm(const complex &z)
+    {
+        return Detail::complex_fma(z.m_re, z.m_re, z.m_im * z.m_im);
+    }
+    /**
+     * Returns the magnitudes. Unlike \c std::abs this is `sqrt(norm(z))`, without the
+     * scaling of \c std::hypot: the result overflows (underflows) if norm(z) does.
+     */
+    friend Vc_INTRINSIC V abs(const complex &z) { return Vc::sqrt(norm(z)); }
+    /// Returns the phase angles in \f$[-\pi, \pi]\f$.
+    friend Vc_INTRINSIC V arg(const complex &z) { return Vc::atan2(z.m_im, z.m_re); }
+    /// Returns \f$e^z\f$.
+    friend Vc_INTRINSIC complex exp(const complex &z)
+    {
+        V s, c;
+        Vc::sincos(z.m_im, &s, &c);
+        const V r = Vc::exp(z.m_re);
+        return {r * c, r * s};
+    }
+
+private:
+    V m_re, m_im;
+};
+template <typename V> constexpr std::size_t complex<V>::Size;
+
+/**
+ * \ingroup Math
+ * Returns the complex numbers with magnitudes \p r and phase angles \p theta.
+ */
+template <typename V>
+Vc_INTRINSIC enable_if<Traits::is_simd_vector<V>::value, complex<V>> polar(
+    const V &r, const V &theta = V(0))
+{
+    V s, c;
+    Vc::sincos(theta, &s, &c);
+    return {r * c, r * s};
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_COMPLEX_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,377 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_CONVOLUTION_H_
+#define VC_COMMON_CONVOLUTION_H_
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "../vector.h"
+#include "../Allocator"
+#include "complex.h"
+#include "fft.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Math
+ * How Vc::fir, Vc::convolve and Vc::correlate compute their sums.
+ */
+enum class fir_method {
+    /// Chooses \c fft for long floating-point kernels and \c direct otherwise.
+    automatic,
+    /// Sums the products directly: \f$O(n_h)\f$ per output.
+    direct,
+    /// Overlap-save with Vc::fft: \f$O(\log n_h)\f$ per output. Not for \c short.
+    fft
+};
+
+namespace Detail
+{
+// FirTraits{{{1
+/**\internal
+ * The vector type for the sums and the output type. \c short samples are summed exactly
+ * in \c int.
+ */
+template <typename T> struct FirTraits;
+template <> struct FirTraits<float> {
+    using vector_type = float_v;
+    using result_type = float;
+};
+template <> struct FirTraits<double> {
+    using vector_type = double_v;
+    using result_type = double;
+};
+template <> struct FirTraits<short> {
+    using vector_type = int_v;
+    using result_type = int;
+};
+
+/**\internal
+ * The kernel length from which fir_method::automatic uses overlap-save instead of the
+ * direct sums, measured with examples/convolution on SSE4 and AVX2 targets.
+ */
+constexpr std::size_t fir_fft_threshold = 192;
+
+// fir_madd{{{1
+/**\internal
+ * `a * b + c`, contracted into an FMA if the target supports it for the entry type.
+ */
+template <typename V>
+Vc_INTRINSIC V fir_madd(const V &a, const V &b, const V &c, std::true_type)
+{
+    return Vc::fma(a, b, c);
+}
+template <typename V>
+Vc_INTRINSIC V fir_madd(const V &a, const V &b, const V &c, std::false_type)
+{
+    return a * b + c;
+}
+template <typename V> Vc_INTRINSIC V fir_madd(const V &a, const V &b, const V &c)
+{
+#if defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4
+    return fir_madd(a, b, c, std::is_floating_point<typename V::EntryType>());
+#else
+    return fir_madd(a, b, c, std::false_type());
+#endif
+}
+
+// fir_direct{{{1
+/**\internal
+ * Computes \f$y_i = \sum_{j<n_g} g_j x_{i+j}\f$ for \f$i < n_y\f$. Four vectors of
+ * outputs are accumulated in registers while the taps are broadcast one at a time, so
+ * every tap costs one unaligned load and one FMA per output vector. \p x is read up to
+ * `x[ny + ng - 2 + V::Size - 1]`.
+ */
+template <typename T, typename V = typename FirTraits<T>::vector_type,
+          typename R = typename FirTraits<T>::result_type>
+void fir_direct(const T *x, std::size_t ny, const T *g, std::size_t ng, R *y)
+{
+    constexpr std::size_t W = V::Size;
+    std::size_t i = 0;
+    for (; i + 4 * W <= ny; i += 4 * W) {
+        V acc0 = V::Zero(), acc1 = V::Zero(), acc2 = V::Zero(), acc3 = V::Zero();
+        const T *xi = x + i;
+        for (std::size_t j = 0; j < ng; ++j, ++xi) {
+            const V gj = static_cast<R>(g[j]);
+            acc0 = fir_madd(gj, V(xi, Vc::Unaligned), acc0);
+            acc1 = fir_madd(gj, V(xi + W, Vc::Unaligned), acc1);
+            acc2 = fir_madd(gj, V(xi + 2 * W, Vc::Unaligned), acc2);
+            acc3 = fir_madd(gj, V(xi + 3 * W, Vc::Unaligned), acc3);
+        }
+        acc0.store(y + i, Vc::Unaligned);
+        acc1.store(y + i + W, Vc::Unaligned);
+        acc2.store(y + i + 2 * W, Vc::Unaligned);
+        acc3.store(y + i + 3 * W, Vc::Unaligned);
+    }
+    for (; i < ny; i += W) {
+        V acc = V::Zero();
+        for (std::size_t j = 0; j < ng; ++j) {
+            acc = fir_madd(V(static_cast<R>(g[j])), V(x + i + j, Vc::Unaligned), acc);
+        }
+        if (i + W <= ny) {
+            acc.store(y + i, Vc::Unaligned);
+        } else {
+            for (std::size_t l = 0; i + l < ny; ++l) {
+                y[i + l] = acc[l];
+            }
+        }
+    }
+}
+
+// FirOverlapSave{{{1
+/**\internal
+ * Overlap-save with real FFTs of length \c N: the spectrum of every block of \c N
+ * samples is multiplied with the precomputed spectrum of the zero-padded taps, and the
+ * last `N - taps + 1` values of the (circular) inverse are the outputs. The 1/N
+ * normalization is folded into the tap spectrum.
+ */
+template <typename T> class FirOverlapSave
+{
+    using V = Vector<T>;
+    using C = Vc::complex<V>;
+
+public:
+    FirOverlapSave(const T *taps, std::size_t n)
+        : m_plan(transformSize(n)), m_taps(n), m_spectrum(m_plan.size() / 2 + 1)
+        , m_block(m_plan.size())
+    {
+        const std::size_t N = m_plan.size();
+        std::vector<T, Vc::Allocator<T>> padded(N);
+        for (std::size_t j = 0; j < n; ++j) {
+            padded[j] = taps[j] / T(N);
+        }
+        m_plan.forward_real(padded.data(), m_spectrum.data());
+    }
+
+    /// The number of outputs per transform.
+    std::size_t block_size() const { return m_plan.size() - m_taps + 1; }
+
+    /**\internal
+     * Computes `ny <= block_size()` outputs from the `taps - 1 + ny` samples at \p x,
+     * the first `taps - 1` of which are the history.
+     */
+    void process(const T *x, std::size_t ny, T *y)
+    {
+        const std::size_t N = m_plan.size();
+        const std::size_t nx = m_taps - 1 + ny;
+        std::copy(x, x + nx, m_block.begin());
+        std::fill(m_block.begin() + nx, m_block.end(), T(0));
+        std::vector<std::complex<T>> &s = m_scratch;
+        s.resize(N / 2 + 1);
+        m_plan.forward_real(m_block.data(), s.data());
+        std::size_t k = 0;
+        for (; k + V::Size <= s.size(); k += V::Size) {
+            (C(&s[k]) * C(&m_spectrum[k])).store(&s[k]);
+        }
+        for (; k < s.size(); ++k) {
+            const std::complex<T> a = s[k], b = m_spectrum[k];
+            s[k] = {a.real() * b.real() - a.imag() * b.imag(),
+                    a.real() * b.imag() + a.imag() * b.real()};
+        }
+        m_plan.inverse_real(s.data(), m_block.data());
+        std::copy_n(m_block.begin() + (m_taps - 1), ny, y);
+    }
+
+private:
+    // four times the kernel length balances the transform cost against the overlap
+    static std::size_t transformSize(std::size_t taps)
+    {
+        std::size_t n = 64;
+        while (n < 4 * taps) {
+            n *= 2;
+        }
+        return n;
+    }
+
+    fft<T> m_plan;
+    std::size_t m_taps;
+    std::vector<std::complex<T>> m_spectrum, m_scratch;
+    std::vector<T, Vc::Allocator<T>> m_block;
+};
+template <> class FirOverlapSave<short>
+{
+public:
+    FirOverlapSave(const short *, std::size_t) {}
+    std::size_t block_size() const { return 0; }
+    void process(const short *, std::size_t, int *) {}
+};
+//}}}1
+}  // namespace Detail
+
+// fir{{{1
+/**
+ * \ingroup Math
+ *
+ * A streaming finite impulse response filter with the taps \f$h_0, \ldots, h_{n-1}\f$:
+ *
+ * \f[y_t = \sum_{j=0}^{n-1} h_j x_{t-j}\f]
+ *
+ * where \f$t\f$ counts all samples passed to process() since construction (or reset()),
+ * and samples before the first one are zero. The input can therefore be passed in
+ * chunks of any size.
+ *
+ * Short kernels sum directly with register-blocked accumulators and Vc::fma. Long
+ * kernels of \c float and \c double use overlap-save with Vc::fft. \c short samples and
+ * taps are summed exactly into \c int outputs, which cannot overflow as long as the
+ * absolute values of the taps sum to at most \f$2^{15}\f$ (1.0 in Q15).
+ *
+ * \code
+ * Vc::fir<float> lowpass(taps.data(), taps.size());
+ * while (std::size_t n = read(chunk)) {
+ *     lowpass.process(chunk, n, filtered);
+ * }
+ * \endcode
+ *
+ * \tparam T \c float, \c double or \c short.
+ */
+template <typename T> class fir
+{
+    using Traits = Detail::FirTraits<T>;
+    using V = typename Traits::vector_type;
+
+public:
+    /// The type of the outputs: \c int for \c short, \p T otherwise.
+    using result_type = typename Traits::result_type;
+
+    /**
+     * Copies the \p n taps at \p taps (\p n > 0) and chooses the summation \p method.
+     */
+    fir(const T *taps, std::size_t n, fir_method method = fir_method::automatic)
+        : m_reversed(taps, taps + n)
+    {
+        Vc_ASSERT(n > 0);
+        Vc_ASSERT(method != fir_method::fft || std::is_floating_point<T>::value);
+        if (!std::is_floating_point<T>::value) {
+            method = fir_method::direct;
+        } else if (method == fir_method::automatic) {
+            method = n >= Detail::fir_fft_threshold ? fir_method::fft
+                                                    : fir_method::direct;
+        }
+        std::size_t block = 4096;
+        if (method == fir_method::fft) {
+            m_fft.reset(new Detail::FirOverlapSave<T>(taps, n));
+            block = m_fft->block_size();
+        }
+        std::reverse(m_reversed.begin(), m_reversed.end());
+        // history, one block of input, and the overread of fir_direct
+        m_buffer.assign(n - 1 + block + V::Size, T(0));
+        m_block = block;
+    }
+
+    /// Returns the number of taps.
+    std::size_t size() const { return m_reversed.size(); }
+    /// Returns the summation method in use (never \c automatic).
+    fir_method method() const { return m_fft ? fir_method::fft : fir_method::direct; }
+
+    /// Forgets all past samples.
+    void reset() { std::fill(m_buffer.begin(), m_buffer.end(), T(0)); }
+
+    /**
+     * Filters the \p n samples at \p in and writes the \p n outputs to \p out.
+     * \p in and \p out may not overlap.
+     */
+    void process(const T *in, std::size_t n, result_type *out)
+    {
+        const std::size_t history = size() - 1;
+        while (n > 0) {
+            const std::size_t chunk = std::min(n, m_block);
+            std::copy_n(in, chunk, m_buffer.begin() + history);
+            if (m_fft) {
+                m_fft->process(m_buffer.data(), chunk, out);
+            } else {
+                Detail::fir_direct(m_buffer.data(), chunk, m_reversed.data(), size(),
+                                   out);
+            }
+            std::copy_n(m_buffer.begin() + chunk, history, m_buffer.begin());
+            in += chunk;
+            out += chunk;
+            n -= chunk;
+        }
+    }
+
+private:
+    std::vector<T> m_reversed;
+    std::vector<T, Vc::Allocator<T>> m_buffer;
+    std::size_t m_block = 0;
+    std::unique_ptr<Detail::FirOverlapSave<T>> m_fft;
+};
+
+// convolve / correlate{{{1
+namespace Detail
+{
+template <typename T>
+void fir_full(fir<T> &filter, const T *x, std::size_t nx,
+              typename fir<T>::result_type *y)
+{
+    filter.process(x, nx, y);
+    const std::vector<T> zeros(filter.size() - 1, T(0));
+    filter.process(zeros.data(), zeros.size(), y + nx);
+}
+}  // namespace Detail
+
+/**
+ * \ingroup Math
+ * Writes the full convolution of the \p nx values at \p x with the \p nh values at
+ * \p h, \f$y_i = \sum_j h_j x_{i-j}\f$ for \f$i < n_x + n_h - 1\f$, to \p y.
+ * See Vc::fir for the types and the choice of \p method.
+ */
+template <typename T>
+void convolve(const T *x, std::size_t nx, const T *h, std::size_t nh,
+              typename fir<T>::result_type *y, fir_method method = fir_method::automatic)
+{
+    fir<T> filter(h, nh, method);
+    Detail::fir_full(filter, x, nx, y);
+}
+
+/**
+ * \ingroup Math
+ * Writes the full cross-correlation of the \p nx values at \p x with the \p nh values at
+ * \p h, \f$y_i = \sum_j h_j x_{i+j-(n_h-1)}\f$ for \f$i < n_x + n_h - 1\f$, to \p y.
+ * This is the convolution with the reversed \p h (and `numpy.correlate(x, h, "full")`).
+ */
+template <typename T>
+void correlate(const T *x, std::size_t nx, const T *h, std::size_t nh,
+               typename fir<T>::result_type *y, fir_method method = fir_method::automatic)
+{
+    const std::vector<T> reversed(std::reverse_iterator<const T *>(h + nh),
+                                  std::reverse_iterator<const T *>(h));
+    fir<T> filter(reversed.data(), nh, method);
+    Detail::fir_full(filter, x, nx, y);
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_CONVOLUTION_H_
+
+// vim: foldmethod=marker
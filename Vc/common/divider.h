@@ -0,0 +1,271 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+#ifndef VC_COMMON_DIVIDER_H_
+#define VC_COMMON_DIVIDER_H_
+
+#include <type_traits>
+#include "../vector.h"
+#include "../type_traits"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ *
+ * Returns the high half of the full (double-width) product of every pair of entries of
+ * \p a and \p b, i.e. `(a[i] * b[i]) >> (8 * sizeof(T))` computed without overflow.
+ *
+ * This function is available for \c int_v, \c uint_v, \c short_v, and \c ushort_v.
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if<std::is_integral<T>::value && (sizeof(T) == 2 || sizeof(T) == 4),
+                       Vector<T, Abi>>
+mulhi(const Vector<T, Abi> &a, const Vector<T, Abi> &b)
+{
+    return Vector<T, Abi>(Detail::mulhi(a.data(), b.data(), T()));
+}
+
+namespace Common
+{
+/**
+ * \ingroup Utilities
+ * \headerfile divider.h <Vc/divider>
+ *
+ * Precomputes the division by a runtime-invariant divisor, so that the quotient (and
+ * remainder) of a whole vector is obtained via one mulhi, a few additions, and shifts
+ * instead of integer division. The method is the one from Granlund and Montgomery
+ * ("Division by invariant integers using multiplication"), as popularized by libdivide.
+ *
+ * \code
+ * const Vc::divider<uint> buckets(bucketCount);
+ * for (std::size_t i = 0; i < hashes.vectorsCount(); ++i) {  // Vc::Memory<uint_v>
+ *     const uint_v h = hashes.vector(i);
+ *     hashes.vector(i) = h % buckets;
+ * }
+ * \endcode
+ *
+ * Constructing a divider costs about as much as a few scalar divisions. It pays off as
+ * soon as it is used for more than one or two vectors.
+ *
+ * \tparam T One of \c int, \c uint, \c short, or \c ushort.
+ */
+template <typename T> class divider
+{
+    static_assert(std::is_same<T, int>::value || std::is_same<T, uint>::value ||
+                      std::is_same<T, short>::value || std::is_same<T, ushort>::value,
+                  "Vc::divider<T> requires T to be one of int, uint, short, or ushort.");
+    using U = typename std::make_unsigned<T>::type;
+    static constexpr int Bits = 8 * sizeof(T);
+
+    enum class Algorithm : unsigned char {
+        Shift,       // |d| is a power of two
+        Multiply,    // the magic number fits into T
+        MultiplyAdd  // the magic number needs Bits + 1 bits, the top bit is added separately
+    };
+
+    T m_divisor;
+    T m_magic;
+    unsigned char m_shift;
+    Algorithm m_algorithm;
+    bool m_negative;
+
+    static int floorLog2(U x)
+    {
+        int l = -1;
+        for (; x != 0; x >>= 1) {
+            ++l;
+        }
+        return l;
+    }
+
+    // unsigned: q = (mulhi(n, m) [+ n]) >> shift with m = 2^(Bits + l) / d + 1
+    void init(std::false_type)
+    {
+        const U d = m_divisor;
+        const int l = floorLog2(d);
+        m_shift = l;
+        if ((d & (d - 1)) == 0) {
+            m_algorithm = Algorithm::Shift;
+            return;
+        }
+        const unsigned long long num = 1ull << (Bits + l);
+        U m = static_cast<U>(num / d);
+        const U rem = static_cast<U>(num % d);
+        if (static_cast<U>(d - rem) < (U(1) << l)) {
+            m_algorithm = Algorithm::Multiply;
+        } else {
+            m = static_cast<U>(m + m);
+            const U twiceRem = static_cast<U>(rem + rem);
+            if (twiceRem >= d || twiceRem < rem) {
+                m = static_cast<U>(m + 1);
+            }
+            m_algorithm = Algorithm::MultiplyAdd;
+        }
+        m_magic = static_cast<T>(static_cast<U>(m + 1));
+    }
+
+    // signed: the same for |d| with one bit less, rounding towards zero, and the sign of
+    // the divisor folded into the magic number
+    void init(std::true_type)
+    {
+        m_negative = m_divisor < 0;
+        const U absD = m_negative ? static_cast<U>(U(0) - static_cast<U>(m_divisor))
+                                  : static_cast<U>(m_divisor);
+        const int l = floorLog2(absD);
+        m_shift = l;
+        if ((absD & (absD - 1)) == 0) {
+            m_algorithm = Algorithm::Shift;
+            return;
+        }
+        const unsigned long long num = 1ull << (Bits - 1 + l);
+        U m = static_cast<U>(num / absD);
+        const U rem = static_cast<U>(num % absD);
+        if (static_cast<U>(absD - rem) < (U(1) << l)) {
+            m_algorithm = Algorithm::Multiply;
+            m_shift = l - 1;
+        } else {
+            m = static_cast<U>(m + m);
+            const U twiceRem = static_cast<U>(rem + rem);
+            if (twiceRem >= absD || twiceRem < rem) {
+                m = static_cast<U>(m + 1);
+            }
+            m_algorithm = Algorithm::MultiplyAdd;
+        }
+        m = static_cast<U>(m + 1);
+        m_magic = static_cast<T>(m_negative ? static_cast<U>(U(0) - m) : m);
+    }
+
+    template <typename V> Vc_INTRINSIC V divide(const V &n, std::false_type) const
+    {
+        switch (m_algorithm) {
+        case Algorithm::Shift:
+            return n >> m_shift;
+        case Algorithm::Multiply:
+            return Vc::mulhi(n, V(m_magic)) >> m_shift;
+        default: {
+            const V q = Vc::mulhi(n, V(m_magic));
+            return (((n - q) >> 1) + q) >> m_shift;
+        }
+        }
+    }
+
+    template <typename V> Vc_INTRINSIC V divide(const V &n, std::true_type) const
+    {
+        V q;
+        switch (m_algorithm) {
+        case Algorithm::Shift:
+            // add |d| - 1 to negative numerators to round towards zero
+            q = (n + ((n >> (Bits - 1)) & V(static_cast<T>((U(1) << m_shift) - 1)))) >>
+                m_shift;
+            return m_negative ? -q : q;
+        case Algorithm::Multiply:
+            q = Vc::mulhi(n, V(m_magic)) >> m_shift;
+            break;
+        default:
+            q = Vc::mulhi(n, V(m_magic));
+            q = (m_negative ? q - n : q + n) >> m_shift;
+            break;
+        }
+        return q - (q >> (Bits - 1));  // add one to negative quotients
+    }
+
+public:
+    /**
+     * Precomputes the division by \p d.
+     *
+     * \param d The divisor. It must not be 0.
+     */
+    explicit divider(T d)
+        : m_divisor(d)
+        , m_magic(0)
+        , m_shift(0)
+        , m_algorithm(Algorithm::Shift)
+        , m_negative(false)
+    {
+        Vc_ASSERT(d != 0);
+        init(std::is_signed<T>());
+    }
+
+    /// Returns the divisor passed to the constructor.
+    Vc_INTRINSIC T divisor() const { return m_divisor; }
+
+    /**
+     * Returns `n / divisor()` (rounded towards zero, as the built-in operator).
+     */
+    template <typename Abi>
+    Vc_INTRINSIC Vector<T, Abi> divide(const Vector<T, Abi> &n) const
+    {
+        return divide(n, std::is_signed<T>());
+    }
+
+    /// \copydoc divide
+    template <typename Abi>
+    friend Vc_INTRINSIC Vector<T, Abi> operator/(const Vector<T, Abi> &n, const divider &d)
+    {
+        return d.divide(n);
+    }
+    /**
+     * Returns `n % divisor()` (with the sign of \p n, as the built-in operator).
+     */
+    template <typename Abi>
+    friend Vc_INTRINSIC Vector<T, Abi> operator%(const Vector<T, Abi> &n, const divider &d)
+    {
+        return n - d.divide(n) * Vector<T, Abi>(d.m_divisor);
+    }
+    /// Assigns `n / d` to \p n.
+    template <typename Abi>
+    friend Vc_INTRINSIC Vector<T, Abi> &operator/=(Vector<T, Abi> &n, const divider &d)
+    {
+        return n = d.divide(n);
+    }
+    /// Assigns `n % d` to \p n.
+    template <typename Abi>
+    friend Vc_INTRINSIC Vector<T, Abi> &operator%=(Vector<T, Abi> &n, const divider &d)
+    {
+        return n = n % d;
+    }
+
+    /// Scalar overloads, using the same code path as Vc::Scalar vectors.
+    friend Vc_INTRINSIC T operator/(T n, const divider &d)
+    {
+        return d.divide(Vector<T, VectorAbi::Scalar>(n))[0];
+    }
+    /// \copydoc operator/(T, const divider &)
+    friend Vc_INTRINSIC T operator%(T n, const divider &d)
+    {
+        return (Vector<T, VectorAbi::Scalar>(n) % d)[0];
+    }
+};
+}  // namespace Common
+
+using Common::divider;
+}  // namespace Vc
+
+#endif  // VC_COMMON_DIVIDER_H_
+
+// vim: foldmethod=marker
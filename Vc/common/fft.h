@@ -0,0 +1,538 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_FFT_H_
+#define VC_COMMON_FFT_H_
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+#include "../vector.h"
+#include "../Allocator"
+#include "complex.h"
+#include "memory.h"
+#include "transpose.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// fft_factorize{{{1
+/**\internal
+ * Splits \p n into the radices of the FFT passes, largest first. Returns \c false if \p n
+ * has a prime factor other than 2, 3 and 5.
+ */
+inline bool fft_factorize(std::size_t n, std::vector<std::size_t> &radices)
+{
+    radices.clear();
+    if (n == 0) {
+        return false;
+    }
+    while (n % 8 == 0) {
+        radices.push_back(8);
+        n /= 8;
+    }
+    if (n % 4 == 0) {
+        radices.push_back(4);
+        n /= 4;
+    }
+    if (n % 2 == 0) {
+        radices.push_back(2);
+        n /= 2;
+    }
+    while (n % 5 == 0) {
+        radices.push_back(5);
+        n /= 5;
+    }
+    while (n % 3 == 0) {
+        radices.push_back(3);
+        n /= 3;
+    }
+    return n == 1;
+}
+
+// fft_rotate{{{1
+/**\internal
+ * Multiplies \p z by \f$-i\f$ for the forward and by \f$i\f$ for the inverse transform,
+ * i.e. by the fourth root of unity of the transform direction.
+ */
+template <bool Inverse, typename C> Vc_INTRINSIC C fft_rotate(const C &z)
+{
+    return Inverse ? C(-z.imag(), z.real()) : C(z.imag(), -z.real());
+}
+
+// FftButterfly{{{1
+/**\internal
+ * In-place DFT of \p P values (without twiddle factors). The scalar constants are the
+ * real and imaginary parts of the roots of unity; the inverse direction only flips the
+ * sign of the imaginary parts.
+ */
+template <std::size_t P, bool Inverse> struct FftButterfly;
+template <bool Inverse> struct FftButterfly<2, Inverse> {
+    template <typename C> static Vc_INTRINSIC void apply(C *a)
+    {
+        const C t = a[0] - a[1];
+        a[0] = a[0] + a[1];
+        a[1] = t;
+    }
+};
+template <bool Inverse> struct FftButterfly<4, Inverse> {
+    template <typename C> static Vc_INTRINSIC void apply(C *a)
+    {
+        const C s02 = a[0] + a[2], d02 = a[0] - a[2];
+        const C s13 = a[1] + a[3], d13 = fft_rotate<Inverse>(a[1] - a[3]);
+        a[0] = s02 + s13;
+        a[1] = d02 + d13;
+        a[2] = s02 - s13;
+        a[3] = d02 - d13;
+    }
+};
+template <bool Inverse> struct FftButterfly<8, Inverse> {
+    template <typename C> static Vc_INTRINSIC void apply(C *a)
+    {
+        using V = typename C::value_type;
+        const V h = std::sqrt(typename V::EntryType(0.5));
+        C even[4], odd[4];
+        for (int j = 0; j < 4; ++j) {
+            even[j] = a[j] + a[j + 4];
+            odd[j] = a[j] - a[j + 4];
+        }
+        // odd[j] *= ω₈^j with ω₈ = (1 ∓ i)/√2
+        const C r1 = fft_rotate<Inverse>(odd[1]);
+        odd[1] = C((odd[1].real() + r1.real()) * h, (odd[1].imag() + r1.imag()) * h);
+        odd[2] = fft_rotate<Inverse>(odd[2]);
+        const C r3 = fft_rotate<Inverse>(odd[3]);
+        odd[3] = C((r3.real() - odd[3].real()) * h, (r3.imag() - odd[3].imag()) * h);
+        FftButterfly<4, Inverse>::apply(even);
+        FftButterfly<4, Inverse>::apply(odd);
+        for (int r = 0; r < 4; ++r) {
+            a[2 * r] = even[r];
+            a[2 * r + 1] = odd[r];
+        }
+    }
+};
+template <bool Inverse> struct FftButterfly<3, Inverse> {
+    template <typename C> static Vc_INTRINSIC void apply(C *a)
+    {
+        using V = typename C::value_type;
+        using T = typename V::EntryType;
+        const T s = std::sqrt(T(0.75));  // sin(2π/3)
+        const C sum = a[1] + a[2];
+        const C c = a[0] - sum * V(T(0.5));
+        const C d = fft_rotate<Inverse>(a[1] - a[2]) * V(s);
+        a[0] = a[0] + sum;
+        a[1] = c + d;
+        a[2] = c - d;
+    }
+};
+template <bool Inverse> struct FftButterfly<5, Inverse> {
+    template <typename C> static Vc_INTRINSIC void apply(C *a)
+    {
+        using V = typename C::value_type;
+        using T = typename V::EntryType;
+        // cos and sin of 2π/5 and 4π/5
+        const V c1 = T(0.30901699437494742410), c2 = T(-0.80901699437494742410);
+        const V s1 = T(0.95105651629515357212), s2 = T(0.58778525229247312917);
+        const C t1 = a[1] + a[4], t2 = a[2] + a[3];
+        const C t3 = fft_rotate<Inverse>(a[1] - a[4]);
+        const C t4 = fft_rotate<Inverse>(a[2] - a[3]);
+        const C r1 = a[0] + t1 * c1 + t2 * c2, r2 = a[0] + t1 * c2 + t2 * c1;
+        const C i1 = t3 * s1 + t4 * s2, i2 = t3 * s2 - t4 * s1;
+        a[0] = a[0] + t1 + t2;
+        a[1] = r1 + i1;
+        a[4] = r1 - i1;
+        a[2] = r2 + i2;
+        a[3] = r2 - i2;
+    }
+};
+
+// FftPasses{{{1
+/**\internal
+ * The passes of an \p n-point self-sorting (Stockham) decimation-in-frequency FFT. Every
+ * element is a Vc::complex<V>, so one run transforms \c V::Size independent sequences,
+ * one per lane, and the butterflies need no shuffles. The twiddle factors are scalars
+ * that are broadcast from a table of roots of unity \f$\omega_N^j\f$, where \p n divides
+ * \p N.
+ */
+class FftPasses
+{
+public:
+    FftPasses() = default;
+    FftPasses(std::size_t n, std::size_t rootsStride) : m_size(n), m_stride(rootsStride)
+    {
+        fft_factorize(n, m_radices);
+    }
+
+    std::size_t size() const { return m_size; }
+
+    /**\internal
+     * Transforms \p x, using \p y as scratch space. Both must hold size() elements.
+     * Returns whichever of the two pointers holds the result.
+     */
+    template <bool Inverse, typename V, typename T>
+    complex<V> *run(complex<V> *x, complex<V> *y, const T *rootsRe,
+                    const T *rootsIm) const
+    {
+        std::size_t len = m_size, s = 1;
+        for (std::size_t p : m_radices) {
+            const std::size_t m = len / p;
+            const std::size_t stride = m_stride * (m_size / len);
+            switch (p) {
+            case 8: pass<Inverse, 8>(x, y, m, s, stride, rootsRe, rootsIm); break;
+            case 4: pass<Inverse, 4>(x, y, m, s, stride, rootsRe, rootsIm); break;
+            case 2: pass<Inverse, 2>(x, y, m, s, stride, rootsRe, rootsIm); break;
+            case 5: pass<Inverse, 5>(x, y, m, s, stride, rootsRe, rootsIm); break;
+            default: pass<Inverse, 3>(x, y, m, s, stride, rootsRe, rootsIm); break;
+            }
+            std::swap(x, y);
+            len = m;
+            s *= p;
+        }
+        return x;
+    }
+
+private:
+    template <bool Inverse, std::size_t P, typename V, typename T>
+    static void pass(const complex<V> *x, complex<V> *y, std::size_t m, std::size_t s,
+                     std::size_t stride, const T *rootsRe, const T *rootsIm)
+    {
+        using C = complex<V>;
+        for (std::size_t k = 0; k < m; ++k) {
+            C w[P];
+            for (std::size_t r = 1; r < P; ++r) {
+                const std::size_t j = r * k * stride;
+                w[r] = C(V(rootsRe[j]), V(Inverse ? -rootsIm[j] : rootsIm[j]));
+            }
+            for (std::size_t q = 0; q < s; ++q) {
+                C a[P];
+                for (std::size_t j = 0; j < P; ++j) {
+                    a[j] = x[q + s * (k + j * m)];
+                }
+                FftButterfly<P, Inverse>::apply(a);
+                C *out = y + q + s * P * k;
+                out[0] = a[0];
+                for (std::size_t r = 1; r < P; ++r) {
+                    out[s * r] = k == 0 ? a[r] : a[r] * w[r];
+                }
+            }
+        }
+    }
+
+    std::vector<std::size_t> m_radices;
+    std::size_t m_size = 0;
+    std::size_t m_stride = 1;
+};
+//}}}1
+}  // namespace Detail
+
+// fft{{{1
+/**
+ * \ingroup Math
+ *
+ * A plan for discrete Fourier transforms of \p n complex (or real) values of type \p T.
+ *
+ * \f[X_k = \sum_{j=0}^{n-1} x_j e^{\mp 2\pi i jk/n}\f]
+ *
+ * with the negative sign for forward() and the positive sign for inverse(). Neither
+ * direction is normalized: `inverse(forward(x))` returns `n * x`.
+ *
+ * \p n must be of the form \f$2^a 3^b 5^c\f$ (see is_supported()). The passes use
+ * radix 8, 4, 2, 5 and 3 butterflies on Vc::complex values in a self-sorting (Stockham)
+ * order, so no bit-reversal permutation is needed. If \p n is a multiple of
+ * \f$W^2\f$ (with \f$W\f$ = \c Vector<T>::Size) a single transform is split into \f$W\f$
+ * transforms of length \f$n/W\f$, one per lane, followed by an in-register transpose and
+ * \f$n/W\f$ transforms of length \f$W\f$ (the "four-step" algorithm). Other sizes are
+ * transformed with scalar arithmetic.
+ *
+ * The batched interface transforms \f$W\f$ independent sequences at once, stored in SoA
+ * layout as Vc::complex vectors (element \c j of the sequence in lane \c l is lane \c l
+ * of `data[j]`). This is the fastest mode for many small transforms.
+ *
+ * The real transforms use the half-length trick: \p n real values are transformed as
+ * \f$n/2\f$ complex values and then untangled into the \f$n/2 + 1\f$ non-redundant
+ * outputs.
+ *
+ * All twiddle factors are precomputed into Vc::Memory. A plan holds scratch space and
+ * must not be used by more than one thread at a time.
+ *
+ * \code
+ * Vc::fft<float> plan(1024);
+ * std::vector<std::complex<float>> spectrum(513);
+ * plan.forward_real(signal.data(), spectrum.data());
+ * \endcode
+ */
+template <typename T> class fft
+{
+    static_assert(std::is_floating_point<T>::value,
+                  "Vc::fft<T> requires T to be float or double.");
+
+public:
+    using value_type = T;
+    /// The vector type of the batched interface.
+    using vector_type = Vector<T>;
+    /// The element type of the batched interface.
+    using complex_vector = Vc::complex<vector_type>;
+
+    /// Returns whether a plan for \p n values can be created.
+    static bool is_supported(std::size_t n)
+    {
+        std::vector<std::size_t> radices;
+        return Detail::fft_factorize(n, radices);
+    }
+
+    /**
+     * Precomputes the twiddle factors for transforms of \p n values.
+     *
+     * \param n The transform size. Must satisfy is_supported().
+     */
+    explicit fft(std::size_t n)
+        : m_rootsRe(n), m_rootsIm(n), m_passes(n, 1), m_lanesRe(lanesSize(n))
+        , m_lanesIm(lanesSize(n))
+    {
+        Vc_ASSERT(is_supported(n));
+        using P = long double;
+        const P step = -2 * P(3.141592653589793238462643383279502884L) / n;
+        for (std::size_t j = 0; j < n; ++j) {
+            m_rootsRe[j] = static_cast<T>(std::cos(step * j));
+            m_rootsIm[j] = static_cast<T>(std::sin(step * j));
+        }
+        if (lanesSize(n) > 1) {
+            const std::size_t rows = n / W;
+            m_outer = Detail::FftPasses(rows, W);
+            m_inner = Detail::FftPasses(W, rows);
+            m_work.resize(2 * rows);
+            for (std::size_t k = 0; k < rows; ++k) {
+                for (std::size_t l = 0; l < W; ++l) {
+                    m_lanesRe[k * W + l] = m_rootsRe[k * l];
+                    m_lanesIm[k * W + l] = m_rootsIm[k * l];
+                }
+            }
+        } else {
+            m_scalarWork.resize(2 * n);
+        }
+    }
+
+    /// Returns the transform size.
+    std::size_t size() const { return m_passes.size(); }
+
+    /**
+     * Transforms the size() values at \p in to the size() values at \p out.
+     * \p in and \p out may point to the same array.
+     */
+    void forward(const std::complex<T> *in, std::complex<T> *out)
+    {
+        transform<false>(in, out);
+    }
+    /// The inverse (unnormalized) transform of forward().
+    void inverse(const std::complex<T> *in, std::complex<T> *out)
+    {
+        transform<true>(in, out);
+    }
+
+    /**
+     * Transforms the size() real values at \p in to the `size() / 2 + 1` values at
+     * \p out. The remaining outputs are the complex conjugates of these. size() must be
+     * even.
+     */
+    void forward_real(const T *in, std::complex<T> *out)
+    {
+        fft &half = half_plan();
+        half.forward(reinterpret_cast<const std::complex<T> *>(in), out);
+        untangle<false>(out);
+    }
+    /**
+     * The inverse (unnormalized) transform of forward_real(): transforms the
+     * `size() / 2 + 1` values at \p in to size() real values at \p out. The imaginary
+     * parts of the first and last input are ignored. size() must be even.
+     */
+    void inverse_real(const std::complex<T> *in, T *out)
+    {
+        fft &half = half_plan();
+        std::complex<T> *z = reinterpret_cast<std::complex<T> *>(out);
+        std::copy(in, in + half.size(), z);
+        z[0] = {in[0].real() + in[half.size()].real(),
+                in[0].real() - in[half.size()].real()};
+        untangle<true>(z);
+        half.inverse(z, z);
+    }
+
+    /**
+     * Transforms the \c vector_type::Size sequences of size() values in \p data in place
+     * (batched mode, one sequence per lane).
+     */
+    void forward(complex_vector *data) { transform<false>(data); }
+    /// The inverse (unnormalized) transform of forward(complex_vector *).
+    void inverse(complex_vector *data) { transform<true>(data); }
+
+private:
+    using V = vector_type;
+    using C = complex_vector;
+    using ScalarComplex = Vc::complex<Vector<T, VectorAbi::Scalar>>;
+    template <typename U> using AlignedVector = std::vector<U, Vc::Allocator<U>>;
+    static constexpr std::size_t W = V::Size;
+
+    // the number of lane twiddle factors of the four-step algorithm, 1 if it is not used
+    static std::size_t lanesSize(std::size_t n)
+    {
+        return n % (W * W) == 0 ? n : 1;
+    }
+
+    fft &half_plan()
+    {
+        Vc_ASSERT(size() % 2 == 0);
+        if (!m_half) {
+            m_half.reset(new fft(size() / 2));
+        }
+        return *m_half;
+    }
+
+    template <bool Inverse>
+    void transform(const std::complex<T> *in, std::complex<T> *out)
+    {
+        if (m_work.empty()) {
+            const std::size_t n = size();
+            ScalarComplex *x = m_scalarWork.data();
+            for (std::size_t i = 0; i < n; ++i) {
+                x[i] = in[i];
+            }
+            const ScalarComplex *r =
+                m_passes.run<Inverse>(x, x + n, m_rootsRe.entries(), m_rootsIm.entries());
+            for (std::size_t i = 0; i < n; ++i) {
+                out[i] = r[i][0];
+            }
+            return;
+        }
+        // Four-step: the input is a (rows × W) matrix, whose columns are transformed
+        // lane-wise, multiplied by the lane twiddle factors, and then transposed in
+        // blocks of W × W for the W-point transforms of the rows.
+        const std::size_t rows = m_outer.size();
+        C *x = m_work.data();
+        for (std::size_t i = 0; i < rows; ++i) {
+            x[i].load(in + i * W);
+        }
+        const C *a =
+            m_outer.run<Inverse>(x, x + rows, m_rootsRe.entries(), m_rootsIm.entries());
+        for (std::size_t k = 0; k < rows; k += W) {
+            V re[W], im[W];
+            for (std::size_t t = 0; t < W; ++t) {
+                const V wRe = m_lanesRe.vector(k + t);
+                const V wIm = m_lanesIm.vector(k + t);
+                const C z = a[k + t] * C(wRe, Inverse ? -wIm : wIm);
+                re[t] = z.real();
+                im[t] = z.imag();
+            }
+            Detail::transpose_square(re);
+            Detail::transpose_square(im);
+            C b[2 * W];
+            for (std::size_t j = 0; j < W; ++j) {
+                b[j] = C(re[j], im[j]);
+            }
+            const C *c =
+                m_inner.run<Inverse>(b, b + W, m_rootsRe.entries(), m_rootsIm.entries());
+            for (std::size_t j = 0; j < W; ++j) {
+                c[j].store(out + k + j * rows);
+            }
+        }
+    }
+
+    template <bool Inverse> void transform(C *data)
+    {
+        const std::size_t n = size();
+        if (m_batch.size() < n) {
+            m_batch.resize(n);
+        }
+        const C *r =
+            m_passes.run<Inverse>(data, m_batch.data(), m_rootsRe.entries(),
+                                  m_rootsIm.entries());
+        if (r != data) {
+            std::copy(r, r + n, data);
+        }
+    }
+
+    /**\internal
+     * Converts between the half-length transform \f$Z\f$ of the even and odd values and
+     * the real transform \f$X\f$, in place on the pairs \f$(k, h - k)\f$:
+     * \f[E = s(Z_k + \bar Z_{h-k}),\quad t = f_k \cdot s(Z_k - \bar Z_{h-k}),\quad
+     *    Z_k' = E + t,\quad Z_{h-k}' = \overline{E - t}\f]
+     * The forward direction uses \f$s = 1/2\f$ and \f$f_k = -i\omega_n^k\f$, the inverse
+     * direction \f$s = 1\f$ and \f$\bar f_k\f$. The k = 0 term is handled by the callers.
+     */
+    template <bool Inverse> void untangle(std::complex<T> *z)
+    {
+        const std::size_t h = size() / 2;
+        const std::complex<T> last(z[0].real() - z[0].imag(), 0);
+        if (!Inverse) {
+            z[0] = {z[0].real() + z[0].imag(), 0};
+        }
+        const T s = Inverse ? T(1) : T(0.5);
+        std::size_t k = 1;
+        for (; 2 * (k + W - 1) < h; k += W) {
+            const std::size_t m = h - k - (W - 1);
+            const C zk(z + k);
+            C zm(z + m);
+            zm = C(zm.real().reversed(), zm.imag().reversed());
+            const V fRe(m_rootsIm.entries() + k, Vc::Unaligned);
+            const V fIm(m_rootsRe.entries() + k, Vc::Unaligned);
+            const C e = (zk + conj(zm)) * V(s);
+            const C t = (zk - conj(zm)) * C(fRe, Inverse ? fIm : -fIm) * V(s);
+            const C lo = e + t, hi = conj(e - t);
+            lo.store(z + k);
+            C(hi.real().reversed(), hi.imag().reversed()).store(z + m);
+        }
+        for (; 2 * k <= h; ++k) {
+            const std::complex<T> zk = z[k], zm = z[h - k];
+            const std::complex<T> f(m_rootsIm[k], Inverse ? m_rootsRe[k] : -m_rootsRe[k]);
+            const std::complex<T> e = (zk + std::conj(zm)) * s;
+            const std::complex<T> t = (zk - std::conj(zm)) * f * s;
+            z[h - k] = std::conj(e - t);
+            z[k] = e + t;
+        }
+        if (!Inverse) {
+            z[h] = last;
+        }
+    }
+
+    Memory<V> m_rootsRe, m_rootsIm;  // ω_n^j
+    Detail::FftPasses m_passes;      // n-point passes (batched and scalar transforms)
+    Memory<V> m_lanesRe, m_lanesIm;  // ω_n^(k·l) for row k and lane l (four-step)
+    Detail::FftPasses m_outer, m_inner;
+    AlignedVector<C> m_work, m_batch;
+    AlignedVector<ScalarComplex> m_scalarWork;
+    std::unique_ptr<fft> m_half;
+};
+template <typename T> constexpr std::size_t fft<T>::W;
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_FFT_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,627 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_FILTERS_H_
+#define VC_COMMON_FILTERS_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "../vector.h"
+#include "deinterleave.h"
+#include "divider.h"
+#include "hash.h"
+#include "malloc.h"
+#include "memory.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+namespace Detail
+{
+// FilterHash{{{1
+/**\internal
+ * The two hashes of a filter key, for single keys and for whole batches. \c first picks
+ * the block (or bucket), \c second the bits (or fingerprint). Both paths use the same
+ * functions from hash.h and therefore agree bit for bit.
+ */
+template <typename Key, std::size_t = sizeof(Key)> struct FilterHash;
+template <typename Key> struct FilterHash<Key, 4> {
+    static Vc_INTRINSIC std::pair<uint, uint> hash(Key k)
+    {
+        const uint h = fmix32(static_cast<uint>(k));
+        return {h, fmix32(h ^ 0x9e3779b9u)};
+    }
+    static Vc_INTRINSIC std::pair<uint_v, uint_v> hash(const Key *k)
+    {
+        const uint_v h = fmix32(uint_v(reinterpret_cast<const uint *>(k), Vc::Unaligned));
+        return {h, fmix32(h ^ 0x9e3779b9u)};
+    }
+};
+template <typename Key> struct FilterHash<Key, 8> {
+    static Vc_INTRINSIC std::pair<uint, uint> hash(Key k)
+    {
+        const uint h = murmur3_32(static_cast<std::uint64_t>(k));
+        return {h, fmix32(h ^ 0x9e3779b9u)};
+    }
+    static Vc_INTRINSIC std::pair<uint_v, uint_v> hash(const Key *k)
+    {
+        uint_v lo, hi;
+        Vc::deinterleave(&lo, &hi, reinterpret_cast<const uint *>(k), Vc::Unaligned);
+        const uint_v h = murmur3_32(lo, hi);
+        return {h, fmix32(h ^ 0x9e3779b9u)};
+    }
+};
+
+// FilterStorage{{{1
+/**\internal
+ * A zero-initialized array of 32-bit words starting on a cache line.
+ */
+class FilterStorage
+{
+public:
+    explicit FilterStorage(std::size_t n = 0)
+        : m_data(n == 0 ? nullptr : Vc::malloc<uint, Vc::AlignOnCacheline>(n)), m_size(n)
+    {
+        std::fill(m_data, m_data + m_size, 0u);
+    }
+    FilterStorage(const FilterStorage &rhs) : FilterStorage(rhs.m_size)
+    {
+        std::copy(rhs.m_data, rhs.m_data + m_size, m_data);
+    }
+    FilterStorage(FilterStorage &&rhs) : m_data(rhs.m_data), m_size(rhs.m_size)
+    {
+        rhs.m_data = nullptr;
+        rhs.m_size = 0;
+    }
+    FilterStorage &operator=(FilterStorage rhs)
+    {
+        std::swap(m_data, rhs.m_data);
+        std::swap(m_size, rhs.m_size);
+        return *this;
+    }
+    ~FilterStorage() { Vc::free(m_data); }
+
+    std::size_t size() const { return m_size; }
+    uint *data() { return m_data; }
+    const uint *data() const { return m_data; }
+    uint &operator[](std::size_t i) { return m_data[i]; }
+    const uint &operator[](std::size_t i) const { return m_data[i]; }
+    void clear() { std::fill(m_data, m_data + m_size, 0u); }
+
+private:
+    uint *m_data;
+    std::size_t m_size;
+};
+
+// setBits{{{1
+/**\internal
+ * Stores the results for the keys at offset \p i (a multiple of \p M::Size) into the
+ * bitmap \p bits and returns their number.
+ */
+template <typename M>
+Vc_INTRINSIC std::size_t setBits(std::uint64_t *bits, std::size_t i, const M &hits)
+{
+    const std::uint64_t m = static_cast<unsigned>(hits.toInt());
+    if (i % 64 == 0) {
+        bits[i / 64] = m;
+    } else {
+        bits[i / 64] |= m << (i % 64);
+    }
+    return hits.count();
+}
+Vc_INTRINSIC std::size_t setBits(std::uint64_t *bits, std::size_t i, bool hit)
+{
+    if (i % 64 == 0) {
+        bits[i / 64] = 0;
+    }
+    bits[i / 64] |= std::uint64_t(hit) << (i % 64);
+    return hit;
+}
+//}}}1
+}  // namespace Detail
+
+// blocked_bloom_filter{{{1
+/**
+ * \ingroup Utilities
+ * \headerfile filters.h <Vc/filters>
+ *
+ * A Bloom filter for 32- and 64-bit integer keys whose bits are grouped into blocks of
+ * one cache line (16 words of 32 bits). A key sets eight bits, all in the block selected
+ * by its first hash, one in each pair of words. A membership test therefore costs at most
+ * one cache miss, and the bits of a key can be tested in registers.
+ *
+ * The batched contains() hashes a full \c uint_v of keys at once, gathers the words of
+ * their blocks and tests one bit per key and gather. The \c uint_v::Size cache misses of
+ * a batch overlap, and a batch stops as soon as all of its keys are rejected, which is
+ * the common case when pre-filtering a join:
+ *
+ * \code
+ * Vc::blocked_bloom_filter<std::uint64_t> filter(buildKeys.size());
+ * filter.insert(buildKeys.data(), buildKeys.size());
+ * std::vector<std::uint64_t> bits((probeKeys.size() + 63) / 64);
+ * filter.contains(probeKeys.data(), probeKeys.size(), bits.data());
+ * \endcode
+ *
+ * At the default of 12 bits per key the false positive rate is about 0.5%; 8 bits per key
+ * give about 3%. There are no false negatives. Keys cannot be removed.
+ *
+ * \tparam Key A 32- or 64-bit integer type.
+ */
+template <typename Key> class blocked_bloom_filter
+{
+    static_assert(std::is_integral<Key>::value && (sizeof(Key) == 4 || sizeof(Key) == 8),
+                  "Vc::blocked_bloom_filter<Key> requires a 32- or 64-bit integer Key.");
+    using Hash = Detail::FilterHash<Key>;
+
+public:
+    using key_type = Key;
+    using size_type = std::size_t;
+
+    /// The number of 32-bit words per block: one cache line.
+    static constexpr size_type BlockWords = 16;
+    /// The number of bits set per key.
+    static constexpr size_type Probes = BlockWords / 2;
+
+    /// Creates an empty filter with \p bitsPerKey bits for each of \p expected keys.
+    explicit blocked_bloom_filter(size_type expected, double bitsPerKey = 12)
+        : m_blocks(std::max<size_type>(
+              1, static_cast<size_type>(expected * bitsPerKey / (BlockWords * 32)) + 1)),
+          m_words(m_blocks * BlockWords)
+    {
+    }
+
+    /// Returns the number of blocks.
+    size_type block_count() const { return m_blocks; }
+    /// Returns the size of the bit array in bytes.
+    size_type size_in_bytes() const { return m_words.size() * sizeof(uint); }
+
+    /// Removes all keys.
+    void clear() { m_words.clear(); }
+
+    /// Adds \p key.
+    void insert(const Key &key)
+    {
+        const auto h = Hash::hash(key);
+        const size_type block = blockIndex(h.first);
+        for (size_type j = 0; j < Probes; ++j) {
+            m_words[block + word(h.second, j)] |= bit(h.second, j);
+        }
+    }
+
+    /**
+     * Adds \p n keys. They are hashed and their words and bits computed a full \c uint_v
+     * at a time; the bits are then set key by key, since several keys of a batch may set
+     * bits in the same word.
+     */
+    void insert(const Key *keys, size_type n)
+    {
+        size_type i = 0;
+        for (; i + uint_v::Size <= n; i += uint_v::Size) {
+            const auto h = Hash::hash(keys + i);
+            const uint_v block = blockIndex(h.first);
+            for (size_type j = 0; j < Probes; ++j) {
+                const uint_v index = block + word(h.second, j);
+                const uint_v mask = bit(h.second, j);
+                for (size_type k = 0; k < uint_v::Size; ++k) {
+                    m_words[index[k]] |= mask[k];
+                }
+            }
+        }
+        for (; i < n; ++i) {
+            insert(keys[i]);
+        }
+    }
+
+    /// Returns whether \p key may have been added. \c false is always correct.
+    bool contains(const Key &key) const
+    {
+        const auto h = Hash::hash(key);
+        const size_type block = blockIndex(h.first);
+        for (size_type j = 0; j < Probes; ++j) {
+            if ((m_words[block + word(h.second, j)] & bit(h.second, j)) == 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Tests \p n keys. Sets bit `i % 64` of `bits[i / 64]` iff `keys[i]` may have been
+     * added. \p bits must have room for `(n + 63) / 64` words. Unused bits of the last
+     * word are cleared.
+     *
+     * \return The number of keys that may have been added.
+     */
+    size_type contains(const Key *keys, size_type n, std::uint64_t *bits) const
+    {
+        size_type count = 0;
+        size_type i = 0;
+        for (; i + uint_v::Size <= n; i += uint_v::Size) {
+            const auto h = Hash::hash(keys + i);
+            const uint_v block = blockIndex(h.first);
+            uint_m hits(true);
+            for (size_type j = 0; j < Probes && !hits.isEmpty(); ++j) {
+                const uint_v words(m_words.data(), block + word(h.second, j));
+                hits &= (words & bit(h.second, j)) != 0;
+            }
+            count += Detail::setBits(bits, i, hits);
+        }
+        for (; i < n; ++i) {
+            count += Detail::setBits(bits, i, contains(keys[i]));
+        }
+        return count;
+    }
+
+private:
+    // Multiplicative range reduction: the high half of h * blocks is uniform in
+    // [0, blocks) without a division.
+    Vc_INTRINSIC size_type blockIndex(uint h) const
+    {
+        return static_cast<size_type>((std::uint64_t(h) * m_blocks) >> 32) * BlockWords;
+    }
+    Vc_INTRINSIC uint_v blockIndex(const uint_v &h) const
+    {
+        return Vc::mulhi(h, uint_v(uint(m_blocks))) * uint(BlockWords);
+    }
+
+    // Probe j uses word 2j or 2j + 1 of the block and one of its 32 bits, picked by the
+    // top five bits of the second hash times an odd salt.
+    static constexpr uint salt(size_type j)
+    {
+        return j == 0 ? 0x47b6137bu : j == 1 ? 0x44974d91u : j == 2 ? 0x8824ad5bu
+             : j == 3 ? 0xa2b7289du : j == 4 ? 0x705495c7u : j == 5 ? 0x2df1424bu
+             : j == 6 ? 0x9efc4947u : 0x5c6bfb31u;
+    }
+    template <typename U> static Vc_INTRINSIC U word(const U &h, size_type j)
+    {
+        return uint(2 * j) + ((h >> int(j)) & 1u);
+    }
+    static Vc_INTRINSIC uint bit(uint h, size_type j)
+    {
+        return 1u << ((h * salt(j)) >> 27);
+    }
+    static Vc_INTRINSIC uint_v bit(const uint_v &h, size_type j)
+    {
+        return uint_v(1u) << ((h * salt(j)) >> 27);
+    }
+
+    size_type m_blocks;
+    Detail::FilterStorage m_words;
+};
+template <typename Key> constexpr std::size_t blocked_bloom_filter<Key>::BlockWords;
+template <typename Key> constexpr std::size_t blocked_bloom_filter<Key>::Probes;
+
+// cuckoo_filter{{{1
+/**
+ * \ingroup Utilities
+ * \headerfile filters.h <Vc/filters>
+ *
+ * A cuckoo filter for 32- and 64-bit integer keys: every key is represented by a 16-bit
+ * fingerprint stored in one of two buckets of four slots. The second bucket is derived
+ * from the first and the fingerprint, so that fingerprints can be moved between their
+ * buckets to make room. Unlike a Bloom filter it supports erase().
+ *
+ * The batched contains() hashes a full \c uint_v of keys at once, gathers both buckets of
+ * every key (two words each) and compares all eight slots with the fingerprints in
+ * registers.
+ *
+ * The false positive rate is about 8 / 2^16, i.e. 0.012%, at 4 bytes per bucket slot.
+ * Inserting fails once the filter is close to full (about 95% of the slots).
+ *
+ * \tparam Key A 32- or 64-bit integer type.
+ */
+template <typename Key> class cuckoo_filter
+{
+    static_assert(std::is_integral<Key>::value && (sizeof(Key) == 4 || sizeof(Key) == 8),
+                  "Vc::cuckoo_filter<Key> requires a 32- or 64-bit integer Key.");
+    using Hash = Detail::FilterHash<Key>;
+
+public:
+    using key_type = Key;
+    using size_type = std::size_t;
+
+    /// The number of fingerprints per bucket.
+    static constexpr size_type BucketSlots = 4;
+    /// The number of fingerprints an insertion relocates before it gives up.
+    static constexpr size_type MaxKicks = 500;
+
+    /// Creates an empty filter with room for \p expected keys at 90% load.
+    explicit cuckoo_filter(size_type expected)
+        : m_buckets(bucketCount(expected)), m_slots(2 * m_buckets)
+    {
+    }
+
+    /// Returns the number of stored fingerprints.
+    size_type size() const { return m_size; }
+    /// Returns the number of fingerprint slots.
+    size_type capacity() const { return m_buckets * BucketSlots; }
+    /// Returns the size of the bucket array in bytes.
+    size_type size_in_bytes() const { return m_slots.size() * sizeof(uint); }
+    /// Returns whether an insertion failed, so that no further key can be added until a
+    /// key is erased or the filter is cleared.
+    bool full() const { return m_hasVictim; }
+
+    /// Removes all keys.
+    void clear()
+    {
+        m_slots.clear();
+        m_size = 0;
+        m_hasVictim = false;
+    }
+
+    /**
+     * Adds \p key. Returns \c false if the filter is full. The key is still found
+     * afterwards, but no further key can be added.
+     */
+    bool insert(const Key &key)
+    {
+        const auto h = Hash::hash(key);
+        return insertFingerprint(bucket(h.first), fingerprint(h.second));
+    }
+
+    /**
+     * Adds \p n keys, hashing a full \c uint_v at a time, until the filter becomes full.
+     *
+     * \return The number of keys consumed from \p keys. If full() is \c true afterwards,
+     * the last consumed key is the one that did not fit; like with insert(const Key &) it
+     * is still found. A full filter consumes no keys.
+     */
+    size_type insert(const Key *keys, size_type n)
+    {
+        if (m_hasVictim) {
+            return 0;
+        }
+        size_type i = 0;
+        for (; i + uint_v::Size <= n; i += uint_v::Size) {
+            const auto h = Hash::hash(keys + i);
+            const uint_v b = bucket(h.first);
+            const uint_v fp = fingerprint(h.second);
+            for (size_type k = 0; k < uint_v::Size; ++k) {
+                if (!insertFingerprint(b[k], fp[k])) {
+                    return i + k + 1;
+                }
+            }
+        }
+        for (; i < n; ++i) {
+            if (!insert(keys[i])) {
+                return i + 1;
+            }
+        }
+        return n;
+    }
+
+    /// Returns whether \p key may have been added. \c false is always correct.
+    bool contains(const Key &key) const
+    {
+        const auto h = Hash::hash(key);
+        const uint i1 = bucket(h.first);
+        const uint fp = fingerprint(h.second);
+        const uint i2 = alternate(i1, fp);
+        return matches(m_slots[2 * i1], fp) || matches(m_slots[2 * i1 + 1], fp) ||
+               matches(m_slots[2 * i2], fp) || matches(m_slots[2 * i2 + 1], fp) ||
+               (m_hasVictim && m_victimFingerprint == fp &&
+                (m_victimBucket == i1 || m_victimBucket == i2));
+    }
+
+    /**
+     * Tests \p n keys. Sets bit `i % 64` of `bits[i / 64]` iff `keys[i]` may have been
+     * added. \p bits must have room for `(n + 63) / 64` words. Unused bits of the last
+     * word are cleared.
+     *
+     * \return The number of keys that may have been added.
+     */
+    size_type contains(const Key *keys, size_type n, std::uint64_t *bits) const
+    {
+        size_type count = 0;
+        size_type i = 0;
+        for (; i + uint_v::Size <= n; i += uint_v::Size) {
+            const auto h = Hash::hash(keys + i);
+            const uint_v i1 = bucket(h.first);
+            const uint_v fp = fingerprint(h.second);
+            const uint_v i2 = alternate(i1, fp);
+            const uint *slots = m_slots.data();
+            uint_m hits = matches(uint_v(slots, i1 + i1), fp) |
+                          matches(uint_v(slots, i1 + i1 + 1u), fp) |
+                          matches(uint_v(slots, i2 + i2), fp) |
+                          matches(uint_v(slots, i2 + i2 + 1u), fp);
+            if (m_hasVictim) {
+                hits |= (fp == m_victimFingerprint) &
+                        ((i1 == m_victimBucket) | (i2 == m_victimBucket));
+            }
+            count += Detail::setBits(bits, i, hits);
+        }
+        for (; i < n; ++i) {
+            count += Detail::setBits(bits, i, contains(keys[i]));
+        }
+        return count;
+    }
+
+    /**
+     * Removes one fingerprint of \p key. Only keys that were added may be erased:
+     * otherwise the fingerprint of a different key may be removed.
+     *
+     * \return Whether a fingerprint was removed.
+     */
+    bool erase(const Key &key)
+    {
+        const auto h = Hash::hash(key);
+        const uint i1 = bucket(h.first);
+        const uint fp = fingerprint(h.second);
+        if (m_hasVictim && m_victimFingerprint == fp &&
+            (m_victimBucket == i1 || m_victimBucket == alternate(i1, fp))) {
+            m_hasVictim = false;
+            --m_size;
+            return true;
+        }
+        if (!eraseFingerprint(i1, fp) && !eraseFingerprint(alternate(i1, fp), fp)) {
+            return false;
+        }
+        --m_size;
+        if (m_hasVictim) {
+            // there is room again for the fingerprint that did not fit
+            m_hasVictim = false;
+            --m_size;
+            insertFingerprint(m_victimBucket, m_victimFingerprint);
+        }
+        return true;
+    }
+
+private:
+    static size_type bucketCount(size_type expected)
+    {
+        size_type n = 1;
+        while (n * BucketSlots * 9 < expected * 10) {
+            n *= 2;
+        }
+        return n;
+    }
+    Vc_INTRINSIC uint mask() const { return uint(m_buckets - 1); }
+
+    template <typename U> Vc_INTRINSIC U bucket(const U &h) const { return h & mask(); }
+    // 0 marks an empty slot
+    static Vc_INTRINSIC uint fingerprint(uint h)
+    {
+        const uint fp = h >> 16;
+        return fp == 0 ? 1u : fp;
+    }
+    static Vc_INTRINSIC uint_v fingerprint(const uint_v &h)
+    {
+        const uint_v fp = h >> 16;
+        return iif(fp == 0u, uint_v(1u), fp);
+    }
+    // The alternate bucket is an involution of the bucket for a given fingerprint, so
+    // that either bucket can be computed from the other.
+    template <typename U> Vc_INTRINSIC U alternate(const U &i, const U &fp) const
+    {
+        return (i ^ fmix32(fp)) & mask();
+    }
+
+    // Every bucket is two words with two 16-bit slots each.
+    static Vc_INTRINSIC bool matches(uint w, uint fp)
+    {
+        return (w & 0xffffu) == fp || (w >> 16) == fp;
+    }
+    static Vc_INTRINSIC uint_m matches(const uint_v &w, const uint_v &fp)
+    {
+        return ((w & 0xffffu) == fp) | ((w >> 16) == fp);
+    }
+    Vc_INTRINSIC uint slot(uint b, size_type s) const
+    {
+        return (m_slots[2 * b + s / 2] >> (16 * (s % 2))) & 0xffffu;
+    }
+    Vc_INTRINSIC void setSlot(uint b, size_type s, uint fp)
+    {
+        uint &w = m_slots[2 * b + s / 2];
+        const int shift = 16 * (s % 2);
+        w = (w & ~(0xffffu << shift)) | (fp << shift);
+    }
+
+    bool tryPlace(uint b, uint fp)
+    {
+        for (size_type s = 0; s < BucketSlots; ++s) {
+            if (slot(b, s) == 0) {
+                setSlot(b, s, fp);
+                return true;
+            }
+        }
+        return false;
+    }
+    bool eraseFingerprint(uint b, uint fp)
+    {
+        for (size_type s = 0; s < BucketSlots; ++s) {
+            if (slot(b, s) == fp) {
+                setSlot(b, s, 0);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Places fp into bucket i1 or its alternate. If both are full, a random fingerprint
+    // of one of them is evicted to its own alternate bucket, up to MaxKicks times. The
+    // last evicted fingerprint is kept as the victim, so that no key is lost.
+    bool insertFingerprint(uint i1, uint fp)
+    {
+        if (m_hasVictim) {
+            return false;
+        }
+        ++m_size;
+        const uint i2 = alternate(i1, fp);
+        if (tryPlace(i1, fp) || tryPlace(i2, fp)) {
+            return true;
+        }
+        uint b = (nextRandom() & 1) ? i1 : i2;
+        for (size_type kick = 0; kick < MaxKicks; ++kick) {
+            const size_type s = nextRandom() % BucketSlots;
+            const uint evicted = slot(b, s);
+            setSlot(b, s, fp);
+            fp = evicted;
+            b = alternate(b, fp);
+            if (tryPlace(b, fp)) {
+                return true;
+            }
+        }
+        m_hasVictim = true;
+        m_victimBucket = b;
+        m_victimFingerprint = fp;
+        return false;
+    }
+
+    // xorshift32
+    uint nextRandom()
+    {
+        m_random ^= m_random << 13;
+        m_random ^= m_random >> 17;
+        m_random ^= m_random << 5;
+        return m_random;
+    }
+
+    size_type m_buckets;
+    Detail::FilterStorage m_slots;
+    size_type m_size = 0;
+    uint m_random = 0x9e3779b9u;
+    bool m_hasVictim = false;
+    uint m_victimBucket = 0;
+    uint m_victimFingerprint = 0;
+};
+template <typename Key> constexpr std::size_t cuckoo_filter<Key>::BucketSlots;
+template <typename Key> constexpr std::size_t cuckoo_filter<Key>::MaxKicks;
+//}}}1
+}  // namespace Common
+
+using Common::blocked_bloom_filter;
+using Common::cuckoo_filter;
+}  // namespace Vc
+
+#endif  // VC_COMMON_FILTERS_H_
+
+// vim: foldmethod=marker
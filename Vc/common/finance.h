@@ -0,0 +1,539 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_FINANCE_H_
+#define VC_COMMON_FINANCE_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include "../vector.h"
+#include "../Allocator"
+#include "divider.h"
+#include "memory.h"
+#include "parallel.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ *
+ * Option pricing on float_v and double_v: the normal distribution, Black-Scholes prices
+ * and greeks for batches of options stored as structure of arrays in Vc::Memory, and a
+ * Monte Carlo engine for geometric Brownian motion paths.
+ *
+ * The batch functions split their input into one chunk per thread, for \p threads
+ * threads (0 selects `std::thread::hardware_concurrency()`); small batches are processed
+ * on the calling thread.
+ *
+ * \code
+ * Vc::finance::option_batch<double> options(n);
+ * // fill options.spot, options.strike, ...
+ * Vc::Memory<Vc::double_v> price(n);
+ * Vc::finance::black_scholes(options, Vc::finance::option_type::call, price);
+ * \endcode
+ */
+namespace finance
+{
+namespace Detail
+{
+template <typename V>
+using enable_if_floating = enable_if<
+    Traits::is_simd_vector<V>::value &&
+        std::is_floating_point<typename V::EntryType>::value,
+    V>;
+
+// erfc_positive{{{1
+/**\internal
+ * \f$\ln(e^{z^2}\mathrm{erfc}(z) / t)\f$ with \f$t = 2 / (2 + z)\f$ is smooth for all
+ * \f$z \ge 0\f$ and vanishes at \f$z = 0\f$, i.e. at \f$x = 2t - 1 = 1\f$. It is stored
+ * as \f$(x - 1)\,r(x)\f$, where \f$r\f$ is the monomial form of the truncated Chebyshev
+ * series (14 terms for single, 28 for double precision) divided by \f$x - 1\f$. The
+ * coefficients sum to less than 1 in magnitude, so the monomial form loses nothing to
+ * cancellation, and erfc(0) comes out as exactly 1.
+ */
+constexpr double erfc_poly_float[13] = {
+     6.71794086277373914e-01, -8.49134268634483993e-04, -4.81925517897019845e-02,
+    -1.29706962870698391e-03,  8.57746528958439232e-03, -2.46092888060648186e-04,
+    -2.01675900669031922e-03,  3.22518717362272711e-04,  5.05300859078285374e-04,
+    -1.52652988692738141e-04, -1.20539216380612666e-04,  3.40945744490532627e-05,
+     2.07230709577788183e-05};
+constexpr double erfc_poly_double[27] = {
+     6.71794084056692276e-01, -8.49139920964463277e-04, -4.81924467628688930e-02,
+    -1.29683653169359518e-03,  8.57585283469636424e-03, -2.49085722364259736e-04,
+    -2.00801928016327560e-03,  3.37793220319577547e-04,  4.84040083697580910e-04,
+    -1.89638711882654038e-04, -9.59036807116723388e-05,  7.83992664914038743e-05,
+     6.99825236383356986e-06, -2.47469273856038336e-05,  5.44095716579041009e-06,
+     5.30323052444576599e-06, -3.25939289567551919e-06, -3.11406018677260084e-07,
+     9.60905886191609810e-07, -2.89121775065365497e-07, -1.20623767858832497e-07,
+     1.28959508313134210e-07, -2.43839508959475671e-08, -2.58288167005728345e-08,
+     1.33430038096990239e-08,  2.17065154607526645e-09, -1.89023060089445374e-09};
+
+inline const double *erfc_poly(float) { return erfc_poly_float; }
+inline const double *erfc_poly(double) { return erfc_poly_double; }
+
+/// erfc(\p z) for \p z ≥ 0, without branches.
+template <typename V> Vc_INTRINSIC V erfc_positive(const V &z)
+{
+    using T = typename V::EntryType;
+    constexpr int n = sizeof(T) == sizeof(float) ? 13 : 27;
+    const double *c = erfc_poly(T());
+    const V t = V(T(2)) / (V(T(2)) + z);
+    const V x = t + t - V(T(1));
+    const V xx = x * x;
+    // even and odd coefficients as two independent Horner chains in x²
+    V even = V(T(c[n - 1])), odd = V(T(c[n - 2]));
+    for (int j = n - 3; j > 0; j -= 2) {
+        even = even * xx + V(T(c[j]));
+        odd = odd * xx + V(T(c[j - 1]));
+    }
+    even = even * xx + V(T(c[0]));
+    // x - 1 = -z t
+    return t * exp(-z * (t * (odd * x + even) + z));
+}
+
+// inverse_normal_cdf_lower{{{1
+/**\internal
+ * The quantile of \p p ≤ 1/2 by P. J. Acklam's rational approximations (relative error
+ * below 1.2e-9), for lanes with \p p = 0 too. His central rational function cancels in
+ * single precision, where M. Giles' erfinv polynomial ("Approximating the erfinv
+ * function", GPU Computing Gems, 2011) is used instead.
+ */
+template <typename V> Vc_INTRINSIC V inverse_normal_cdf_lower(const V &p)
+{
+    using T = typename V::EntryType;
+    constexpr T low = T(0.02425);
+    const auto poly = [](const V &x, std::initializer_list<double> c) {
+        V r = V::Zero();
+        for (double ci : c) {
+            r = r * x + V(T(ci));
+        }
+        return r;
+    };
+    V x;
+    if (sizeof(T) == sizeof(float)) {
+        // √2 erfinv(2p - 1), with (1 - (2p - 1)²) = 4p(1 - p)
+        const V w = -log(V(T(4)) * p * (V(T(1)) - p)) - V(T(2.5));
+        x = (p + p - V(T(1))) * V(T(1.41421356237309504880168872421)) *
+            poly(w, {2.81022636e-08, 3.43273939e-07, -3.5233877e-06, -4.39150654e-06,
+                     0.00021858087, -0.00125372503, -0.00417768164, 0.246640727,
+                     1.50140941});
+    } else {
+        const V q = p - V(T(0.5));
+        const V r = q * q;
+        x = q * poly(r, {-3.969683028665376e+01, 2.209460984245205e+02,
+                         -2.759285104469687e+02, 1.383577518672690e+02,
+                         -3.066479806614716e+01, 2.506628277459239e+00}) /
+            poly(r, {-5.447609879822406e+01, 1.615858368580409e+02,
+                     -1.556989798598866e+02, 6.680131188771972e+01,
+                     -1.328068155288572e+01, 1.});
+    }
+    const auto tail = p < V(low);
+    if (any_of(tail)) {
+        const V s = sqrt(V(T(-2)) * log(iif(tail, p, V(low))));
+        x(tail) = poly(s, {-7.784894002430293e-03, -3.223964580411365e-01,
+                           -2.400758277161838e+00, -2.549732539343734e+00,
+                           4.374664141464968e+00, 2.938163982698783e+00}) /
+                  poly(s, {7.784695709041462e-03, 3.224671290700398e-01,
+                           2.445134137142996e+00, 3.754408661907416e+00, 1.});
+    }
+    return x;
+}
+}  // namespace Detail
+
+// normal_pdf / normal_cdf / inverse_normal_cdf{{{1
+/// The density of the standard normal distribution.
+template <typename V> inline Detail::enable_if_floating<V> normal_pdf(const V &x)
+{
+    using T = typename V::EntryType;
+    return exp(V(T(-0.5)) * x * x) * V(T(0.398942280401432677939946059934));
+}
+
+/**
+ * The cumulative distribution function of the standard normal distribution,
+ * \f$\Phi(x) = \frac{1}{2}\mathrm{erfc}(-x / \sqrt 2)\f$. The lower tail is accurate
+ * relative to the result, down to the smallest normal numbers, with an error of about
+ * \f$1 + x^2\f$ ulp: the sensitivity of \f$\Phi\f$ to the rounding of \p x.
+ */
+template <typename V> inline Detail::enable_if_floating<V> normal_cdf(const V &x)
+{
+    using T = typename V::EntryType;
+    const V z = abs(x) * V(T(0.707106781186547524400844362105));
+    const V e = V(T(0.5)) * Detail::erfc_positive(z);
+    return iif(x < V::Zero(), e, V(T(1)) - e);
+}
+
+/**
+ * The quantile function of the standard normal distribution, \f$\Phi^{-1}(p)\f$, with
+ * \f$\Phi^{-1}(0) = -\infty\f$ and \f$\Phi^{-1}(1) = \infty\f$. Double precision results
+ * are refined by one Halley step to full precision.
+ */
+template <typename V> inline Detail::enable_if_floating<V> inverse_normal_cdf(const V &p)
+{
+    using T = typename V::EntryType;
+    // the lower half is accurate also for p close to 1, where 1 - p is exact
+    const auto upper = p > V(T(0.5));
+    const V lower = iif(upper, V(T(1)) - p, p);
+    V x = Detail::inverse_normal_cdf_lower(lower);
+    if (sizeof(T) == sizeof(double)) {
+        const V z = x * V(T(-0.707106781186547524400844362105));
+        const V e = V(T(0.5)) * Detail::erfc_positive(z) - lower;
+        const V u = e * V(T(2.50662827463100050241576528481)) * exp(V(T(0.5)) * x * x);
+        x -= u / (V(T(1)) + V(T(0.5)) * x * u);
+    }
+    x(lower == V::Zero()) = -std::numeric_limits<T>::infinity();
+    return iif(upper, -x, x);
+}
+
+// option_type / option_batch / option_greeks{{{1
+/// The right of the holder: to buy (call) or to sell (put) at the strike.
+enum class option_type { call, put };
+
+/**
+ * A batch of European options as structure of arrays. Rates and yields are continuously
+ * compounded per year, the volatility is annualized and the expiry is in years.
+ */
+template <typename T> class option_batch
+{
+public:
+    using V = Vector<T>;
+
+    /// Allocates room for \p n options. All parameters are zero.
+    explicit option_batch(std::size_t n)
+        : spot(n), strike(n), rate(n), dividend(n), volatility(n), expiry(n)
+    {
+    }
+
+    /// The number of options.
+    std::size_t count() const { return spot.entriesCount(); }
+
+    Memory<V> spot;        ///< The price of the underlying.
+    Memory<V> strike;      ///< The strike price.
+    Memory<V> rate;        ///< The risk-free interest rate.
+    Memory<V> dividend;    ///< The dividend yield of the underlying.
+    Memory<V> volatility;  ///< The volatility of the underlying.
+    Memory<V> expiry;      ///< The time to expiry.
+};
+
+/// The prices and sensitivities of a batch of options; theta is per year.
+template <typename T> class option_greeks
+{
+public:
+    using V = Vector<T>;
+
+    /// Allocates room for the results of \p n options.
+    explicit option_greeks(std::size_t n)
+        : price(n), delta(n), gamma(n), vega(n), theta(n), rho(n)
+    {
+    }
+
+    Memory<V> price;  ///< The fair value.
+    Memory<V> delta;  ///< ∂price/∂spot.
+    Memory<V> gamma;  ///< ∂²price/∂spot².
+    Memory<V> vega;   ///< ∂price/∂volatility.
+    Memory<V> theta;  ///< -∂price/∂expiry.
+    Memory<V> rho;    ///< ∂price/∂rate.
+};
+
+// black_scholes_price{{{1
+/**
+ * The Black-Scholes-Merton price of European options of \p type, one per lane.
+ */
+template <typename V>
+inline Detail::enable_if_floating<V> black_scholes_price(
+    option_type type, const V &spot, const V &strike, const V &rate, const V &dividend,
+    const V &volatility, const V &expiry)
+{
+    using T = typename V::EntryType;
+    const V s(T(type == option_type::call ? 1 : -1));
+    const V sd = volatility * sqrt(expiry);
+    const V d1 = (log(spot / strike) + (rate - dividend) * expiry) / sd + V(T(0.5)) * sd;
+    const V forward = spot * exp(-dividend * expiry);
+    const V discounted = strike * exp(-rate * expiry);
+    return s * (forward * normal_cdf(s * d1) - discounted * normal_cdf(s * (d1 - sd)));
+}
+
+namespace Detail
+{
+/**\internal
+ * Calls `f(i)` for every vector index of \p count entries, split into chunks for \p
+ * threads threads of at least 4Ki entries.
+ */
+template <typename V, typename F>
+inline void for_each_vector(std::size_t count, unsigned threads, F &&f)
+{
+    const std::size_t vectors = (count + V::Size - 1) / V::Size;
+    const unsigned nthreads = Common::thread_count(vectors, threads, 4096 / V::Size);
+    Common::parallel_chunks(vectors, nthreads, 1,
+                            [&](unsigned, std::size_t first, std::size_t last) {
+                                for (std::size_t i = first; i < last; ++i) {
+                                    f(i);
+                                }
+                            });
+}
+}  // namespace Detail
+
+// black_scholes{{{1
+/// Writes the prices of \p options of \p type to \p price.
+template <typename T>
+inline void black_scholes(const option_batch<T> &options, option_type type,
+                          Memory<Vector<T>> &price, unsigned threads = 0)
+{
+    using V = Vector<T>;
+    Vc_ASSERT(price.entriesCount() >= options.count());
+    Detail::for_each_vector<V>(options.count(), threads, [&](std::size_t i) {
+        price.vector(i) = black_scholes_price(
+            type, V(options.spot.vector(i)), V(options.strike.vector(i)),
+            V(options.rate.vector(i)), V(options.dividend.vector(i)),
+            V(options.volatility.vector(i)), V(options.expiry.vector(i)));
+    });
+}
+
+/// Writes the prices and greeks of \p options of \p type to \p out.
+template <typename T>
+inline void black_scholes(const option_batch<T> &options, option_type type,
+                          option_greeks<T> &out, unsigned threads = 0)
+{
+    using V = Vector<T>;
+    Vc_ASSERT(out.price.entriesCount() >= options.count());
+    Detail::for_each_vector<V>(options.count(), threads, [&](std::size_t i) {
+        const V spot = options.spot.vector(i), strike = options.strike.vector(i);
+        const V rate = options.rate.vector(i), dividend = options.dividend.vector(i);
+        const V expiry = options.expiry.vector(i);
+        const V volatility = options.volatility.vector(i);
+        const V s(T(type == option_type::call ? 1 : -1));
+        const V root = sqrt(expiry);
+        const V sd = volatility * root;
+        const V d1 =
+            (log(spot / strike) + (rate - dividend) * expiry) / sd + V(T(0.5)) * sd;
+        const V growth = exp(-dividend * expiry), discount = exp(-rate * expiry);
+        const V n1 = normal_cdf(s * d1), n2 = normal_cdf(s * (d1 - sd));
+        const V forward = spot * growth, discounted = strike * discount;
+        const V density = forward * normal_pdf(d1);  // S e^{-qT} φ(d1)
+        out.price.vector(i) = s * (forward * n1 - discounted * n2);
+        out.delta.vector(i) = s * growth * n1;
+        out.gamma.vector(i) = density / (spot * spot * sd);
+        out.vega.vector(i) = density * root;
+        out.theta.vector(i) = s * (dividend * forward * n1 - rate * discounted * n2) -
+                              density * volatility / (root + root);
+        out.rho.vector(i) = s * expiry * discounted * n2;
+    });
+}
+
+// philox4x32{{{1
+namespace Detail
+{
+/**\internal
+ * Philox4x32-10 (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3", SC11):
+ * replaces the counters \p c of every lane by four random words under the key \p k0, \p
+ * k1. Distinct counters give independent words, so every path of the Monte Carlo engine
+ * has its own stream, whatever the vector width and thread count.
+ */
+Vc_INTRINSIC void philox4x32(uint_v (&c)[4], uint_v k0, uint_v k1)
+{
+    const uint_v m0(0xD2511F53u), m1(0xCD9E8D57u);
+    for (int round = 0; round < 10; ++round) {
+        const uint_v hi0 = mulhi(c[0], m0), lo0 = c[0] * m0;
+        const uint_v hi1 = mulhi(c[2], m1), lo1 = c[2] * m1;
+        c[0] = hi1 ^ c[1] ^ k0;
+        c[1] = lo1;
+        c[2] = hi0 ^ c[3] ^ k1;
+        c[3] = lo0;
+        k0 += uint_v(0x9E3779B9u);
+        k1 += uint_v(0xBB67AE85u);
+    }
+}
+}  // namespace Detail
+
+// gbm / mc_result / payoffs{{{1
+/**
+ * Geometric Brownian motion: \f$dS = (r - q) S\,dt + \sigma S\,dW\f$ under the
+ * risk-neutral measure.
+ */
+template <typename T> struct gbm {
+    T spot;        ///< The initial price.
+    T rate;        ///< The risk-free interest rate.
+    T dividend;    ///< The dividend yield.
+    T volatility;  ///< The volatility.
+};
+
+/// The estimate of monte_carlo.
+template <typename T> struct mc_result {
+    T price;           ///< The discounted mean payoff.
+    T standard_error;  ///< The standard deviation of \c price.
+};
+
+/// The payoff of a European option: only the final price matters.
+template <typename T> struct european {
+    option_type type;
+    T strike;
+
+    Vector<T> operator()(const Vector<T> *path, std::size_t steps) const
+    {
+        const Vector<T> s(T(type == option_type::call ? 1 : -1));
+        return max(s * (path[steps - 1] - Vector<T>(strike)), Vector<T>::Zero());
+    }
+};
+
+/// The payoff of an arithmetic average price (Asian) option over all time steps.
+template <typename T> struct asian {
+    option_type type;
+    T strike;
+
+    Vector<T> operator()(const Vector<T> *path, std::size_t steps) const
+    {
+        Vector<T> sum = Vector<T>::Zero();
+        for (std::size_t i = 0; i < steps; ++i) {
+            sum += path[i];
+        }
+        const Vector<T> s(T(type == option_type::call ? 1 : -1));
+        return max(s * (sum * Vector<T>(T(1) / steps) - Vector<T>(strike)),
+                   Vector<T>::Zero());
+    }
+};
+
+// monte_carlo{{{1
+/**
+ * Estimates the price of the option with \p payoff on \p model from \p paths simulated
+ * paths of \p steps equal time steps until \p expiry.
+ *
+ * \p payoff is called as `payoff(path, steps)` for Vector<T>::Size paths at once, where
+ * `path[i]` holds the prices at time \f$(i + 1) \cdot expiry / steps\f$, and returns the
+ * undiscounted payoffs. The normal increments come from Philox4x32-10 under \p seed via
+ * inverse_normal_cdf, with the counter derived from the path index, so the estimate is
+ * reproducible and independent of \p threads.
+ */
+template <typename T, typename Payoff>
+inline mc_result<T> monte_carlo(const gbm<T> &model, T expiry, std::size_t steps,
+                                std::size_t paths, const Payoff &payoff,
+                                std::uint64_t seed = 0, unsigned threads = 0)
+{
+    using V = Vector<T>;
+    Vc_ASSERT(steps > 0 && paths > 0);
+    // Group: the paths of one Philox call and of whole V, words: per normal and call
+    constexpr std::size_t Group = V::Size > uint_v::Size ? V::Size : uint_v::Size;
+    constexpr std::size_t Words = sizeof(T) == sizeof(float) ? 1 : 2;
+    constexpr std::size_t PerCall = 4 / Words;
+    constexpr std::size_t Block = 4096;  // paths per partial sum
+    static_assert(Block % Group == 0, "");
+
+    const T dt = expiry / steps;
+    const V drift((model.rate - model.dividend - T(0.5) * model.volatility *
+                   model.volatility) * dt);
+    const V diffusion(model.volatility * std::sqrt(dt));
+    const V spot(model.spot);
+    const uint_v k0(static_cast<unsigned>(seed)), k1(static_cast<unsigned>(seed >> 32));
+
+    const std::size_t blocks = (paths + Block - 1) / Block;
+    std::vector<double> sums(blocks), squares(blocks);
+    const unsigned nthreads = Common::thread_count(blocks, threads, 1);
+    Common::parallel_chunks(blocks, nthreads, 1, [&](unsigned, std::size_t first,
+                                                     std::size_t last) {
+        std::vector<V, Vc::Allocator<V>> path(Group / V::Size * steps);
+        alignas(64) int words[4][Group];
+        for (std::size_t b = first; b < last; ++b) {
+            V sum = V::Zero(), square = V::Zero();
+            const std::size_t end = std::min(paths, (b + 1) * Block);
+            for (std::size_t p0 = b * Block; p0 < end; p0 += Group) {
+                V x[Group / V::Size];  // the log of price / spot
+                for (V &xi : x) {
+                    xi = V::Zero();
+                }
+                for (std::size_t j = 0; j < steps; j += PerCall) {
+                    for (std::size_t u = 0; u < Group; u += uint_v::Size) {
+                        const std::uint64_t p = p0 + u;
+                        uint_v c[4] = {uint_v(static_cast<unsigned>(p)) +
+                                           uint_v::IndexesFromZero(),
+                                       uint_v(static_cast<unsigned>(j / PerCall)),
+                                       uint_v(static_cast<unsigned>(p >> 32)),
+                                       uint_v::Zero()};
+                        Detail::philox4x32(c, k0, k1);
+                        for (int w = 0; w < 4; ++w) {
+                            // 23 or 2x26 bits to build uniforms in (0, 1)
+                            simd_cast<int_v>(c[w] >> (Words == 1 ? 9 : 6))
+                                .store(words[w] + u);
+                        }
+                    }
+                    for (std::size_t v = 0; v < Group / V::Size; ++v) {
+                        const std::size_t o = v * V::Size;
+                        for (std::size_t k = 0; k < PerCall && j + k < steps; ++k) {
+                            V uniform;
+                            if (Words == 1) {
+                                uniform = (V(words[k] + o, Vc::Unaligned) + V(T(0.5))) *
+                                          V(T(1) / (1 << 23));
+                            } else {
+                                const V hi(words[2 * k] + o, Vc::Unaligned);
+                                const V lo(words[2 * k + 1] + o, Vc::Unaligned);
+                                uniform = (hi * V(T(1 << 26)) + lo + V(T(0.5))) *
+                                          V(T(1) / (std::uint64_t(1) << 52));
+                            }
+                            const V z = Detail::inverse_normal_cdf_lower(
+                                min(uniform, V(T(1)) - uniform));
+                            x[v] += drift + diffusion * iif(uniform > V(T(0.5)), -z, z);
+                            path[v * steps + j + k] = spot * exp(x[v]);
+                        }
+                    }
+                }
+                for (std::size_t v = 0; v < Group / V::Size; ++v) {
+                    const std::size_t p = p0 + v * V::Size;
+                    if (p >= end) {
+                        break;
+                    }
+                    V value = payoff(&path[v * steps], steps);
+                    value.setZeroInverted(V::IndexesFromZero() < V(T(end - p)));
+                    sum += value;
+                    square += value * value;
+                }
+            }
+            sums[b] = sum.sum();
+            squares[b] = square.sum();
+        }
+    });
+
+    double sum = 0, square = 0;
+    for (std::size_t b = 0; b < blocks; ++b) {
+        sum += sums[b];
+        square += squares[b];
+    }
+    const double mean = sum / paths;
+    const double variance =
+        paths > 1 ? std::max(0., (square - sum * mean) / double(paths - 1)) : 0.;
+    const double discount = std::exp(-double(model.rate) * expiry);
+    return {T(discount * mean), T(discount * std::sqrt(variance / paths))};
+}
+//}}}1
+}  // namespace finance
+}  // namespace Vc
+
+#endif  // VC_COMMON_FINANCE_H_
+
+// vim: foldmethod=marker
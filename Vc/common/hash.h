@@ -0,0 +1,253 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+#ifndef VC_COMMON_HASH_H_
+#define VC_COMMON_HASH_H_
+
+#include <cstdint>
+#include <type_traits>
+#include "../vector.h"
+#include "../type_traits"
+#include "macros.h"
+#ifdef Vc_IMPL_SSE4_2
+#include <nmmintrin.h>
+#endif
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+/**\internal
+ * The hash functions accept \c uint as well as any SIMD vector of \c uint (\c uint_v
+ * or \c SimdArray<uint, N>). All of them are written once, in terms of operators that
+ * both provide.
+ */
+template <typename V, bool = Traits::is_simd_vector<V>::value> struct is_hash_input;
+template <typename V>
+struct is_hash_input<V, true>
+    : public std::is_same<typename V::EntryType, uint> {
+};
+template <typename V> struct is_hash_input<V, false> : public std::is_same<V, uint> {
+};
+template <typename V>
+using is_hash_vector = std::integral_constant<bool, Traits::is_simd_vector<V>::value &&
+                                                        is_hash_input<V>::value>;
+
+template <typename V> Vc_INTRINSIC V rotl32(const V &x, int r)
+{
+    return (x << r) | (x >> (32 - r));
+}
+
+// murmur3{{{1
+constexpr uint Murmur3C1 = 0xcc9e2d51u;
+constexpr uint Murmur3C2 = 0x1b873593u;
+
+template <typename V> Vc_INTRINSIC V murmur3_block(V h, V k)
+{
+    k *= Murmur3C1;
+    k = rotl32(k, 15);
+    k *= Murmur3C2;
+    h ^= k;
+    h = rotl32(h, 13);
+    return h * 5u + 0xe6546b64u;
+}
+
+template <typename V> Vc_INTRINSIC V murmur3_fmix32(V h)
+{
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    return h ^ (h >> 16);
+}
+
+// xxh32{{{1
+constexpr uint XXH32Prime2 = 2246822519u;
+constexpr uint XXH32Prime3 = 3266489917u;
+constexpr uint XXH32Prime4 = 668265263u;
+constexpr uint XXH32Prime5 = 374761393u;
+
+template <typename V> Vc_INTRINSIC V xxh32_word(V h, V w)
+{
+    h += w * XXH32Prime3;
+    return rotl32(h, 17) * XXH32Prime4;
+}
+
+template <typename V> Vc_INTRINSIC V xxh32_avalanche(V h)
+{
+    h ^= h >> 15;
+    h *= XXH32Prime2;
+    h ^= h >> 13;
+    h *= XXH32Prime3;
+    return h ^ (h >> 16);
+}
+
+// crc32c{{{1
+/**\internal
+ * Advances the (non-inverted) CRC-32C state \p crc of every entry by the four bytes of
+ * \p w. SSE4.2 has a crc32 instruction, but no vector form of it, so it is issued once
+ * per entry. Without SSE4.2 the reflected polynomial is applied bit by bit to all
+ * entries at once.
+ */
+Vc_INTRINSIC uint crc32c_word(uint crc, uint w)
+{
+#ifdef Vc_IMPL_SSE4_2
+    return _mm_crc32_u32(crc, w);
+#else
+    crc ^= w;
+    for (int i = 0; i < 32; ++i) {
+        crc = (crc >> 1) ^ ((0u - (crc & 1u)) & 0x82f63b78u);
+    }
+    return crc;
+#endif
+}
+template <typename V> Vc_INTRINSIC V crc32c_word(V crc, const V &w)
+{
+#ifdef Vc_IMPL_SSE4_2
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        crc[i] = _mm_crc32_u32(crc[i], w[i]);
+    }
+    return crc;
+#else
+    crc ^= w;
+    for (int i = 0; i < 32; ++i) {
+        crc = (crc >> 1) ^ ((V(0u) - (crc & 1u)) & 0x82f63b78u);
+    }
+    return crc;
+#endif
+}
+//}}}1
+}  // namespace Detail
+
+/**
+ * \name Hash functions
+ * \ingroup Utilities
+ *
+ * Vectorized versions of common non-cryptographic hash functions for 32-bit keys and for
+ * 64-bit keys split into their low and high halves. Every entry of the result is exactly
+ * the hash the reference implementation computes for the little-endian bytes of the key.
+ * The same functions accept scalar \c uint and \c std::uint64_t keys, so that vector and
+ * scalar code paths agree:
+ *
+ * \code
+ * uint_v h = Vc::murmur3_32(uint_v(keys, Vc::Unaligned));
+ * uint_v lo, hi;
+ * Vc::deinterleave(&lo, &hi, reinterpret_cast<const uint *>(keys64), Vc::Unaligned);
+ * uint_v h64 = Vc::xxh32(lo, hi);  // == Vc::xxh32(keys64[i]) in entry i
+ * \endcode
+ *
+ * Vc has no vectors of 64-bit integers, therefore the 64-bit variants also return 32-bit
+ * hashes.
+ *
+ * \headerfile hash.h <Vc/hash>
+ */
+///@{
+/// Returns the murmur3 finalizer (fmix32) of every entry of \p h, a bijective mixer.
+template <typename V>
+Vc_INTRINSIC enable_if<Detail::is_hash_input<V>::value, V> fmix32(const V &h)
+{
+    return Detail::murmur3_fmix32(h);
+}
+
+/// Returns MurmurHash3_x86_32 of the four bytes of every entry of \p key.
+template <typename V>
+Vc_INTRINSIC enable_if<Detail::is_hash_input<V>::value, V> murmur3_32(const V &key,
+                                                                     uint seed = 0)
+{
+    return Detail::murmur3_fmix32(Detail::murmur3_block(V(seed), key) ^ 4u);
+}
+
+/// Returns MurmurHash3_x86_32 of the eight bytes of the keys `lo[i] | hi[i] << 32`.
+template <typename V>
+Vc_INTRINSIC enable_if<Detail::is_hash_vector<V>::value, V>
+murmur3_32(const V &lo, const V &hi, uint seed = 0)
+{
+    return Detail::murmur3_fmix32(
+        Detail::murmur3_block(Detail::murmur3_block(V(seed), lo), hi) ^ 8u);
+}
+
+/// Returns MurmurHash3_x86_32 of the eight bytes of \p key.
+Vc_INTRINSIC uint murmur3_32(std::uint64_t key, uint seed = 0)
+{
+    return Detail::murmur3_fmix32(
+        Detail::murmur3_block(Detail::murmur3_block(seed, uint(key)), uint(key >> 32)) ^
+        8u);
+}
+
+/// Returns XXH32 of the four bytes of every entry of \p key.
+template <typename V>
+Vc_INTRINSIC enable_if<Detail::is_hash_input<V>::value, V> xxh32(const V &key,
+                                                                uint seed = 0)
+{
+    return Detail::xxh32_avalanche(
+        Detail::xxh32_word(V(seed + Detail::XXH32Prime5 + 4u), key));
+}
+
+/// Returns XXH32 of the eight bytes of the keys `lo[i] | hi[i] << 32`.
+template <typename V>
+Vc_INTRINSIC enable_if<Detail::is_hash_vector<V>::value, V>
+xxh32(const V &lo, const V &hi, uint seed = 0)
+{
+    return Detail::xxh32_avalanche(Detail::xxh32_word(
+        Detail::xxh32_word(V(seed + Detail::XXH32Prime5 + 8u), lo), hi));
+}
+
+/// Returns XXH32 of the eight bytes of \p key.
+Vc_INTRINSIC uint xxh32(std::uint64_t key, uint seed = 0)
+{
+    return Detail::xxh32_avalanche(Detail::xxh32_word(
+        Detail::xxh32_word(seed + Detail::XXH32Prime5 + 8u, uint(key)), uint(key >> 32)));
+}
+
+/// Returns the CRC-32C (Castagnoli) of the four bytes of every entry of \p key,
+/// continuing from \p crc.
+template <typename V>
+Vc_INTRINSIC enable_if<Detail::is_hash_input<V>::value, V> crc32c(const V &key,
+                                                                 uint crc = 0)
+{
+    return ~Detail::crc32c_word(V(~crc), key);
+}
+
+/// Returns the CRC-32C (Castagnoli) of the eight bytes of the keys `lo[i] | hi[i] << 32`,
+/// continuing from \p crc.
+template <typename V>
+Vc_INTRINSIC enable_if<Detail::is_hash_vector<V>::value, V>
+crc32c(const V &lo, const V &hi, uint crc = 0)
+{
+    return ~Detail::crc32c_word(Detail::crc32c_word(V(~crc), lo), hi);
+}
+
+/// Returns the CRC-32C (Castagnoli) of the eight bytes of \p key, continuing from \p crc.
+Vc_INTRINSIC uint crc32c(std::uint64_t key, uint crc = 0)
+{
+    return ~Detail::crc32c_word(Detail::crc32c_word(~crc, uint(key)), uint(key >> 32));
+}
+///@}
+}  // namespace Vc
+
+#endif  // VC_COMMON_HASH_H_
+
+// vim: foldmethod=marker
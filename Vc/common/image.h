@@ -0,0 +1,654 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_IMAGE_H_
+#define VC_COMMON_IMAGE_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../vector.h"
+#include "../Allocator"
+#include "divider.h"
+#include "paddedmemory.h"
+#include "parallel.h"
+#ifdef Vc_IMPL_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef Vc_IMPL_AVX2
+#include <immintrin.h>
+#endif
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ *
+ * Separable filters and resampling of single-channel images (planes) stored in a
+ * PaddedMemory<V> or any other MemoryView<V, 2>.
+ *
+ * The planes hold \c unsigned char, \c short, \c unsigned short, or \c float values, i.e.
+ * \c V is one of \c uchar_v, \c short_v, \c ushort_v, or \c float_v. The kernels read and
+ * write whole vectors up to the row padding, so there are no scalar tails. Pixels outside
+ * of the plane repeat the nearest edge pixel. The output rows are split into one band
+ * per thread, for \p threads threads (0 selects `std::thread::hardware_concurrency()`);
+ * planes too small to be worth splitting are processed on the calling thread.
+ *
+ * \code
+ * Vc::PaddedMemory<Vc::uchar_v> photo(3000, 4000), thumbnail(300, 400), blur(300, 400);
+ * Vc::image::resize(photo, thumbnail, Vc::image::interpolation::bicubic);
+ * Vc::image::gaussian_blur(thumbnail, blur, 1.5f);
+ * \endcode
+ */
+namespace image
+{
+// kernel{{{1
+/**
+ * The weights of a one-dimensional filter with an odd number of taps. Applied to a row,
+ * output pixel \c x is \f$\sum_k w_k \cdot in_{x + k - r}\f$ with \c r = radius().
+ */
+class kernel
+{
+public:
+    /// Uses \p weights as given. Their number must be odd.
+    explicit kernel(std::vector<float> weights) : m_weights(std::move(weights))
+    {
+        Vc_ASSERT(m_weights.size() % 2 == 1);
+    }
+
+    /// The mean of `2 * radius + 1` pixels.
+    static kernel box(std::size_t radius)
+    {
+        return kernel(std::vector<float>(2 * radius + 1, 1.f / (2 * radius + 1)));
+    }
+
+    /**
+     * A sampled Gaussian with standard deviation \p sigma, normalized to a sum of 1. A \p
+     * radius of 0 selects \f$\lceil 3\sigma\rceil\f$.
+     */
+    static kernel gaussian(float sigma, std::size_t radius = 0)
+    {
+        if (radius == 0) {
+            radius = static_cast<std::size_t>(std::ceil(3 * std::max(sigma, 0.f)));
+        }
+        std::vector<double> w(2 * radius + 1);
+        double sum = 0;
+        for (std::size_t i = 0; i < w.size(); ++i) {
+            const double d = double(i) - double(radius);
+            w[i] = sigma > 0 ? std::exp(-d * d / (2. * sigma * sigma)) : double(d == 0);
+            sum += w[i];
+        }
+        std::vector<float> weights(w.size());
+        for (std::size_t i = 0; i < w.size(); ++i) {
+            weights[i] = static_cast<float>(w[i] / sum);
+        }
+        return kernel(std::move(weights));
+    }
+
+    /// The number of taps.
+    std::size_t size() const { return m_weights.size(); }
+    /// The number of taps on either side of the center tap.
+    std::size_t radius() const { return m_weights.size() / 2; }
+    /// The weight of tap \p i.
+    float operator[](std::size_t i) const { return m_weights[i]; }
+    /// The weights, from the leftmost tap.
+    const float *data() const { return m_weights.data(); }
+
+private:
+    std::vector<float> m_weights;
+};
+
+// interpolation{{{1
+/**
+ * The reconstruction filters of image::resize. When shrinking, the filters are widened
+ * by the scale factor, so that every source pixel contributes (antialiasing).
+ */
+enum class interpolation {
+    /// The triangle filter: linear interpolation between the two nearest pixels.
+    bilinear,
+    /// Keys' cubic convolution with \f$a = -\frac{1}{2}\f$ (Catmull-Rom), 4 pixels.
+    bicubic
+};
+
+namespace Detail
+{
+template <typename T>
+using is_pixel = std::integral_constant<
+    bool, std::is_same<T, unsigned char>::value || std::is_same<T, short>::value ||
+              std::is_same<T, unsigned short>::value || std::is_same<T, float>::value>;
+
+template <typename T> using Row = std::vector<T, Vc::Allocator<T>>;
+
+/**\internal
+ * The granularity of all row buffers: four float_v or short_v, so that the kernels can
+ * keep four independent sums in flight.
+ */
+constexpr std::size_t RowBlock =
+    4 * (float_v::Size > short_v::Size ? float_v::Size : short_v::Size);
+
+inline std::size_t padded(std::size_t n)
+{
+    return (n + RowBlock - 1) / RowBlock * RowBlock;
+}
+
+/// The row of a plane of \p rows rows that is used for row \p i - \p r (clamped).
+inline std::size_t clamped_row(std::size_t i, std::size_t r, std::size_t rows)
+{
+    return std::min(rows - 1, i > r ? i - r : 0);
+}
+
+/**\internal
+ * Returns the number of threads for \p rows rows of output, where every row reads and
+ * writes about \p pixelsPerRow pixels. No thread gets less than 64Ki pixels.
+ */
+inline unsigned thread_count(std::size_t rows, std::size_t pixelsPerRow, unsigned threads)
+{
+    const std::size_t grain = std::max<std::size_t>(
+        1, (std::size_t(1) << 16) / std::max<std::size_t>(1, pixelsPerRow));
+    return threads == 1 ? 1u : Common::thread_count(rows, threads, grain);
+}
+
+// load_row / store_row{{{2
+/**\internal
+ * Converts the \p n pixels at \p in to float. Whole vectors are read and written, i.e.
+ * up to the next multiple of float_v::Size.
+ */
+template <typename T> Vc_INTRINSIC void load_row(const T *in, std::size_t n, float *out)
+{
+    for (std::size_t i = 0; i < n; i += float_v::Size) {
+        float_v(in + i, Vc::Unaligned).store(out + i, Vc::Unaligned);
+    }
+}
+
+/**\internal
+ * Writes \p x narrowed to unsigned char with saturation: short_v::Size bytes.
+ */
+#ifdef Vc_IMPL_SSE2
+Vc_INTRINSIC void store_bytes(__m128i x, unsigned char *out)
+{
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(out), _mm_packus_epi16(x, x));
+}
+#endif
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC void store_bytes(__m256i x, unsigned char *out)
+{
+    // packus works per 128-bit lane: gather the low halves of both lanes
+    const __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(x, x), 0xd8);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm256_castsi256_si128(packed));
+}
+#endif
+Vc_INTRINSIC void store_bytes(short x, unsigned char *out)
+{
+    *out = static_cast<unsigned char>(x < 0 ? 0 : x > 255 ? 255 : x);
+}
+Vc_INTRINSIC void store_bytes(unsigned short x, unsigned char *out)
+{
+    *out = static_cast<unsigned char>(x > 255 ? 255 : x);
+}
+
+/**\internal
+ * Writes the \p n floats at \p in (aligned, padded to RowBlock) as pixels. Integer
+ * pixels are rounded to nearest and saturated.
+ */
+inline void store_row(const float *in, std::size_t n, float *out)
+{
+    std::size_t i = 0;
+    for (; i + float_v::Size <= n; i += float_v::Size) {
+        float_v(in + i, Vc::Aligned).store(out + i, Vc::Unaligned);
+    }
+    if (i < n) {
+        float_v(in + i, Vc::Aligned).store_partial(out + i, n - i);
+    }
+}
+template <typename T> inline void store_row(const float *in, std::size_t n, T *out)
+{
+    using I = SimdArray<T, float_v::Size>;
+    const float_v lo(static_cast<float>(std::numeric_limits<T>::min()));
+    const float_v hi(static_cast<float>(std::numeric_limits<T>::max()));
+    for (std::size_t i = 0; i < n; i += float_v::Size) {
+        const float_v x = float_v(in + i, Vc::Aligned);
+        const float_v r = Vc::floor(Vc::min(Vc::max(x, lo), hi) + 0.5f);
+        simd_cast<I>(r).store_partial(out + i, std::min(n - i, float_v::Size));
+    }
+}
+inline void store_row(const float *in, std::size_t n, unsigned char *out)
+{
+    using F = SimdArray<float, short_v::Size>;
+    constexpr std::size_t W = short_v::Size;
+    for (std::size_t i = 0; i < n; i += W) {
+        const F x(in + i, Vc::Unaligned);
+        const F rounded = Vc::floor(Vc::min(Vc::max(x, F(0.f)), F(255.f)) + 0.5f);
+        const short_v r = simd_cast<short_v>(rounded);
+        if (i + W <= n) {
+            store_bytes(r.data(), out + i);
+        } else {
+            unsigned char tail[W];
+            store_bytes(r.data(), tail);
+            std::memcpy(out + i, tail, n - i);
+        }
+    }
+}
+
+/**\internal
+ * Repeats the first and the last of the \p n values at `row + r` over the \p r entries
+ * before and all entries after them, up to `row + size`.
+ */
+template <typename T>
+inline void extend_row(T *row, std::size_t r, std::size_t n, std::size_t size)
+{
+    std::fill(row, row + r, row[r]);
+    std::fill(row + r + n, row + size, row[r + n - 1]);
+}
+
+// weighted_sum{{{2
+/**\internal
+ * `a * b + c`, contracted into an FMA only if the target has one; the emulated Vc::fma is
+ * much slower than the separate multiplication and addition.
+ */
+Vc_INTRINSIC float_v madd(const float_v &a, const float_v &b, const float_v &c)
+{
+#if defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4
+    return Vc::fma(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+
+Vc_INTRINSIC float_v tap(const float_v &acc, const float_v &w, const float_v &x)
+{
+    return madd(w, x, acc);
+}
+Vc_INTRINSIC ushort_v tap(const ushort_v &acc, const ushort_v &w, const ushort_v &x)
+{
+    return acc + mulhi(x, w);
+}
+
+/**\internal
+ * Writes \f$\sum_k w_k \cdot src_k[x]\f$ to `dst[x]` for all \c x in [0, \p n), where \p
+ * n is a multiple of RowBlock. Four vectors are summed at a time, which hides the
+ * latency of the multiply-adds.
+ */
+template <typename V, typename Flags>
+Vc_INTRINSIC void weighted_sum(const typename V::EntryType *const *src,
+                               const typename V::EntryType *w, std::size_t taps,
+                               std::size_t n, typename V::EntryType *dst, Flags)
+{
+    constexpr std::size_t W = V::Size;
+    for (std::size_t x = 0; x < n; x += 4 * W) {
+        V a0 = V::Zero(), a1 = V::Zero(), a2 = V::Zero(), a3 = V::Zero();
+        for (std::size_t k = 0; k < taps; ++k) {
+            const V wk = w[k];
+            const typename V::EntryType *p = src[k] + x;
+            a0 = tap(a0, wk, V(p, Flags()));
+            a1 = tap(a1, wk, V(p + W, Flags()));
+            a2 = tap(a2, wk, V(p + 2 * W, Flags()));
+            a3 = tap(a3, wk, V(p + 3 * W, Flags()));
+        }
+        a0.store(dst + x, Vc::Aligned);
+        a1.store(dst + x + W, Vc::Aligned);
+        a2.store(dst + x + 2 * W, Vc::Aligned);
+        a3.store(dst + x + 3 * W, Vc::Aligned);
+    }
+}
+
+// separable{{{2
+/**\internal
+ * The separable filter for pixels of type \p T computed as \p C (float, or ushort for 8.8
+ * fixed point). Every thread filters a band of rows: each source row is widened into a
+ * line with replicated borders and filtered horizontally into a ring of the last `2 * rv
+ * + 1` rows, from which the vertical pass sums one output row into a sum row that is
+ * narrowed to the output. Thus every source row is filtered horizontally once per band.
+ */
+template <typename C, typename T, typename Widen, typename Narrow>
+void separable(const MemoryView<Vector<T>, 2> &in, MemoryView<Vector<T>, 2> &out,
+               const std::vector<C> &h, const std::vector<C> &v, unsigned nthreads,
+               Widen &&widen, Narrow &&narrow)
+{
+    using V = typename std::conditional<std::is_same<C, float>::value, float_v,
+                                        ushort_v>::type;
+    const std::size_t rows = in.rowsCount(), cols = in.columnsCount();
+    const std::size_t rh = h.size() / 2, rv = v.size() / 2;
+    const std::size_t width = padded(cols);
+    Common::parallel_chunks(
+        rows, nthreads, 1, [&](unsigned, std::size_t first, std::size_t last) {
+            Row<C> line(width + 2 * rh), ring(v.size() * width), sum(width);
+            std::vector<const C *> taps(std::max(h.size(), v.size()));
+            // ring row j % v.size() holds source row j - rv (clamped)
+            const auto filterRow = [&](std::size_t j) {
+                for (std::size_t k = 0; k < h.size(); ++k) {
+                    taps[k] = &line[k];
+                }
+                widen(in.entries(clamped_row(j, rv, rows)), cols, &line[rh]);
+                extend_row(line.data(), rh, cols, line.size());
+                weighted_sum<V>(taps.data(), h.data(), h.size(), width,
+                                &ring[j % v.size() * width], Vc::Unaligned);
+            };
+            for (std::size_t j = first; j < first + 2 * rv; ++j) {
+                filterRow(j);
+            }
+            for (std::size_t y = first; y < last; ++y) {
+                filterRow(y + 2 * rv);
+                for (std::size_t k = 0; k < v.size(); ++k) {
+                    taps[k] = &ring[(y + k) % v.size() * width];
+                }
+                weighted_sum<V>(taps.data(), v.data(), v.size(), width, sum.data(),
+                                Vc::Aligned);
+                narrow(sum.data(), cols, out.entries(y));
+            }
+        });
+}
+
+template <typename T>
+void separable(const MemoryView<Vector<T>, 2> &in, MemoryView<Vector<T>, 2> &out,
+               const kernel &h, const kernel &v, unsigned nthreads)
+{
+    separable(in, out, std::vector<float>(h.data(), h.data() + h.size()),
+              std::vector<float>(v.data(), v.data() + v.size()), nthreads,
+              [](const T *src, std::size_t n, float *dst) { load_row(src, n, dst); },
+              [](const float *src, std::size_t n, T *dst) { store_row(src, n, dst); });
+}
+
+// 8-bit fixed point{{{2
+/**\internal
+ * Quantizes the weights of \p k to 0.16 fixed point. Fails for negative weights and for
+ * gains above 1, which the unsigned 16-bit intermediates cannot represent.
+ */
+inline bool fixed_point_weights(const kernel &k, std::vector<unsigned short> &q)
+{
+    double gain = 0;
+    for (std::size_t i = 0; i < k.size(); ++i) {
+        if (k[i] < 0) {
+            return false;
+        }
+        gain += k[i];
+    }
+    if (gain > 1.0001) {
+        return false;
+    }
+    q.resize(k.size());
+    long sum = 0;
+    for (std::size_t i = 0; i < k.size(); ++i) {
+        q[i] = static_cast<unsigned short>(std::min(65535l, std::lround(k[i] * 65536.)));
+        sum += q[i];
+    }
+    // put the rounding error into the center tap, so that flat areas stay flat
+    const long target = std::min(65536l, std::lround(gain * 65536.));
+    const long center = long(q[k.radius()]) + target - sum;
+    if (center < 0 || center > 65535) {
+        return false;
+    }
+    q[k.radius()] = static_cast<unsigned short>(center);
+    return true;
+}
+
+/**\internal
+ * 8-bit pixels are widened to 8.8 fixed point in ushort_v, and every tap is one Vc::mulhi
+ * with a 0.16 weight, which yields 8.8 again. Thus neither pass converts, and a ushort_v
+ * holds twice as many pixels as a float_v. The sums are rounded and packed to bytes with
+ * saturation.
+ */
+inline void separable(const MemoryView<uchar_v, 2> &in, MemoryView<uchar_v, 2> &out,
+                      const kernel &h, const kernel &v, unsigned nthreads)
+{
+    using U = ushort_v;
+    constexpr std::size_t W = U::Size;
+    std::vector<unsigned short> qh, qv;
+    if (!fixed_point_weights(h, qh) || !fixed_point_weights(v, qv)) {
+        separable<unsigned char>(in, out, h, v, nthreads);
+        return;
+    }
+    const auto widen = [](const unsigned char *src, std::size_t n, unsigned short *dst) {
+        for (std::size_t x = 0; x < n; x += W) {
+            (U(src + x, Vc::Unaligned) << 8).store(dst + x, Vc::Unaligned);
+        }
+    };
+    const auto narrow = [](const unsigned short *src, std::size_t n, unsigned char *dst) {
+        for (std::size_t x = 0; x < n; x += W) {
+            const U rounded = (U(src + x, Vc::Aligned) + U(128)) >> 8;
+            if (x + W <= n) {
+                store_bytes(rounded.data(), dst + x);
+            } else {
+                unsigned char tail[W];
+                store_bytes(rounded.data(), tail);
+                std::memcpy(dst + x, tail, n - x);
+            }
+        }
+    };
+    separable(in, out, qh, qv, nthreads, widen, narrow);
+}
+
+// ResampleAxis{{{2
+/**\internal
+ * The source pixels and weights of every output pixel along one axis of a resize. Every
+ * output pixel uses the same number of taps; entry `k * stride + i` describes tap \c k of
+ * output pixel \c i. The indexes are clamped to the source, which repeats the edge.
+ */
+struct ResampleAxis {
+    std::size_t taps = 0;
+    std::size_t stride;
+    Row<int> index;
+    Row<float> weight;
+
+    static double filter(double t, interpolation method)
+    {
+        t = std::abs(t);
+        if (method == interpolation::bilinear) {
+            return t < 1 ? 1 - t : 0;
+        }
+        constexpr double a = -0.5;
+        return t < 1 ? ((a + 2) * t - (a + 3)) * t * t + 1
+                     : t < 2 ? ((a * t - 5 * a) * t + 8 * a) * t - 4 * a : 0;
+    }
+
+    ResampleAxis(std::size_t in, std::size_t out, interpolation method,
+                 std::size_t stride_)
+        : stride(stride_)
+    {
+        // output pixel i covers [i, i + 1) * scale of the source
+        const double scale = double(in) / double(out);
+        const double widen = std::max(1., scale);
+        const double support = (method == interpolation::bilinear ? 1. : 2.) * widen;
+        std::vector<int> start(out);
+        std::vector<std::vector<double>> w(out);
+        for (std::size_t i = 0; i < out; ++i) {
+            const double center = (double(i) + 0.5) * scale;
+            int j = static_cast<int>(std::floor(center - support - 0.5));
+            const int end = static_cast<int>(std::ceil(center + support - 0.5));
+            while (j < end && filter((j + 0.5 - center) / widen, method) == 0) {
+                ++j;
+            }
+            start[i] = j;
+            double sum = 0;
+            for (; j <= end; ++j) {
+                w[i].push_back(filter((j + 0.5 - center) / widen, method));
+                sum += w[i].back();
+            }
+            while (!w[i].empty() && w[i].back() == 0) {
+                w[i].pop_back();
+            }
+            for (double &x : w[i]) {
+                x /= sum;
+            }
+            taps = std::max(taps, w[i].size());
+        }
+        index.assign(taps * stride, 0);
+        weight.assign(taps * stride, 0.f);
+        for (std::size_t i = 0; i < out; ++i) {
+            for (std::size_t k = 0; k < taps; ++k) {
+                const int j = std::min(int(in) - 1, std::max(0, start[i] + int(k)));
+                index[k * stride + i] = j;
+                weight[k * stride + i] = k < w[i].size() ? float(w[i][k]) : 0.f;
+            }
+        }
+    }
+
+    /// The smallest and the largest source index used by [\p first, \p last).
+    std::pair<int, int> range(std::size_t first, std::size_t last) const
+    {
+        std::pair<int, int> r(index[first], index[first]);
+        for (std::size_t k = 0; k < taps; ++k) {
+            for (std::size_t i = first; i < last; ++i) {
+                r.first = std::min(r.first, index[k * stride + i]);
+                r.second = std::max(r.second, index[k * stride + i]);
+            }
+        }
+        return r;
+    }
+};
+}  // namespace Detail
+
+// separable_filter{{{1
+/**
+ * Filters the rows of \p in with \p horizontal and then the columns with \p vertical.
+ * \p in and \p out must have the same extents and must not overlap.
+ *
+ * 8-bit planes are filtered in 16-bit fixed point if both kernels have no negative
+ * weights and a gain of at most 1, otherwise (and for all other pixel types) in float.
+ * Integer results are rounded to nearest and saturated.
+ */
+template <typename V>
+void separable_filter(const MemoryView<V, 2> &in, MemoryView<V, 2> out,
+                      const kernel &horizontal, const kernel &vertical,
+                      unsigned threads = 0)
+{
+    static_assert(Detail::is_pixel<typename V::EntryType>::value,
+                  "Vc::image requires unsigned char, short, unsigned short, or float "
+                  "pixels");
+    Vc_ASSERT(in.rowsCount() == out.rowsCount());
+    Vc_ASSERT(in.columnsCount() == out.columnsCount());
+    if (in.rowsCount() == 0 || in.columnsCount() == 0) {
+        return;
+    }
+    const unsigned nthreads =
+        Detail::thread_count(in.rowsCount(), 2 * in.columnsCount(), threads);
+    Detail::separable(in, out, horizontal, vertical, nthreads);
+}
+
+/**
+ * Blurs \p in with a Gaussian of standard deviation \p sigma (in pixels), truncated at
+ * \f$3\sigma\f$.
+ */
+template <typename V>
+void gaussian_blur(const MemoryView<V, 2> &in, MemoryView<V, 2> out, float sigma,
+                   unsigned threads = 0)
+{
+    const kernel k = kernel::gaussian(sigma);
+    separable_filter(in, out, k, k, threads);
+}
+
+/**
+ * Replaces every pixel by the mean of the square of `2 * radius + 1` pixels around it.
+ */
+template <typename V>
+void box_blur(const MemoryView<V, 2> &in, MemoryView<V, 2> out, std::size_t radius,
+              unsigned threads = 0)
+{
+    const kernel k = kernel::box(radius);
+    separable_filter(in, out, k, k, threads);
+}
+
+// resize{{{1
+/**
+ * Resamples \p in to the extents of \p out. Pixel centers are aligned, i.e. output pixel
+ * \c x samples the source at \f$(x + \frac{1}{2}) \cdot \frac{w_{in}}{w_{out}} -
+ * \frac{1}{2}\f$. \p in and \p out must not overlap.
+ *
+ * Every source row is converted to float and resampled horizontally (one gather per tap)
+ * into a ring of rows, which are then resampled vertically with aligned loads.
+ */
+template <typename V>
+void resize(const MemoryView<V, 2> &in, MemoryView<V, 2> out,
+            interpolation method = interpolation::bilinear, unsigned threads = 0)
+{
+    static_assert(Detail::is_pixel<typename V::EntryType>::value,
+                  "Vc::image requires unsigned char, short, unsigned short, or float "
+                  "pixels");
+    using Detail::Row;
+    constexpr std::size_t W = float_v::Size;
+    const std::size_t inRows = in.rowsCount(), inCols = in.columnsCount();
+    const std::size_t rows = out.rowsCount(), cols = out.columnsCount();
+    if (rows == 0 || cols == 0) {
+        return;
+    }
+    Vc_ASSERT(inRows > 0 && inCols > 0);
+    const std::size_t width = Detail::padded(cols);
+    const Detail::ResampleAxis horizontal(inCols, cols, method, width);
+    const Detail::ResampleAxis vertical(inRows, rows, method, rows);
+    const std::size_t work = (inRows * inCols + rows * cols) / rows;
+    Common::parallel_chunks(
+        rows, Detail::thread_count(rows, work, threads), 1,
+        [&](unsigned, std::size_t first, std::size_t last) {
+            // ring row j % taps holds source row j, resampled horizontally
+            const std::size_t ringRows = vertical.taps;
+            Row<float> line(Detail::padded(inCols)), ring(ringRows * width), sum(width);
+            std::vector<const float *> taps(ringRows);
+            std::vector<float> weights(ringRows);
+            std::size_t next = vertical.range(first, first + 1).first;
+            for (std::size_t y = first; y < last; ++y) {
+                const auto range = vertical.range(y, y + 1);
+                for (next = std::max<std::size_t>(next, range.first);
+                     next <= std::size_t(range.second); ++next) {
+                    Detail::load_row(in.entries(next), inCols, line.data());
+                    float *dst = &ring[next % ringRows * width];
+                    for (std::size_t x = 0; x < width; x += 2 * W) {
+                        float_v a0 = float_v::Zero(), a1 = float_v::Zero();
+                        for (std::size_t k = 0; k < horizontal.taps; ++k) {
+                            const int *i = &horizontal.index[k * width + x];
+                            const float *w = &horizontal.weight[k * width + x];
+                            const float_v::IndexType i0(i, Vc::Unaligned);
+                            const float_v::IndexType i1(i + W, Vc::Unaligned);
+                            const float_v p0(line.data(), i0), p1(line.data(), i1);
+                            a0 = Detail::madd(float_v(w, Vc::Aligned), p0, a0);
+                            a1 = Detail::madd(float_v(w + W, Vc::Aligned), p1, a1);
+                        }
+                        a0.store(dst + x, Vc::Aligned);
+                        a1.store(dst + x + W, Vc::Aligned);
+                    }
+                }
+                for (std::size_t k = 0; k < ringRows; ++k) {
+                    taps[k] = &ring[vertical.index[k * rows + y] % ringRows * width];
+                    weights[k] = vertical.weight[k * rows + y];
+                }
+                Detail::weighted_sum<float_v>(taps.data(), weights.data(), ringRows,
+                                              width, sum.data(), Vc::Aligned);
+                Detail::store_row(sum.data(), cols, out.entries(y));
+            }
+        });
+}
+//}}}1
+}  // namespace image
+}  // namespace Vc
+
+#endif  // VC_COMMON_IMAGE_H_
+
+// vim: foldmethod=marker
@@ -89,6 +89,18 @@ load(const EntryType *mem, Flags flags)
 {
     load<EntryType, Flags>(mem, flags);
 }
+/**
+ * Load the first \p n entries from \p mem and set the remaining entries to zero.
+ *
+ * This is intended for the remainder of an array whose size is not a multiple of
+ * \VSize{T}: no memory at or after `mem + n` is accessed in a way that could fault. If \p
+ * n is at least \VSize{T} this is equivalent to an unaligned load().
+ *
+ * \param mem A pointer to at least \p n values. No alignment is required.
+ * \param n The number of entries to load.
+ */
+Vc_INTRINSIC_L void load_partial(const EntryType *mem, std::size_t n) Vc_INTRINSIC_R;
+
 private:
 template <typename U, typename Flags>
 struct load_concept : public std::enable_if<
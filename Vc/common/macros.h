@@ -236,6 +236,16 @@ static Vc_INTRINSIC void unreachable() { __assume(0); }
 #define Vc_HAS_BUILTIN(x) 0
 #endif
 
+// Defined if the translation unit is instrumented with AddressSanitizer. GCC announces it
+// with __SANITIZE_ADDRESS__, Clang only via __has_feature.
+#if defined __SANITIZE_ADDRESS__
+#define Vc_ASAN 1
+#elif defined __has_feature
+#if __has_feature(address_sanitizer)
+#define Vc_ASAN 1
+#endif
+#endif
+
 #define Vc_CAT_HELPER_(a, b, c, d) a##b##c##d
 #define Vc_CAT(a, b, c, d) Vc_CAT_HELPER_(a, b, c, d)
 
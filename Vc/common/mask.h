@@ -238,6 +238,28 @@ public:
      * Vc::Unaligned, Vc::PrefetchDefault, ...
      */
     template <typename Flags> Vc_ALWAYS_INLINE void store(bool *mem, Flags flags) const;
+
+    /**
+     * Load the components of the mask from a packed bit array.
+     *
+     * \param bits A pointer to a bit array storing bit `i` in bit `i % 64` of `bits[i /
+     * 64]`, like the bitmaps of Vc::bitmap.
+     * \param offset The bit position of the first component. It need not be a multiple of
+     * \VSize{T}.
+     * \see storeBits
+     */
+    static Vc_ALWAYS_INLINE Mask fromBits(const std::uint64_t *bits, std::size_t offset);
+
+    /**
+     * Store the components of the mask to a packed bit array. The other bits of the array
+     * are not modified.
+     *
+     * \param bits A pointer to a bit array storing bit `i` in bit `i % 64` of `bits[i /
+     * 64]`.
+     * \param offset The bit position of the first component.
+     * \see fromBits
+     */
+    Vc_ALWAYS_INLINE void storeBits(std::uint64_t *bits, std::size_t offset) const;
     ///@}
 
     /// \name Comparison Operators
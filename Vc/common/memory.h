@@ -342,6 +342,18 @@ class Memory<V, Size, 0u, InitPadding> :
                 std::memcpy(m_mem, rhs, entriesCount() * sizeof(EntryType));
                 return *this;
             }
+            /**
+             * Evaluates the array expression (or span) \p x into this object in a single
+             * pass.
+             *
+             * \see ArrayExpressions
+             */
+            template <typename E, typename = enable_if<is_array_assignable<E>::value>>
+            inline Memory &operator=(const E &x)
+            {
+                assign_expression<Operator::Assign>(*this, x);
+                return *this;
+            }
             inline Memory &operator=(const V &v) {
                 for (size_t i = 0; i < vectorsCount(); ++i) {
                     vector(i) = v;
@@ -524,6 +536,22 @@ class Memory<V, Size, 0u, InitPadding> :
             std::memcpy(m_mem, rhs, entriesCount() * sizeof(EntryType));
             return *this;
         }
+
+        /**
+         * Evaluates the array expression (or span) \p x into this object in a single pass.
+         *
+         * \param x The expression to evaluate. Its size must match entriesCount().
+         *
+         * \return reference to the modified Memory object.
+         *
+         * \see ArrayExpressions
+         */
+        template <typename E, typename = enable_if<is_array_assignable<E>::value>>
+        inline Memory &operator=(const E &x)
+        {
+            assign_expression<Operator::Assign>(*this, x);
+            return *this;
+        }
 };
 
 /**
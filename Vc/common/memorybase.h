@@ -37,6 +37,19 @@ namespace Vc_VERSIONED_NAMESPACE
 {
 namespace Common
 {
+/**\internal
+ * Whether Memory::operator= and the compound assignment operators of MemoryBase accept
+ * \p E as a whole-array expression. Only arrayexpression.h (included by
+ * <Vc/array_expression>) specializes it; without that header Memory has no expression
+ * overloads.
+ */
+template <typename E, typename = void> struct is_array_assignable : public std::false_type {};
+
+/**\internal
+ * Evaluates the array expression \p x into \p dst, combining the values with \p O.
+ * Defined in arrayexpression.h.
+ */
+template <Operator O, typename D, typename E> void assign_expression(D &dst, const E &x);
 
 #define Vc_MEM_OPERATOR_EQ(op) \
         template<typename T> \
@@ -705,6 +718,26 @@ template<typename V, typename Parent, int Dimension, typename RowMemory> class M
             return static_cast<Parent &>(*this);
         }
 
+#define Vc_ARRAY_COMPOUND_ASSIGN(op_, name_)                                             \
+    template <typename E>                                                                \
+    inline enable_if<is_array_assignable<E>::value, Parent &>                            \
+    operator op_(const E &x)                                                             \
+    {                                                                                    \
+        assign_expression<Operator::name_>(static_cast<Parent &>(*this), x);             \
+        return static_cast<Parent &>(*this);                                             \
+    }
+        /**
+         * Evaluates the array expression (or span) \p x and adds, subtracts, multiplies,
+         * or divides the result in a single pass over the array.
+         *
+         * \see ArrayExpressions
+         */
+        Vc_ARRAY_COMPOUND_ASSIGN(+=, PlusAssign)
+        Vc_ARRAY_COMPOUND_ASSIGN(-=, MinusAssign)
+        Vc_ARRAY_COMPOUND_ASSIGN(*=, MultiplyAssign)
+        Vc_ARRAY_COMPOUND_ASSIGN(/=, DivideAssign)
+#undef Vc_ARRAY_COMPOUND_ASSIGN
+
         /**
          * (Inefficient) shorthand compare equality of two arrays.
          */
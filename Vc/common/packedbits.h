@@ -0,0 +1,79 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_PACKEDBITS_H_
+#define VC_COMMON_PACKEDBITS_H_
+
+#include <cstddef>
+#include <cstdint>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+/**\internal
+ * Packed bit arrays store bit `i` as bit `i % 64` of word `i / 64`, the layout of
+ * bytes::match_bits and the filter bitmaps. These read and write the \p N <= 32 bits
+ * starting at bit \p offset, touching the second word only if the bits straddle it.
+ */
+template <std::size_t N> Vc_INTRINSIC std::uint64_t low_bits()
+{
+    return (std::uint64_t(1) << N) - 1;
+}
+
+template <std::size_t N>
+Vc_INTRINSIC unsigned load_bits(const std::uint64_t *bits, std::size_t offset)
+{
+    static_assert(N <= 32, "load_bits reads at most 32 bits");
+    const std::uint64_t *p = bits + offset / 64;
+    const std::size_t shift = offset % 64;
+    std::uint64_t w = p[0] >> shift;
+    if (shift + N > 64) {
+        w |= p[1] << (64 - shift);
+    }
+    return static_cast<unsigned>(w & low_bits<N>());
+}
+
+template <std::size_t N>
+Vc_INTRINSIC void store_bits(std::uint64_t *bits, std::size_t offset, unsigned value)
+{
+    static_assert(N <= 32, "store_bits writes at most 32 bits");
+    std::uint64_t *p = bits + offset / 64;
+    const std::size_t shift = offset % 64;
+    const std::uint64_t v = value & low_bits<N>();
+    p[0] = (p[0] & ~(low_bits<N>() << shift)) | (v << shift);
+    if (shift + N > 64) {
+        p[1] = (p[1] & ~(low_bits<N>() >> (64 - shift))) | (v >> (64 - shift));
+    }
+}
+}  // namespace Detail
+}  // namespace Vc
+
+#endif  // VC_COMMON_PACKEDBITS_H_
+
+// vim: foldmethod=marker
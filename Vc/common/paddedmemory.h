@@ -0,0 +1,784 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+#ifndef VC_COMMON_PADDEDMEMORY_H_
+#define VC_COMMON_PADDEDMEMORY_H_
+
+#include <assert.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include "memorybase.h"
+#include "malloc.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/**
+ * \ingroup Containers
+ * \headerfile paddedmemory.h <Vc/Memory>
+ *
+ * Selects how PaddedMemory lays out its rows.
+ */
+enum class RowLayout {
+    /// Every row is padded to a multiple of \c V::Size entries.
+    Padded,
+    /**
+     * Like Padded, but if the padded row (or plane) size is a multiple of 512 Bytes
+     * another cacheline is added. Otherwise vertically adjacent rows map to the same
+     * offset modulo 4 KiB, which makes loads from one row falsely depend on stores to
+     * another (4K aliasing) and thrashes the L1 sets in column-wise stencils.
+     */
+    Skewed
+};
+
+namespace Detail
+{
+/**\internal
+ * Returns the distance between the starts of two consecutive rows (or planes) of \p
+ * entries values of type \c V::EntryType. The result is a multiple of \c V::Size, so that
+ * every row starts at an address suitable for aligned vector loads.
+ */
+template <typename V> inline std::size_t paddedStride(std::size_t entries, RowLayout layout)
+{
+    using T = typename V::EntryType;
+    std::size_t stride = (entries + V::Size - 1) / V::Size * V::Size;
+    if (layout == RowLayout::Skewed && stride > 0 && stride * sizeof(T) % 512 == 0) {
+        stride += (64 / sizeof(T) + V::Size - 1) / V::Size * V::Size;
+    }
+    return stride;
+}
+}  // namespace Detail
+
+template <typename V, int Rank> class MemoryView;
+
+/**
+ * \ingroup Containers
+ * \headerfile paddedmemory.h <Vc/Memory>
+ *
+ * A non-owning view of one contiguous row of a PaddedMemory (or of any aligned and
+ * padded data).
+ *
+ * The view provides the complete 1-dimensional Memory interface, i.e. aligned vector
+ * access via vector(i) and iteration over vectors. The last vector of the row is backed
+ * by padding, so a row kernel never needs a scalar tail. A row is also an operand (and a
+ * destination) for the whole-array expressions of \ref ArrayExpressions.
+ *
+ * \note Copying a view creates another view of the same data. Assigning to a view,
+ * however, copies the values (as for all Memory classes).
+ */
+template <typename V>
+class MemoryView<V, 1> : public MemoryBase<V, MemoryView<V, 1>, 1, void>
+{
+public:
+    typedef typename V::EntryType EntryType;
+
+private:
+    typedef MemoryBase<V, MemoryView<V, 1>, 1, void> Base;
+    friend class MemoryBase<V, MemoryView<V, 1>, 1, void>;
+    friend class MemoryDimensionBase<V, MemoryView<V, 1>, 1, void>;
+    EntryType *m_mem;
+    std::size_t m_entriesCount;
+
+public:
+    using Base::vector;
+
+    /**
+     * Wraps \p size values starting at \p ptr.
+     *
+     * \warning \p ptr must be aligned to \c V::MemoryAlignment and the memory must be
+     * accessible up to the next multiple of \c V::Size entries.
+     */
+    Vc_ALWAYS_INLINE MemoryView(EntryType *ptr, std::size_t size)
+        : m_mem(ptr), m_entriesCount(size)
+    {
+        Vc_ASSERT(reinterpret_cast<std::uintptr_t>(ptr) % V::MemoryAlignment == 0);
+    }
+
+    MemoryView(const MemoryView &) = default;
+
+    /**
+     * \return the number of scalar entries in the row.
+     */
+    Vc_ALWAYS_INLINE Vc_PURE std::size_t entriesCount() const { return m_entriesCount; }
+
+    /**
+     * \return the number of vectors in the row, including the padded last vector.
+     */
+    Vc_ALWAYS_INLINE Vc_PURE std::size_t vectorsCount() const
+    {
+        return (m_entriesCount + V::Size - 1) / V::Size;
+    }
+
+    /**
+     * Overwrites all entries with the values stored in \p rhs.
+     *
+     * \note this function requires the vectorsCount() of both objects to be equal.
+     */
+    Vc_ALWAYS_INLINE MemoryView &operator=(const MemoryView &rhs)
+    {
+        assert(vectorsCount() == rhs.vectorsCount());
+        Detail::copyVectors(*this, rhs);
+        return *this;
+    }
+    /// \copydoc operator=(const MemoryView &)
+    template <typename Parent, typename RM>
+    Vc_ALWAYS_INLINE MemoryView &operator=(const MemoryBase<V, Parent, 1, RM> &rhs)
+    {
+        assert(vectorsCount() == rhs.vectorsCount());
+        Detail::copyVectors(*this, rhs);
+        return *this;
+    }
+
+    /**
+     * Initialize all data with the given vector.
+     */
+    inline MemoryView &operator=(const V &v)
+    {
+        for (std::size_t i = 0; i < vectorsCount(); ++i) {
+            vector(i) = v;
+        }
+        return *this;
+    }
+
+    /**
+     * Evaluates the array expression (or span) \p x into this row in a single pass.
+     *
+     * \see ArrayExpressions
+     */
+    template <typename E, typename = enable_if<is_array_assignable<E>::value>>
+    inline MemoryView &operator=(const E &x)
+    {
+        assign_expression<Operator::Assign>(*this, x);
+        return *this;
+    }
+};
+
+/**
+ * \ingroup Containers
+ * \headerfile paddedmemory.h <Vc/Memory>
+ *
+ * A non-owning, strided view of a two-dimensional array whose rows start at aligned
+ * addresses.
+ *
+ * The row stride is a multiple of \c V::Size. Thus operator[] yields rows with aligned
+ * vector access, and sub-views created via rows() and columns() retain that property.
+ */
+template <typename V> class MemoryView<V, 2>
+{
+public:
+    typedef typename V::EntryType EntryType;
+    /// The type returned by operator[].
+    typedef MemoryView<V, 1> RowView;
+
+protected:
+    EntryType *m_mem;
+    std::size_t m_rows;
+    std::size_t m_columns;
+    std::size_t m_rowStride;
+
+public:
+    /**
+     * Wraps \p rows rows of \p columns values. Row \c i starts at \c ptr + i * rowStride.
+     *
+     * \warning \p ptr must be aligned to \c V::MemoryAlignment and \p rowStride must be
+     * a multiple of \c V::Size.
+     */
+    Vc_ALWAYS_INLINE MemoryView(EntryType *ptr, std::size_t rows, std::size_t columns,
+                                std::size_t rowStride)
+        : m_mem(ptr), m_rows(rows), m_columns(columns), m_rowStride(rowStride)
+    {
+        Vc_ASSERT(reinterpret_cast<std::uintptr_t>(ptr) % V::MemoryAlignment == 0);
+        Vc_ASSERT(rowStride % V::Size == 0);
+    }
+
+    MemoryView(const MemoryView &) = default;
+
+    /// \return the number of rows.
+    Vc_ALWAYS_INLINE Vc_PURE std::size_t rowsCount() const { return m_rows; }
+    /// \return the number of scalar entries in each row.
+    Vc_ALWAYS_INLINE Vc_PURE std::size_t columnsCount() const { return m_columns; }
+    /// \return the number of entries between the starts of two consecutive rows.
+    Vc_ALWAYS_INLINE Vc_PURE std::size_t rowStride() const { return m_rowStride; }
+    /// \return the number of vectors in each row, including the padded last vector.
+    Vc_ALWAYS_INLINE Vc_PURE std::size_t vectorsPerRow() const
+    {
+        return (m_columns + V::Size - 1) / V::Size;
+    }
+    /**
+     * \return the number of scalar entries in the whole array, excluding the padding.
+     *
+     * \warning Do not use this function for scalar iteration over the array since there
+     * is padding between the rows.
+     */
+    Vc_ALWAYS_INLINE Vc_PURE std::size_t entriesCount() const { return m_rows * m_columns; }
+
+    /**
+     * Returns a pointer to the start of row \p i.
+     */
+    Vc_ALWAYS_INLINE Vc_PURE EntryType *entries(std::size_t i = 0)
+    {
+        return m_mem + i * m_rowStride;
+    }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE Vc_PURE const EntryType *entries(std::size_t i = 0) const
+    {
+        return m_mem + i * m_rowStride;
+    }
+
+    /**
+     * Returns the \p i,j-th scalar value in the memory.
+     */
+    Vc_ALWAYS_INLINE Vc_PURE EntryType &scalar(std::size_t i, std::size_t j)
+    {
+        return entries(i)[j];
+    }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE Vc_PURE const EntryType &scalar(std::size_t i, std::size_t j) const
+    {
+        return entries(i)[j];
+    }
+    /// Same as scalar(i, j).
+    Vc_ALWAYS_INLINE Vc_PURE EntryType &operator()(std::size_t i, std::size_t j)
+    {
+        return entries(i)[j];
+    }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE Vc_PURE const EntryType &operator()(std::size_t i, std::size_t j) const
+    {
+        return entries(i)[j];
+    }
+
+    /**
+     * Returns the \p i-th row.
+     */
+    Vc_ALWAYS_INLINE Vc_PURE RowView operator[](std::size_t i)
+    {
+        return RowView(entries(i), m_columns);
+    }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE Vc_PURE const RowView operator[](std::size_t i) const
+    {
+        return RowView(const_cast<EntryType *>(entries(i)), m_columns);
+    }
+
+    /**
+     * Returns a view of \p count rows, starting at row \p first and advancing by \p step
+     * rows.
+     */
+    Vc_ALWAYS_INLINE MemoryView rows(std::size_t first, std::size_t count,
+                                     std::size_t step = 1) const
+    {
+        Vc_ASSERT(step > 0 && (count == 0 || first + (count - 1) * step < m_rows));
+        return MemoryView(m_mem + first * m_rowStride, count, m_columns, m_rowStride * step);
+    }
+
+    /**
+     * Returns a view of the columns [\p first, \p first + \p count) of all rows.
+     *
+     * \p first must be a multiple of \c V::Size. Unless the sub-view extends to the end
+     * of the rows, \p count must be a multiple of \c V::Size as well. This way the
+     * padded last vector of a row in the sub-view never overlaps with columns outside of
+     * it.
+     */
+    Vc_ALWAYS_INLINE MemoryView columns(std::size_t first, std::size_t count) const
+    {
+        Vc_ASSERT(first % V::Size == 0 && first + count <= m_columns);
+        Vc_ASSERT(count % V::Size == 0 || first + count == m_columns);
+        return MemoryView(m_mem + first, m_rows, count, m_rowStride);
+    }
+
+    /**
+     * Copies the values of \p rhs row by row.
+     *
+     * \note Both objects must have the same number of rows and columns.
+     */
+    inline MemoryView &operator=(const MemoryView &rhs)
+    {
+        assert(m_rows == rhs.m_rows && m_columns == rhs.m_columns);
+        for (std::size_t i = 0; i < m_rows; ++i) {
+            (*this)[i] = rhs[i];
+        }
+        return *this;
+    }
+
+    /**
+     * Initialize all rows with the given vector.
+     */
+    inline MemoryView &operator=(const V &v)
+    {
+        for (std::size_t i = 0; i < m_rows; ++i) {
+            (*this)[i] = v;
+        }
+        return *this;
+    }
+
+    /**
+     * Zero all rows.
+     */
+    inline void setZero() { *this = V::Zero(); }
+};
+
+/**
+ * \ingroup Containers
+ * \headerfile paddedmemory.h <Vc/Memory>
+ *
+ * A non-owning, strided view of a three-dimensional array: \c planesCount() planes of
+ * \c rowsCount() rows, each of which starts at an aligned address.
+ */
+template <typename V> class MemoryView<V, 3>
+{
+public:
+    typedef typename V::EntryType EntryType;
+    /// The type returned by operator[].
+    typedef MemoryView<V, 2> PlaneView;
+    /// The type returned by row().
+    typedef MemoryView<V, 1> RowView;
+
+protected:
+    EntryType *m_mem;
+    std::size_t m_planes;
+    std::size_t m_rows;
+    std::size_t m_columns;
+    std::size_t m_planeStride;
+    std::size_t m_rowStride;
+
+public:
+    /**
+     * Wraps \p planes planes of \p rows rows of \p columns values. Row \c i of plane \c k
+     * starts at \c ptr + k * planeStride + i * rowStride.
+     *
+     * \warning \p ptr must be aligned to \c V::MemoryAlignment and both strides must be
+     * multiples of \c V::Size.
+     */
+    Vc_ALWAYS_INLINE MemoryView(EntryType *ptr, std::size_t planes, std::size_t rows,
+                                std::size_t columns, std::size_t planeStride,
+                                std::size_t rowStride)
+        : m_mem(ptr)
+        , m_planes(planes)
+        , m_rows(rows)
+        , m_columns(columns)
+        , m_planeStride(planeStride)
+        , m_rowStride(rowStride)
+    {
+        Vc_ASSERT(reinterpret_cast<std::uintptr_t>(ptr) % V::MemoryAlignment == 0);
+        Vc_ASSERT(planeStride % V::Size == 0 && rowStride % V::Size == 0);
+    }
+
+    MemoryView(const MemoryView &) = default;
+
+    /// \return the number of planes.
+    Vc_ALWAYS_INLINE Vc_PURE std::size_t planesCount() const { return m_planes; }
+    /// \return the number of rows in each plane.
+    Vc_ALWAYS_INLINE Vc_PURE std::size_t rowsCount() const { return m_rows; }
+    /// \return the number of scalar entries in each row.
+    Vc_ALWAYS_INLINE Vc_PURE std::size_t columnsCount() const { return m_columns; }
+    /// \return the number of entries between the starts of two consecutive planes.
+    Vc_ALWAYS_INLINE Vc_PURE std::size_t planeStride() const { return m_planeStride; }
+    /// \return the number of entries between the starts of two consecutive rows.
+    Vc_ALWAYS_INLINE Vc_PURE std::size_t rowStride() const { return m_rowStride; }
+    /// \return the number of vectors in each row, including the padded last vector.
+    Vc_ALWAYS_INLINE Vc_PURE std::size_t vectorsPerRow() const
+    {
+        return (m_columns + V::Size - 1) / V::Size;
+    }
+    /**
+     * \return the number of scalar entries in the whole array, excluding the padding.
+     */
+    Vc_ALWAYS_INLINE Vc_PURE std::size_t entriesCount() const
+    {
+        return m_planes * m_rows * m_columns;
+    }
+
+    /**
+     * Returns a pointer to the start of row \p i of plane \p k.
+     */
+    Vc_ALWAYS_INLINE Vc_PURE EntryType *entries(std::size_t k = 0, std::size_t i = 0)
+    {
+        return m_mem + k * m_planeStride + i * m_rowStride;
+    }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE Vc_PURE const EntryType *entries(std::size_t k = 0,
+                                                      std::size_t i = 0) const
+    {
+        return m_mem + k * m_planeStride + i * m_rowStride;
+    }
+
+    /**
+     * Returns the \p k,i,j-th scalar value in the memory.
+     */
+    Vc_ALWAYS_INLINE Vc_PURE EntryType &scalar(std::size_t k, std::size_t i, std::size_t j)
+    {
+        return entries(k, i)[j];
+    }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE Vc_PURE const EntryType &scalar(std::size_t k, std::size_t i,
+                                                     std::size_t j) const
+    {
+        return entries(k, i)[j];
+    }
+    /// Same as scalar(k, i, j).
+    Vc_ALWAYS_INLINE Vc_PURE EntryType &operator()(std::size_t k, std::size_t i,
+                                                  std::size_t j)
+    {
+        return entries(k, i)[j];
+    }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE Vc_PURE const EntryType &operator()(std::size_t k, std::size_t i,
+                                                        std::size_t j) const
+    {
+        return entries(k, i)[j];
+    }
+
+    /**
+     * Returns the \p k-th plane.
+     */
+    Vc_ALWAYS_INLINE Vc_PURE PlaneView operator[](std::size_t k)
+    {
+        return PlaneView(entries(k), m_rows, m_columns, m_rowStride);
+    }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE Vc_PURE const PlaneView operator[](std::size_t k) const
+    {
+        return PlaneView(const_cast<EntryType *>(entries(k)), m_rows, m_columns,
+                         m_rowStride);
+    }
+
+    /**
+     * Returns row \p i of plane \p k.
+     */
+    Vc_ALWAYS_INLINE Vc_PURE RowView row(std::size_t k, std::size_t i)
+    {
+        return RowView(entries(k, i), m_columns);
+    }
+    /// Const overload of the above function.
+    Vc_ALWAYS_INLINE Vc_PURE const RowView row(std::size_t k, std::size_t i) const
+    {
+        return RowView(const_cast<EntryType *>(entries(k, i)), m_columns);
+    }
+
+    /**
+     * Returns a view of \p count planes, starting at plane \p first and advancing by \p
+     * step planes.
+     */
+    Vc_ALWAYS_INLINE MemoryView planes(std::size_t first, std::size_t count,
+                                       std::size_t step = 1) const
+    {
+        Vc_ASSERT(step > 0 && (count == 0 || first + (count - 1) * step < m_planes));
+        return MemoryView(m_mem + first * m_planeStride, count, m_rows, m_columns,
+                          m_planeStride * step, m_rowStride);
+    }
+
+    /**
+     * Returns a view of \p count rows of every plane, starting at row \p first and
+     * advancing by \p step rows.
+     */
+    Vc_ALWAYS_INLINE MemoryView rows(std::size_t first, std::size_t count,
+                                     std::size_t step = 1) const
+    {
+        Vc_ASSERT(step > 0 && (count == 0 || first + (count - 1) * step < m_rows));
+        return MemoryView(m_mem + first * m_rowStride, m_planes, count, m_columns,
+                          m_planeStride, m_rowStride * step);
+    }
+
+    /**
+     * Returns a view of the columns [\p first, \p first + \p count) of all rows. The
+     * restrictions of MemoryView<V, 2>::columns apply.
+     */
+    Vc_ALWAYS_INLINE MemoryView columns(std::size_t first, std::size_t count) const
+    {
+        Vc_ASSERT(first % V::Size == 0 && first + count <= m_columns);
+        Vc_ASSERT(count % V::Size == 0 || first + count == m_columns);
+        return MemoryView(m_mem + first, m_planes, m_rows, count, m_planeStride,
+                          m_rowStride);
+    }
+
+    /**
+     * Copies the values of \p rhs plane by plane.
+     *
+     * \note Both objects must have the same extents.
+     */
+    inline MemoryView &operator=(const MemoryView &rhs)
+    {
+        assert(m_planes == rhs.m_planes && m_rows == rhs.m_rows &&
+               m_columns == rhs.m_columns);
+        for (std::size_t k = 0; k < m_planes; ++k) {
+            (*this)[k] = rhs[k];
+        }
+        return *this;
+    }
+
+    /**
+     * Initialize all rows with the given vector.
+     */
+    inline MemoryView &operator=(const V &v)
+    {
+        for (std::size_t k = 0; k < m_planes; ++k) {
+            (*this)[k] = v;
+        }
+        return *this;
+    }
+
+    /**
+     * Zero all rows.
+     */
+    inline void setZero() { *this = V::Zero(); }
+};
+
+template <typename V, int Rank = 2> class PaddedMemory;
+
+/**
+ * \ingroup Containers
+ * \headerfile paddedmemory.h <Vc/Memory>
+ *
+ * A dynamically allocated two-dimensional array with runtime extents. It is the
+ * runtime-sized counterpart to Memory<V, Size1, Size2>.
+ *
+ * Every row is padded to a multiple of \c V::Size entries and starts on an aligned
+ * address, so that rows can be processed with aligned vector loads and stores only:
+ * \code
+ * Vc::PaddedMemory<float_v> image(height, width);
+ * for (size_t y = 0; y < image.rowsCount(); ++y) {
+ *     for (auto &v : image[y]) {  // aligned, including the last (padded) vector
+ *         v = Vc::sqrt(v);
+ *     }
+ * }
+ * // whole-row expressions work as well (with <Vc/array_expression>):
+ * image[0] = image[1] * 0.5f + image[2] * 0.5f;
+ * \endcode
+ * The padding after the last column of every row, including the extra vectors of
+ * RowLayout::Skewed, is zero-initialized; the values are not.
+ *
+ * \param V The vector type you want to operate on. (e.g. float_v or uint_v)
+ *
+ * \see MemoryView, RowLayout
+ */
+template <typename V> class PaddedMemory<V, 2> : public MemoryView<V, 2>
+{
+    static_assert(V::MemoryAlignment <= 64,
+                  "PaddedMemory allocates on cacheline boundaries, which is insufficient "
+                  "for the requested vector type.");
+    typedef MemoryView<V, 2> Base;
+
+public:
+    typedef typename V::EntryType EntryType;
+
+private:
+    std::size_t allocatedEntries() const { return Base::m_rows * Base::m_rowStride; }
+
+    Vc_ALWAYS_INLINE PaddedMemory(std::size_t rows, std::size_t columns,
+                                  std::size_t rowStride)
+        : Base(Vc::malloc<EntryType, Vc::AlignOnCacheline>(rows * rowStride), rows,
+               columns, rowStride)
+    {
+    }
+
+public:
+    /**
+     * Allocates \p rows rows of \p columns values.
+     *
+     * \param layout Use RowLayout::Skewed for arrays that are accessed column-wise (e.g.
+     *               vertical filters), where the default padding may lead to 4K aliasing.
+     */
+    Vc_ALWAYS_INLINE PaddedMemory(std::size_t rows, std::size_t columns,
+                                  RowLayout layout = RowLayout::Padded)
+        : PaddedMemory(rows, columns, Detail::paddedStride<V>(columns, layout))
+    {
+        const std::size_t padding = Base::m_rowStride - columns;
+        if (padding > 0) {
+            for (std::size_t i = 0; i < rows; ++i) {
+                std::memset(Base::entries(i) + columns, 0, padding * sizeof(EntryType));
+            }
+        }
+    }
+
+    /**
+     * Copies the values and the layout of \p rhs.
+     */
+    Vc_ALWAYS_INLINE PaddedMemory(const PaddedMemory &rhs)
+        : PaddedMemory(rhs.m_rows, rhs.m_columns, rhs.m_rowStride)
+    {
+        std::memcpy(Base::m_mem, rhs.m_mem, allocatedEntries() * sizeof(EntryType));
+    }
+
+    /**
+     * Takes over the memory of \p rhs, leaving it empty.
+     */
+    Vc_ALWAYS_INLINE PaddedMemory(PaddedMemory &&rhs) : Base(rhs)
+    {
+        rhs.m_mem = nullptr;
+        rhs.m_rows = rhs.m_columns = 0;
+    }
+
+    /**
+     * Frees the memory which was allocated in the constructor.
+     */
+    Vc_ALWAYS_INLINE ~PaddedMemory() { Vc::free(Base::m_mem); }
+
+    /**
+     * Copies the values of \p rhs. Both objects must have the same extents.
+     */
+    Vc_ALWAYS_INLINE PaddedMemory &operator=(const PaddedMemory &rhs)
+    {
+        Base::operator=(rhs);
+        return *this;
+    }
+    using Base::operator=;
+
+    /**
+     * Swap the contents and extents of two PaddedMemory objects.
+     */
+    inline void swap(PaddedMemory &rhs)
+    {
+        std::swap(Base::m_mem, rhs.m_mem);
+        std::swap(Base::m_rows, rhs.m_rows);
+        std::swap(Base::m_columns, rhs.m_columns);
+        std::swap(Base::m_rowStride, rhs.m_rowStride);
+    }
+};
+
+/**
+ * \ingroup Containers
+ * \headerfile paddedmemory.h <Vc/Memory>
+ *
+ * A dynamically allocated three-dimensional array with runtime extents (e.g. a volume or
+ * a stack of images). Every row is padded and aligned as in PaddedMemory<V, 2>;
+ * operator[] returns the planes as two-dimensional views. The padding of the rows and
+ * the padding after the last row of every plane are zero-initialized; the values are
+ * not.
+ *
+ * \param V The vector type you want to operate on. (e.g. float_v or uint_v)
+ *
+ * \see MemoryView, RowLayout
+ */
+template <typename V> class PaddedMemory<V, 3> : public MemoryView<V, 3>
+{
+    static_assert(V::MemoryAlignment <= 64,
+                  "PaddedMemory allocates on cacheline boundaries, which is insufficient "
+                  "for the requested vector type.");
+    typedef MemoryView<V, 3> Base;
+
+public:
+    typedef typename V::EntryType EntryType;
+
+private:
+    std::size_t allocatedEntries() const { return Base::m_planes * Base::m_planeStride; }
+
+    Vc_ALWAYS_INLINE PaddedMemory(std::size_t planes, std::size_t rows,
+                                  std::size_t columns, std::size_t planeStride,
+                                  std::size_t rowStride)
+        : Base(Vc::malloc<EntryType, Vc::AlignOnCacheline>(planes * planeStride), planes,
+               rows, columns, planeStride, rowStride)
+    {
+    }
+
+public:
+    /**
+     * Allocates \p planes planes of \p rows rows of \p columns values.
+     *
+     * \param layout With RowLayout::Skewed both the row and the plane stride are skewed.
+     */
+    Vc_ALWAYS_INLINE PaddedMemory(std::size_t planes, std::size_t rows,
+                                  std::size_t columns,
+                                  RowLayout layout = RowLayout::Padded)
+        : PaddedMemory(planes, rows, columns,
+                       Detail::paddedStride<V>(
+                           rows * Detail::paddedStride<V>(columns, layout), layout),
+                       Detail::paddedStride<V>(columns, layout))
+    {
+        const std::size_t padding = Base::m_rowStride - columns;
+        const std::size_t planePadding = Base::m_planeStride - rows * Base::m_rowStride;
+        for (std::size_t k = 0; k < planes; ++k) {
+            if (padding > 0) {
+                for (std::size_t i = 0; i < rows; ++i) {
+                    std::memset(Base::entries(k, i) + columns, 0,
+                                padding * sizeof(EntryType));
+                }
+            }
+            std::memset(Base::entries(k, rows), 0, planePadding * sizeof(EntryType));
+        }
+    }
+
+    /**
+     * Copies the values and the layout of \p rhs.
+     */
+    Vc_ALWAYS_INLINE PaddedMemory(const PaddedMemory &rhs)
+        : PaddedMemory(rhs.m_planes, rhs.m_rows, rhs.m_columns, rhs.m_planeStride,
+                       rhs.m_rowStride)
+    {
+        std::memcpy(Base::m_mem, rhs.m_mem, allocatedEntries() * sizeof(EntryType));
+    }
+
+    /**
+     * Takes over the memory of \p rhs, leaving it empty.
+     */
+    Vc_ALWAYS_INLINE PaddedMemory(PaddedMemory &&rhs) : Base(rhs)
+    {
+        rhs.m_mem = nullptr;
+        rhs.m_planes = rhs.m_rows = rhs.m_columns = 0;
+    }
+
+    /**
+     * Frees the memory which was allocated in the constructor.
+     */
+    Vc_ALWAYS_INLINE ~PaddedMemory() { Vc::free(Base::m_mem); }
+
+    /**
+     * Copies the values of \p rhs. Both objects must have the same extents.
+     */
+    Vc_ALWAYS_INLINE PaddedMemory &operator=(const PaddedMemory &rhs)
+    {
+        Base::operator=(rhs);
+        return *this;
+    }
+    using Base::operator=;
+
+    /**
+     * Swap the contents and extents of two PaddedMemory objects.
+     */
+    inline void swap(PaddedMemory &rhs)
+    {
+        std::swap(Base::m_mem, rhs.m_mem);
+        std::swap(Base::m_planes, rhs.m_planes);
+        std::swap(Base::m_rows, rhs.m_rows);
+        std::swap(Base::m_columns, rhs.m_columns);
+        std::swap(Base::m_planeStride, rhs.m_planeStride);
+        std::swap(Base::m_rowStride, rhs.m_rowStride);
+    }
+};
+}  // namespace Common
+
+using Common::MemoryView;
+using Common::PaddedMemory;
+using Common::RowLayout;
+}  // namespace Vc
+
+#endif  // VC_COMMON_PADDEDMEMORY_H_
+
+// vim: foldmethod=marker
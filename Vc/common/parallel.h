@@ -0,0 +1,87 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_PARALLEL_H_
+#define VC_COMMON_PARALLEL_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/**\internal
+ * Returns the number of threads to use for \p count elements if the caller requested \p
+ * requested threads (0 selects std::thread::hardware_concurrency()). No thread gets fewer
+ * than \p grain elements.
+ */
+inline unsigned thread_count(std::size_t count, unsigned requested, std::size_t grain)
+{
+    if (requested == 0) {
+        requested = std::max(1u, std::thread::hardware_concurrency());
+    }
+    const std::size_t useful = std::max<std::size_t>(1, count / std::max<std::size_t>(1, grain));
+    return static_cast<unsigned>(std::min<std::size_t>(requested, useful));
+}
+
+/**\internal
+ * Splits `[0, count)` into \p nthreads contiguous chunks and calls `f(index, begin, end)`
+ * for every chunk. All chunk boundaries except \p count are multiples of \p align, so that
+ * vector loops over a chunk start on the same alignment as the whole range. The calling
+ * thread processes the last chunk itself.
+ */
+template <typename F>
+void parallel_chunks(std::size_t count, unsigned nthreads, std::size_t align, F &&f)
+{
+    if (nthreads <= 1) {
+        f(0u, std::size_t(0), count);
+        return;
+    }
+    align = std::max<std::size_t>(1, align);
+    const std::size_t chunk = (count / nthreads + align - 1) / align * align;
+    std::vector<std::thread> workers;
+    workers.reserve(nthreads - 1);
+    for (unsigned i = 0; i + 1 < nthreads; ++i) {
+        const std::size_t begin = std::min(count, i * chunk);
+        const std::size_t end = std::min(count, begin + chunk);
+        workers.emplace_back([&f, i, begin, end]() { f(i, begin, end); });
+    }
+    f(nthreads - 1, std::min(count, (nthreads - 1) * chunk), count);
+    for (auto &t : workers) {
+        t.join();
+    }
+}
+}  // namespace Common
+}  // namespace Vc
+
+#endif  // VC_COMMON_PARALLEL_H_
+
+// vim: foldmethod=marker
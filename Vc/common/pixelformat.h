@@ -0,0 +1,841 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_PIXELFORMAT_H_
+#define VC_COMMON_PIXELFORMAT_H_
+
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#include "image.h"
+#ifdef Vc_IMPL_SSSE3
+#include <tmmintrin.h>
+#endif
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace image
+{
+// pixel_format{{{1
+/**
+ * The byte order of packed 8-bit pixels. An image of packed pixels is a
+ * MemoryView<uchar_v, 2> with `channels(format) * width` columns.
+ */
+enum class pixel_format { rgb, bgr, rgba, bgra };
+
+/// The number of bytes per pixel of \p f.
+constexpr std::size_t channels(pixel_format f)
+{
+    return f == pixel_format::rgb || f == pixel_format::bgr ? 3 : 4;
+}
+
+/**
+ * The coefficients of the RGB to YCbCr conversion (Y'CbCr of gamma-encoded RGB, as every
+ * codec uses it).
+ */
+enum class yuv_matrix {
+    /// ITU-R BT.601 (standard definition video, JPEG): \f$K_R = 0.299, K_B = 0.114\f$.
+    bt601,
+    /// ITU-R BT.709 (high definition video): \f$K_R = 0.2126, K_B = 0.0722\f$.
+    bt709
+};
+
+/// The value range of the YCbCr samples.
+enum class yuv_range {
+    /// Y in [16, 235], Cb and Cr in [16, 240], as in video streams.
+    limited,
+    /// All samples in [0, 255], as in JPEG.
+    full
+};
+
+namespace Detail
+{
+template <typename V>
+using is_channel = std::integral_constant<bool, std::is_same<V, short_v>::value ||
+                                                    std::is_same<V, ushort_v>::value>;
+
+// deinterleave2/3/4, interleave2/3/4{{{1
+/**\internal
+ * Conversion between packed bytes and one 16-bit register per channel. The SSE
+ * implementations handle 8 pixels; AVX2 handles 16 pixels as two halves. All of them
+ * read and write exactly `channels * pixels` bytes, unaligned. Narrowing saturates the
+ * signed 16-bit values to [0, 255].
+ */
+#ifdef Vc_IMPL_SSE2
+Vc_INTRINSIC __m128i load16(const unsigned char *p)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+}
+Vc_INTRINSIC void store16(unsigned char *p, __m128i x)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p), x);
+}
+
+Vc_INTRINSIC void deinterleave2(const unsigned char *p, __m128i &a, __m128i &b)
+{
+    const __m128i x = load16(p);
+    a = _mm_and_si128(x, _mm_set1_epi16(0xff));
+    b = _mm_srli_epi16(x, 8);
+}
+Vc_INTRINSIC void interleave2(unsigned char *p, __m128i a, __m128i b)
+{
+    store16(p, _mm_unpacklo_epi8(_mm_packus_epi16(a, a), _mm_packus_epi16(b, b)));
+}
+
+#ifdef Vc_IMPL_SSSE3
+/// Channel \p C of pixels 0-3 from \p lo (bytes 0-15) and 4-7 from \p hi (bytes 8-23).
+template <int C> Vc_INTRINSIC __m128i channel3(__m128i lo, __m128i hi)
+{
+    const __m128i mlo = _mm_setr_epi8(C, -1, 3 + C, -1, 6 + C, -1, 9 + C, -1,  //
+                                      -1, -1, -1, -1, -1, -1, -1, -1);
+    const __m128i mhi = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,  //
+                                      4 + C, -1, 7 + C, -1, 10 + C, -1, 13 + C, -1);
+    return _mm_or_si128(_mm_shuffle_epi8(lo, mlo), _mm_shuffle_epi8(hi, mhi));
+}
+#endif
+
+inline void deinterleave3(const unsigned char *p, __m128i &a, __m128i &b, __m128i &c)
+{
+#ifdef Vc_IMPL_SSSE3
+    const __m128i lo = load16(p), hi = load16(p + 8);
+    a = channel3<0>(lo, hi);
+    b = channel3<1>(lo, hi);
+    c = channel3<2>(lo, hi);
+#else
+    alignas(16) short t[3][8];
+    for (int i = 0; i < 8; ++i) {
+        t[0][i] = p[3 * i];
+        t[1][i] = p[3 * i + 1];
+        t[2][i] = p[3 * i + 2];
+    }
+    a = _mm_load_si128(reinterpret_cast<const __m128i *>(t[0]));
+    b = _mm_load_si128(reinterpret_cast<const __m128i *>(t[1]));
+    c = _mm_load_si128(reinterpret_cast<const __m128i *>(t[2]));
+#endif
+}
+inline void interleave3(unsigned char *p, __m128i a, __m128i b, __m128i c)
+{
+    // bytes a0..a7 b0..b7 and c0..c7 c0..c7
+    const __m128i ab = _mm_packus_epi16(a, b), cc = _mm_packus_epi16(c, c);
+#ifdef Vc_IMPL_SSSE3
+    const __m128i lo = _mm_or_si128(
+        _mm_shuffle_epi8(ab, _mm_setr_epi8(0, 8, -1, 1, 9, -1, 2, 10,  //
+                                           -1, 3, 11, -1, 4, 12, -1, 5)),
+        _mm_shuffle_epi8(cc, _mm_setr_epi8(-1, -1, 0, -1, -1, 1, -1, -1,  //
+                                           2, -1, -1, 3, -1, -1, 4, -1)));
+    const __m128i hi = _mm_or_si128(
+        _mm_shuffle_epi8(ab, _mm_setr_epi8(13, -1, 6, 14, -1, 7, 15, -1,  //
+                                           -1, -1, -1, -1, -1, -1, -1, -1)),
+        _mm_shuffle_epi8(cc, _mm_setr_epi8(-1, 5, -1, -1, 6, -1, -1, 7,  //
+                                           -1, -1, -1, -1, -1, -1, -1, -1)));
+    store16(p, lo);
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(p + 16), hi);
+#else
+    alignas(16) unsigned char t[2][16];
+    _mm_store_si128(reinterpret_cast<__m128i *>(t[0]), ab);
+    _mm_store_si128(reinterpret_cast<__m128i *>(t[1]), cc);
+    for (int i = 0; i < 8; ++i) {
+        p[3 * i] = t[0][i];
+        p[3 * i + 1] = t[0][8 + i];
+        p[3 * i + 2] = t[1][i];
+    }
+#endif
+}
+
+Vc_INTRINSIC void deinterleave4(const unsigned char *p, __m128i &a, __m128i &b,
+                                __m128i &c, __m128i &d)
+{
+    const __m128i x = load16(p), y = load16(p + 16);
+    const __m128i mask = _mm_set1_epi32(0xff);
+    a = _mm_packs_epi32(_mm_and_si128(x, mask), _mm_and_si128(y, mask));
+    b = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(x, 8), mask),
+                        _mm_and_si128(_mm_srli_epi32(y, 8), mask));
+    c = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(x, 16), mask),
+                        _mm_and_si128(_mm_srli_epi32(y, 16), mask));
+    d = _mm_packs_epi32(_mm_srli_epi32(x, 24), _mm_srli_epi32(y, 24));
+}
+Vc_INTRINSIC void interleave4(unsigned char *p, __m128i a, __m128i b, __m128i c,
+                              __m128i d)
+{
+    const __m128i ab = _mm_unpacklo_epi8(_mm_packus_epi16(a, a), _mm_packus_epi16(b, b));
+    const __m128i cd = _mm_unpacklo_epi8(_mm_packus_epi16(c, c), _mm_packus_epi16(d, d));
+    store16(p, _mm_unpacklo_epi16(ab, cd));
+    store16(p + 16, _mm_unpackhi_epi16(ab, cd));
+}
+
+/**\internal
+ * The sums of adjacent lanes: `a0 + a1, a2 + a3, ..., b0 + b1, ...`.
+ */
+Vc_INTRINSIC __m128i pair_sums(__m128i a, __m128i b)
+{
+    const __m128i one = _mm_set1_epi16(1);
+    return _mm_packs_epi32(_mm_madd_epi16(a, one), _mm_madd_epi16(b, one));
+}
+#endif  // Vc_IMPL_SSE2
+
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m128i lo128(__m256i x) { return _mm256_castsi256_si128(x); }
+Vc_INTRINSIC __m128i hi128(__m256i x) { return _mm256_extracti128_si256(x, 1); }
+Vc_INTRINSIC __m256i concat(__m128i lo, __m128i hi)
+{
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+}
+
+Vc_INTRINSIC void deinterleave2(const unsigned char *p, __m256i &a, __m256i &b)
+{
+    __m128i a0, a1, b0, b1;
+    deinterleave2(p, a0, b0);
+    deinterleave2(p + 16, a1, b1);
+    a = concat(a0, a1);
+    b = concat(b0, b1);
+}
+Vc_INTRINSIC void interleave2(unsigned char *p, __m256i a, __m256i b)
+{
+    interleave2(p, lo128(a), lo128(b));
+    interleave2(p + 16, hi128(a), hi128(b));
+}
+Vc_INTRINSIC void deinterleave3(const unsigned char *p, __m256i &a, __m256i &b,
+                                __m256i &c)
+{
+    __m128i a0, a1, b0, b1, c0, c1;
+    deinterleave3(p, a0, b0, c0);
+    deinterleave3(p + 24, a1, b1, c1);
+    a = concat(a0, a1);
+    b = concat(b0, b1);
+    c = concat(c0, c1);
+}
+Vc_INTRINSIC void interleave3(unsigned char *p, __m256i a, __m256i b, __m256i c)
+{
+    interleave3(p, lo128(a), lo128(b), lo128(c));
+    interleave3(p + 24, hi128(a), hi128(b), hi128(c));
+}
+Vc_INTRINSIC void deinterleave4(const unsigned char *p, __m256i &a, __m256i &b,
+                                __m256i &c, __m256i &d)
+{
+    const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+    const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + 32));
+    const __m256i mask = _mm256_set1_epi32(0xff);
+    // packs works per 128-bit lane: pixels 0-3, 8-11 | 4-7, 12-15 are restored by 0xd8
+    const auto pack = [](__m256i l, __m256i h) {
+        return _mm256_permute4x64_epi64(_mm256_packs_epi32(l, h), 0xd8);
+    };
+    a = pack(_mm256_and_si256(x, mask), _mm256_and_si256(y, mask));
+    b = pack(_mm256_and_si256(_mm256_srli_epi32(x, 8), mask),
+             _mm256_and_si256(_mm256_srli_epi32(y, 8), mask));
+    c = pack(_mm256_and_si256(_mm256_srli_epi32(x, 16), mask),
+             _mm256_and_si256(_mm256_srli_epi32(y, 16), mask));
+    d = pack(_mm256_srli_epi32(x, 24), _mm256_srli_epi32(y, 24));
+}
+Vc_INTRINSIC void interleave4(unsigned char *p, __m256i a, __m256i b, __m256i c,
+                              __m256i d)
+{
+    interleave4(p, lo128(a), lo128(b), lo128(c), lo128(d));
+    interleave4(p + 32, hi128(a), hi128(b), hi128(c), hi128(d));
+}
+
+Vc_INTRINSIC __m256i pair_sums(__m256i a, __m256i b)
+{
+    const __m256i one = _mm256_set1_epi16(1);
+    return _mm256_permute4x64_epi64(
+        _mm256_packs_epi32(_mm256_madd_epi16(a, one), _mm256_madd_epi16(b, one)), 0xd8);
+}
+#endif  // Vc_IMPL_AVX2
+
+// the Scalar implementation: one pixel, one channel per register
+template <typename T> Vc_INTRINSIC T saturate_byte(T x)
+{
+    return x < 0 ? T(0) : x > 255 ? T(255) : x;
+}
+
+template <typename T, typename = enable_if<std::is_integral<T>::value>>
+Vc_INTRINSIC void deinterleave2(const unsigned char *p, T &a, T &b)
+{
+    a = p[0];
+    b = p[1];
+}
+template <typename T, typename = enable_if<std::is_integral<T>::value>>
+Vc_INTRINSIC void interleave2(unsigned char *p, T a, T b)
+{
+    p[0] = static_cast<unsigned char>(saturate_byte(a));
+    p[1] = static_cast<unsigned char>(saturate_byte(b));
+}
+template <typename T, typename = enable_if<std::is_integral<T>::value>>
+Vc_INTRINSIC void deinterleave3(const unsigned char *p, T &a, T &b, T &c)
+{
+    deinterleave2(p, a, b);
+    c = p[2];
+}
+template <typename T, typename = enable_if<std::is_integral<T>::value>>
+Vc_INTRINSIC void interleave3(unsigned char *p, T a, T b, T c)
+{
+    interleave2(p, a, b);
+    p[2] = static_cast<unsigned char>(saturate_byte(c));
+}
+template <typename T, typename = enable_if<std::is_integral<T>::value>>
+Vc_INTRINSIC void deinterleave4(const unsigned char *p, T &a, T &b, T &c, T &d)
+{
+    deinterleave2(p, a, b);
+    deinterleave2(p + 2, c, d);
+}
+template <typename T, typename = enable_if<std::is_integral<T>::value>>
+Vc_INTRINSIC void interleave4(unsigned char *p, T a, T b, T c, T d)
+{
+    interleave2(p, a, b);
+    interleave2(p + 2, c, d);
+}
+template <typename T, typename = enable_if<std::is_integral<T>::value>>
+Vc_INTRINSIC T pair_sums(T a, T b)
+{
+    return a + b;
+}
+}  // namespace Detail
+
+// deinterleave / interleave{{{1
+/**
+ * Loads V::Size pixels of two bytes each from \p pixels, widening channel \c i into \c
+ * ci. \c V is short_v or ushort_v. Exactly `2 * V::Size` bytes are read.
+ */
+template <typename V>
+Vc_INTRINSIC enable_if<Detail::is_channel<V>::value, void> deinterleave(
+    const unsigned char *pixels, V &c0, V &c1)
+{
+    Detail::deinterleave2(pixels, c0.data(), c1.data());
+}
+/// Loads V::Size pixels of three bytes each (e.g. pixel_format::rgb).
+template <typename V>
+Vc_INTRINSIC enable_if<Detail::is_channel<V>::value, void> deinterleave(
+    const unsigned char *pixels, V &c0, V &c1, V &c2)
+{
+    Detail::deinterleave3(pixels, c0.data(), c1.data(), c2.data());
+}
+/// Loads V::Size pixels of four bytes each (e.g. pixel_format::rgba).
+template <typename V>
+Vc_INTRINSIC enable_if<Detail::is_channel<V>::value, void> deinterleave(
+    const unsigned char *pixels, V &c0, V &c1, V &c2, V &c3)
+{
+    Detail::deinterleave4(pixels, c0.data(), c1.data(), c2.data(), c3.data());
+}
+
+/**
+ * Stores V::Size pixels of two bytes each to \p pixels. The channels are saturated to
+ * [0, 255] as signed 16-bit values, i.e. for ushort_v they must not exceed 32767.
+ */
+template <typename V>
+Vc_INTRINSIC enable_if<Detail::is_channel<V>::value, void> interleave(
+    unsigned char *pixels, const V &c0, const V &c1)
+{
+    Detail::interleave2(pixels, c0.data(), c1.data());
+}
+/// Stores V::Size pixels of three bytes each.
+template <typename V>
+Vc_INTRINSIC enable_if<Detail::is_channel<V>::value, void> interleave(
+    unsigned char *pixels, const V &c0, const V &c1, const V &c2)
+{
+    Detail::interleave3(pixels, c0.data(), c1.data(), c2.data());
+}
+/// Stores V::Size pixels of four bytes each.
+template <typename V>
+Vc_INTRINSIC enable_if<Detail::is_channel<V>::value, void> interleave(
+    unsigned char *pixels, const V &c0, const V &c1, const V &c2, const V &c3)
+{
+    Detail::interleave4(pixels, c0.data(), c1.data(), c2.data(), c3.data());
+}
+
+namespace Detail
+{
+// load_rgba / store_rgba{{{1
+/**\internal
+ * Reads short_v::Size pixels of format \p f into \p c in RGBA order. Formats without
+ * alpha are opaque.
+ */
+Vc_INTRINSIC void load_rgba(const unsigned char *p, pixel_format f, short_v (&c)[4])
+{
+    const bool bgr = f == pixel_format::bgr || f == pixel_format::bgra;
+    if (channels(f) == 3) {
+        deinterleave(p, c[bgr ? 2 : 0], c[1], c[bgr ? 0 : 2]);
+        c[3] = short_v(255);
+    } else {
+        deinterleave(p, c[bgr ? 2 : 0], c[1], c[bgr ? 0 : 2], c[3]);
+    }
+}
+/// Writes the RGBA channels \p c as short_v::Size pixels of format \p f.
+Vc_INTRINSIC void store_rgba(unsigned char *p, pixel_format f, const short_v (&c)[4])
+{
+    const bool bgr = f == pixel_format::bgr || f == pixel_format::bgra;
+    if (channels(f) == 3) {
+        interleave(p, c[bgr ? 2 : 0], c[1], c[bgr ? 0 : 2]);
+    } else {
+        interleave(p, c[bgr ? 2 : 0], c[1], c[bgr ? 0 : 2], c[3]);
+    }
+}
+
+// for_each_block{{{1
+/**\internal
+ * A row that a block kernel reads or writes: \c unit bytes per sample, one sample per \c
+ * step pixels (2 for subsampled chroma).
+ */
+template <typename T> struct BlockRow {
+    T *row;
+    std::size_t unit, step;
+};
+
+/**\internal
+ * Calls `f(in, out)` for every block of \p Block pixels of rows of \p n pixels, where \c
+ * in and \c out point at the block in every row of \p in and \p out. A partial last block
+ * is staged in local buffers, with the last sample of every input repeated, and only the
+ * samples inside of the rows are copied back.
+ */
+template <std::size_t Block, std::size_t NI, std::size_t NO, typename F>
+inline void for_each_block(std::size_t n, const BlockRow<const unsigned char> (&in)[NI],
+                           const BlockRow<unsigned char> (&out)[NO], F &&f)
+{
+    const unsigned char *ip[NI];
+    unsigned char *op[NO];
+    std::size_t x = 0;
+    for (; x + Block <= n; x += Block) {
+        for (std::size_t i = 0; i < NI; ++i) {
+            ip[i] = in[i].row + x / in[i].step * in[i].unit;
+        }
+        for (std::size_t i = 0; i < NO; ++i) {
+            op[i] = out[i].row + x / out[i].step * out[i].unit;
+        }
+        f(ip, op);
+    }
+    if (x == n) {
+        return;
+    }
+    alignas(64) unsigned char staged[NI + NO][4 * Block];
+    for (std::size_t i = 0; i < NI; ++i) {
+        const std::size_t unit = in[i].unit, step = in[i].step;
+        const std::size_t valid = (n - x + step - 1) / step;
+        std::memcpy(staged[i], in[i].row + x / step * unit, valid * unit);
+        for (std::size_t k = valid; k < Block / step; ++k) {
+            std::memcpy(staged[i] + k * unit, staged[i] + (valid - 1) * unit, unit);
+        }
+        ip[i] = staged[i];
+    }
+    for (std::size_t i = 0; i < NO; ++i) {
+        op[i] = staged[NI + i];
+    }
+    f(ip, op);
+    for (std::size_t i = 0; i < NO; ++i) {
+        const std::size_t unit = out[i].unit, step = out[i].step;
+        std::memcpy(out[i].row + x / step * unit, staged[NI + i],
+                    (n - x + step - 1) / step * unit);
+    }
+}
+
+/**\internal
+ * Calls `f(first, last)` for the rows [first, last) of \p rows rows, split into bands for
+ * image::thread_count.
+ */
+template <typename F>
+inline void for_each_band(std::size_t rows, std::size_t pixelsPerRow, unsigned threads,
+                          F &&f)
+{
+    const unsigned nthreads = thread_count(rows, pixelsPerRow, threads);
+    Common::parallel_chunks(rows, nthreads, 1,
+                            [&](unsigned, std::size_t first, std::size_t last) {
+                                f(first, last);
+                            });
+}
+
+// ColorTransform{{{1
+/**\internal
+ * An affine map of three 8-bit channels, `out = M * in + offset`, in 16-bit fixed point.
+ * The inputs are scaled by 2^7 and the coefficients by \f$2^{15-s}\f$, with the smallest
+ * \c s that fits the largest coefficient, so that mulhi yields the products with \c q = 6
+ * - s fraction bits. The offsets absorb rounding and the mean truncation of mulhi.
+ */
+class ColorTransform
+{
+public:
+    ColorTransform(const double (&m)[3][3], const double (&offset)[3])
+    {
+        double largest = 0;
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                largest = std::max(largest, std::abs(m[i][j]));
+            }
+        }
+        int s = 0;
+        while (largest * double(1 << (15 - s)) > 32767.) {
+            ++s;
+        }
+        Vc_ASSERT(s < 6);
+        m_shift = 6 - s;
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                m_coeff[i][j] =
+                    static_cast<short>(std::lround(m[i][j] * (1 << (15 - s))));
+            }
+            m_bias[i] = static_cast<short>(std::lround(offset[i] * (1 << m_shift)) +
+                                           (1 << (m_shift - 1)) + 1);
+        }
+    }
+
+    /// Output channel \p i of the inputs \p x0, \p x1, \p x2 that were shifted left by 7.
+    Vc_INTRINSIC short_v operator()(int i, const short_v &x0, const short_v &x1,
+                                    const short_v &x2) const
+    {
+        const short_v sum = mulhi(x0, short_v(m_coeff[i][0])) +
+                            mulhi(x1, short_v(m_coeff[i][1])) +
+                            mulhi(x2, short_v(m_coeff[i][2]));
+        return (sum + short_v(m_bias[i])) >> m_shift;
+    }
+
+private:
+    short m_coeff[3][3];
+    short m_bias[3];
+    int m_shift;
+};
+
+/**\internal
+ * The RGB to YCbCr map of \p matrix and \p range, or its inverse for \p inverse.
+ */
+inline ColorTransform yuv_transform(yuv_matrix matrix, yuv_range range, bool inverse)
+{
+    const double kr = matrix == yuv_matrix::bt601 ? 0.299 : 0.2126;
+    const double kb = matrix == yuv_matrix::bt601 ? 0.114 : 0.0722;
+    const double kg = 1 - kr - kb;
+    const bool full = range == yuv_range::full;
+    const double ys = full ? 1. : 219. / 255., cs = full ? 1. : 224. / 255.;
+    const double cb = cs / (2 * (1 - kb)), cr = cs / (2 * (1 - kr));
+    const double m[3][3] = {{ys * kr, ys * kg, ys * kb},
+                            {-cb * kr, -cb * kg, cb * (1 - kb)},
+                            {cr * (1 - kr), -cr * kg, -cr * kb}};
+    const double offset[3] = {full ? 0. : 16., 128., 128.};
+    if (!inverse) {
+        return {m, offset};
+    }
+    // in = M⁻¹ (out - offset), with M⁻¹ from the cofactors
+    double inv[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            const int r0 = (j + 1) % 3, r1 = (j + 2) % 3;
+            const int c0 = (i + 1) % 3, c1 = (i + 2) % 3;
+            inv[i][j] = m[r0][c0] * m[r1][c1] - m[r0][c1] * m[r1][c0];
+        }
+    }
+    const double det = m[0][0] * inv[0][0] + m[0][1] * inv[1][0] + m[0][2] * inv[2][0];
+    double bias[3];
+    for (int i = 0; i < 3; ++i) {
+        bias[i] = 0;
+        for (int j = 0; j < 3; ++j) {
+            inv[i][j] /= det;
+            bias[i] -= inv[i][j] * offset[j];
+        }
+    }
+    return {inv, bias};
+}
+}  // namespace Detail
+
+// convert{{{1
+/**
+ * Converts the packed pixels of \p in from format \p from to format \p to in \p out,
+ * reordering channels and dropping alpha or filling it with 255. Both images have the
+ * same number of rows and pixels per row.
+ */
+inline void convert(const MemoryView<uchar_v, 2> &in, pixel_format from,
+                    MemoryView<uchar_v, 2> out, pixel_format to, unsigned threads = 0)
+{
+    const std::size_t n = in.columnsCount() / channels(from);
+    Vc_ASSERT(in.rowsCount() == out.rowsCount());
+    Vc_ASSERT(n * channels(to) <= out.columnsCount());
+    Detail::for_each_band(in.rowsCount(), n, threads, [&](std::size_t first,
+                                                          std::size_t last) {
+        for (std::size_t y = first; y < last; ++y) {
+            Detail::for_each_block<short_v::Size>(
+                n, {{&in(y, 0), channels(from), 1}}, {{&out(y, 0), channels(to), 1}},
+                [&](const unsigned char *const *src, unsigned char *const *dst) {
+                    short_v c[4];
+                    Detail::load_rgba(src[0], from, c);
+                    Detail::store_rgba(dst[0], to, c);
+                });
+        }
+    });
+}
+
+// rgb_to_i420 / rgb_to_nv12{{{1
+namespace Detail
+{
+/**\internal
+ * Converts RGB to YCbCr 4:2:0 with Cb and Cr in the planes \p u and \p v (I420) or
+ * interleaved in \p u if \p v is \c nullptr (NV12). Every chroma sample is the mean of
+ * its 2x2 pixels.
+ */
+inline void rgb_to_yuv420(const MemoryView<uchar_v, 2> &rgb, pixel_format format,
+                          MemoryView<uchar_v, 2> &y, MemoryView<uchar_v, 2> &u,
+                          MemoryView<uchar_v, 2> *v, yuv_matrix matrix, yuv_range range,
+                          unsigned threads)
+{
+    constexpr std::size_t W = short_v::Size;
+    const std::size_t C = channels(format);
+    const std::size_t rows = y.rowsCount(), n = y.columnsCount();
+    Vc_ASSERT(rgb.rowsCount() == rows && rgb.columnsCount() >= n * C);
+    Vc_ASSERT(u.rowsCount() == (rows + 1) / 2);
+    Vc_ASSERT(u.columnsCount() >= (n + 1) / 2 * (v ? 1 : 2));
+    Vc_ASSERT(!v ||
+              (v->rowsCount() == u.rowsCount() && v->columnsCount() >= (n + 1) / 2));
+    const ColorTransform T = yuv_transform(matrix, range, false);
+    for_each_band(u.rowsCount(), 2 * n, threads, [&](std::size_t first,
+                                                     std::size_t last) {
+        Row<unsigned char> discard(padded(n));
+        for (std::size_t cy = first; cy < last; ++cy) {
+            const std::size_t y0 = 2 * cy, y1 = std::min(y0 + 1, rows - 1);
+            const auto block = [&](const unsigned char *const *src,
+                                   unsigned char *const *dst) {
+                short_v c[2][2][4];  // [row][half][channel]
+                for (int t = 0; t < 2; ++t) {
+                    for (int h = 0; h < 2; ++h) {
+                        load_rgba(src[t] + h * W * C, format, c[t][h]);
+                        store_bytes((T(0, c[t][h][0] << 7, c[t][h][1] << 7,
+                                       c[t][h][2] << 7)).data(),
+                                    dst[t] + h * W);
+                    }
+                }
+                short_v mean[3];
+                for (int k = 0; k < 3; ++k) {
+                    const short_v sum(pair_sums((c[0][0][k] + c[1][0][k]).data(),
+                                                (c[0][1][k] + c[1][1][k]).data()));
+                    mean[k] = ((sum + short_v(2)) >> 2) << 7;
+                }
+                const short_v cb = T(1, mean[0], mean[1], mean[2]);
+                const short_v cr = T(2, mean[0], mean[1], mean[2]);
+                if (v) {
+                    store_bytes(cb.data(), dst[2]);
+                    store_bytes(cr.data(), dst[3]);
+                } else {
+                    interleave(dst[2], cb, cr);
+                }
+            };
+            unsigned char *y1out = y1 == y0 ? discard.data() : &y(y1, 0);
+            if (v) {
+                for_each_block<2 * W>(
+                    n, {{&rgb(y0, 0), C, 1}, {&rgb(y1, 0), C, 1}},
+                    {{&y(y0, 0), 1, 1}, {y1out, 1, 1}, {&u(cy, 0), 1, 2},
+                     {&(*v)(cy, 0), 1, 2}},
+                    block);
+            } else {
+                for_each_block<2 * W>(
+                    n, {{&rgb(y0, 0), C, 1}, {&rgb(y1, 0), C, 1}},
+                    {{&y(y0, 0), 1, 1}, {y1out, 1, 1}, {&u(cy, 0), 2, 2}}, block);
+            }
+        }
+    });
+}
+}  // namespace Detail
+
+/**
+ * Converts the packed pixels of \p rgb to YCbCr 4:2:0 in three planes (I420, also called
+ * YUV420p): \p y has the size of the image, \p u (Cb) and \p v (Cr) have half its
+ * rows and columns, rounded up. Every chroma sample is the mean of its 2x2 pixels; at
+ * odd sizes the last row or column is repeated.
+ */
+inline void rgb_to_i420(const MemoryView<uchar_v, 2> &rgb, pixel_format format,
+                        MemoryView<uchar_v, 2> y, MemoryView<uchar_v, 2> u,
+                        MemoryView<uchar_v, 2> v, yuv_matrix matrix = yuv_matrix::bt601,
+                        yuv_range range = yuv_range::limited, unsigned threads = 0)
+{
+    Detail::rgb_to_yuv420(rgb, format, y, u, &v, matrix, range, threads);
+}
+
+/**
+ * Converts the packed pixels of \p rgb to NV12: the luma plane \p y and one plane \p uv
+ * of interleaved Cb, Cr pairs with half the rows and columns of \p y, rounded up (i.e.
+ * \p uv has `2 * ((width + 1) / 2)` columns). Chroma is subsampled as in rgb_to_i420.
+ */
+inline void rgb_to_nv12(const MemoryView<uchar_v, 2> &rgb, pixel_format format,
+                        MemoryView<uchar_v, 2> y, MemoryView<uchar_v, 2> uv,
+                        yuv_matrix matrix = yuv_matrix::bt601,
+                        yuv_range range = yuv_range::limited, unsigned threads = 0)
+{
+    Detail::rgb_to_yuv420(rgb, format, y, uv, nullptr, matrix, range, threads);
+}
+
+// i420_to_rgb / nv12_to_rgb{{{1
+namespace Detail
+{
+/**\internal
+ * The inverse of rgb_to_yuv420. Every chroma sample is used for its 2x2 pixels.
+ */
+inline void yuv420_to_rgb(const MemoryView<uchar_v, 2> &y,
+                          const MemoryView<uchar_v, 2> &u,
+                          const MemoryView<uchar_v, 2> *v, MemoryView<uchar_v, 2> &rgb,
+                          pixel_format format, yuv_matrix matrix, yuv_range range,
+                          unsigned threads)
+{
+    constexpr std::size_t W = short_v::Size;
+    const std::size_t C = channels(format);
+    const std::size_t rows = y.rowsCount(), n = y.columnsCount();
+    Vc_ASSERT(rgb.rowsCount() == rows && rgb.columnsCount() >= n * C);
+    Vc_ASSERT(u.rowsCount() == (rows + 1) / 2);
+    Vc_ASSERT(u.columnsCount() >= (n + 1) / 2 * (v ? 1 : 2));
+    Vc_ASSERT(!v ||
+              (v->rowsCount() == u.rowsCount() && v->columnsCount() >= (n + 1) / 2));
+    const ColorTransform T = yuv_transform(matrix, range, true);
+    for_each_band(u.rowsCount(), 2 * n, threads, [&](std::size_t first,
+                                                     std::size_t last) {
+        Row<unsigned char> discard(padded(n * C));
+        for (std::size_t cy = first; cy < last; ++cy) {
+            const std::size_t y0 = 2 * cy, y1 = std::min(y0 + 1, rows - 1);
+            const auto block = [&](const unsigned char *const *src,
+                                   unsigned char *const *dst) {
+                short_v cb, cr;
+                if (v) {
+                    cb = short_v(src[2], Vc::Unaligned);
+                    cr = short_v(src[3], Vc::Unaligned);
+                } else {
+                    deinterleave(src[2], cb, cr);
+                }
+                cb <<= 7;
+                cr <<= 7;
+                // nearest neighbor: every sample for two adjacent pixels
+                const short_v chroma[2][2] = {
+                    {cb.interleaveLow(cb), cb.interleaveHigh(cb)},
+                    {cr.interleaveLow(cr), cr.interleaveHigh(cr)}};
+                for (int t = 0; t < 2; ++t) {
+                    for (int h = 0; h < 2; ++h) {
+                        const short_v luma = short_v(src[t] + h * W, Vc::Unaligned) << 7;
+                        const short_v c[4] = {T(0, luma, chroma[0][h], chroma[1][h]),
+                                              T(1, luma, chroma[0][h], chroma[1][h]),
+                                              T(2, luma, chroma[0][h], chroma[1][h]),
+                                              short_v(255)};
+                        store_rgba(dst[t] + h * W * C, format, c);
+                    }
+                }
+            };
+            unsigned char *y1out = y1 == y0 ? discard.data() : &rgb(y1, 0);
+            if (v) {
+                for_each_block<2 * W>(n, {{&y(y0, 0), 1, 1}, {&y(y1, 0), 1, 1},
+                                          {&u(cy, 0), 1, 2}, {&(*v)(cy, 0), 1, 2}},
+                                      {{&rgb(y0, 0), C, 1}, {y1out, C, 1}}, block);
+            } else {
+                for_each_block<2 * W>(
+                    n, {{&y(y0, 0), 1, 1}, {&y(y1, 0), 1, 1}, {&u(cy, 0), 2, 2}},
+                    {{&rgb(y0, 0), C, 1}, {y1out, C, 1}}, block);
+            }
+        }
+    });
+}
+}  // namespace Detail
+
+/**
+ * Converts the I420 planes \p y, \p u, \p v (see rgb_to_i420) to packed pixels in \p
+ * rgb. Pixels with alpha are opaque.
+ */
+inline void i420_to_rgb(const MemoryView<uchar_v, 2> &y, const MemoryView<uchar_v, 2> &u,
+                        const MemoryView<uchar_v, 2> &v, MemoryView<uchar_v, 2> rgb,
+                        pixel_format format, yuv_matrix matrix = yuv_matrix::bt601,
+                        yuv_range range = yuv_range::limited, unsigned threads = 0)
+{
+    Detail::yuv420_to_rgb(y, u, &v, rgb, format, matrix, range, threads);
+}
+
+/// Converts the NV12 planes \p y, \p uv (see rgb_to_nv12) to packed pixels in \p rgb.
+inline void nv12_to_rgb(const MemoryView<uchar_v, 2> &y, const MemoryView<uchar_v, 2> &uv,
+                        MemoryView<uchar_v, 2> rgb, pixel_format format,
+                        yuv_matrix matrix = yuv_matrix::bt601,
+                        yuv_range range = yuv_range::limited, unsigned threads = 0)
+{
+    Detail::yuv420_to_rgb(y, uv, nullptr, rgb, format, matrix, range, threads);
+}
+
+// premultiply / blend_over{{{1
+namespace Detail
+{
+/// \f$x / 255\f$ rounded to nearest, exact for \f$x \le 255^2\f$.
+Vc_INTRINSIC ushort_v div255(ushort_v x)
+{
+    x += ushort_v(128);
+    return (x + (x >> 8)) >> 8;
+}
+}  // namespace Detail
+
+/**
+ * Multiplies the color channels of the pixels in \p in with their alpha, \f$c \cdot a /
+ * 255\f$ rounded to nearest, and writes them to \p out. The pixels are 4 bytes with alpha
+ * last (pixel_format::rgba or pixel_format::bgra).
+ */
+inline void premultiply(const MemoryView<uchar_v, 2> &in, MemoryView<uchar_v, 2> out,
+                        unsigned threads = 0)
+{
+    const std::size_t n = in.columnsCount() / 4;
+    Vc_ASSERT(in.rowsCount() == out.rowsCount() && out.columnsCount() >= 4 * n);
+    Detail::for_each_band(in.rowsCount(), n, threads, [&](std::size_t first,
+                                                          std::size_t last) {
+        for (std::size_t y = first; y < last; ++y) {
+            Detail::for_each_block<ushort_v::Size>(
+                n, {{&in(y, 0), 4, 1}}, {{&out(y, 0), 4, 1}},
+                [&](const unsigned char *const *src, unsigned char *const *dst) {
+                    ushort_v c0, c1, c2, a;
+                    deinterleave(src[0], c0, c1, c2, a);
+                    interleave(dst[0], Detail::div255(c0 * a), Detail::div255(c1 * a),
+                               Detail::div255(c2 * a), a);
+                });
+        }
+    });
+}
+
+/**
+ * Composites the premultiplied pixels of \p src over those of \p dst (Porter-Duff
+ * "over"): every channel, alpha included, becomes \f$s + d \cdot (255 - a_s) / 255\f$,
+ * rounded to nearest and saturated. Both images have the same size and 4-byte pixels
+ * with alpha last (pixel_format::rgba or pixel_format::bgra).
+ */
+inline void blend_over(const MemoryView<uchar_v, 2> &src, MemoryView<uchar_v, 2> dst,
+                       unsigned threads = 0)
+{
+    const std::size_t n = src.columnsCount() / 4;
+    Vc_ASSERT(src.rowsCount() == dst.rowsCount() && dst.columnsCount() >= 4 * n);
+    Detail::for_each_band(src.rowsCount(), n, threads, [&](std::size_t first,
+                                                           std::size_t last) {
+        for (std::size_t y = first; y < last; ++y) {
+            Detail::for_each_block<ushort_v::Size>(
+                n, {{&src(y, 0), 4, 1}, {&dst(y, 0), 4, 1}}, {{&dst(y, 0), 4, 1}},
+                [&](const unsigned char *const *in, unsigned char *const *out) {
+                    ushort_v s[4], d[4];
+                    deinterleave(in[0], s[0], s[1], s[2], s[3]);
+                    deinterleave(in[1], d[0], d[1], d[2], d[3]);
+                    const ushort_v t = ushort_v(255) - s[3];
+                    for (int k = 0; k < 4; ++k) {
+                        d[k] = s[k] + Detail::div255(d[k] * t);
+                    }
+                    interleave(out[0], d[0], d[1], d[2], d[3]);
+                });
+        }
+    });
+}
+//}}}1
+}  // namespace image
+}  // namespace Vc
+
+#endif  // VC_COMMON_PIXELFORMAT_H_
+
+// vim: foldmethod=marker
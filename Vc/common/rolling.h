@@ -0,0 +1,865 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_ROLLING_H_
+#define VC_COMMON_ROLLING_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../vector.h"
+#include "summation.h"
+#include "vectorwidth.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// rolling_block {{{1
+/**\internal
+ * Sums and variances of windows up to this length are computed directly. The running
+ * update has an error that grows with the square root of the block length times the
+ * magnitude of the samples, which would dominate the sums of very short windows.
+ */
+constexpr std::size_t rolling_direct_limit = 16;
+
+/**\internal
+ * Returns the number of windows that the kernels compute from one starting point. Every
+ * block of windows starts from a compensated sum over its first window, so the rounding
+ * errors of the running update accumulate over one block only: about
+ * \f$\sqrt{\mathrm{block}}\,\varepsilon\max|x|\f$, which stays below a few ulp of the
+ * sum of magnitudes of a window longer than rolling_direct_limit. With at least four
+ * windows per window length, the restarts cost at most a quarter of a load per output.
+ */
+inline std::size_t rolling_block(std::size_t window)
+{
+    return std::max<std::size_t>(256, 4 * window);
+}
+
+// running_sum {{{1
+/**\internal
+ * The running total of a difference scan over scalars: the total is kept as an
+ * unevaluated sum of two values (TwoSum), so that the carry does not drift.
+ */
+template <typename T> struct scalar_running_sum {
+    T hi, lo;
+    T add(T d)
+    {
+        T err;
+        hi = two_sum(hi, d, err);
+        lo += err;
+        return hi + lo;
+    }
+};
+
+/**\internal
+ * The vector variant: `scan(d)` returns the total plus the inclusive prefix sums of \p d
+ * (Vector::partialSum) and advances the total by the sum over \p d. Only the additions
+ * within one vector round; the carry from vector to vector is compensated. The TwoSum is
+ * not on the loop-carried dependency chain, which is a single addition per vector.
+ */
+template <typename V> struct running_sum {
+    using T = typename V::EntryType;
+    V hi, lo;
+    explicit running_sum(T init) : hi(init), lo(V::Zero()) {}
+    Vc_INTRINSIC V scan(const V &d)
+    {
+        const V p = d.partialSum();
+        const V r = hi + (lo + p);
+        V err;
+        hi = two_sum(hi, V(p[V::Size - 1]), err);
+        lo += err;
+        return r;
+    }
+    scalar_running_sum<T> scalar() const { return {hi[0], lo[0]}; }
+};
+
+// rolling_sum_block {{{1
+/**\internal
+ * Writes the sums (or means) of the \p m windows of length \p w starting at
+ * `x[0..m)`. The first window is summed with compensation; every following one is
+ * the previous sum plus `x[i + w - 1] - x[i - 1]`.
+ */
+template <bool Mean, typename T>
+inline void rolling_sum_block(const T *x, std::size_t w, std::size_t m, T *out,
+                              std::true_type)
+{
+    using V = Vector<T>;
+    const T first = accurate_sum_impl(x, w, std::true_type());
+    const T scale = Mean ? T(w) : T(1);
+    out[0] = first / scale;
+    running_sum<V> total(first);
+    std::size_t i = 1;
+    for (; i + V::Size <= m; i += V::Size) {
+        const V d = V(x + i + w - 1, Vc::Unaligned) - V(x + i - 1, Vc::Unaligned);
+        const V s = total.scan(d);
+        (Mean ? s / V(scale) : s).store(out + i, Vc::Unaligned);
+    }
+    scalar_running_sum<T> tail = total.scalar();
+    for (; i < m; ++i) {
+        out[i] = tail.add(x[i + w - 1] - x[i - 1]) / scale;
+    }
+}
+
+template <bool Mean, typename T>
+inline void rolling_sum_block(const T *x, std::size_t w, std::size_t m, T *out,
+                              std::false_type)
+{
+    const T first = accurate_sum_impl(x, w, std::false_type());
+    const T scale = Mean ? T(w) : T(1);
+    out[0] = first / scale;
+    scalar_running_sum<T> total = {first, T()};
+    for (std::size_t i = 1; i < m; ++i) {
+        out[i] = total.add(x[i + w - 1] - x[i - 1]) / scale;
+    }
+}
+
+// direct_moments_block {{{1
+/**\internal
+ * Sums (or means) of short windows: every output vector is the sum of \p w overlapping
+ * loads. For short windows this is as fast as the running update and has no error beyond
+ * that of the \p w - 1 additions, while the error of the running update does not shrink
+ * with the window.
+ */
+template <bool Mean, typename T>
+inline void direct_sum_block(const T *x, std::size_t w, std::size_t m, T *out,
+                             std::false_type)
+{
+    const T scale = Mean ? T(w) : T(1);
+    for (std::size_t i = 0; i < m; ++i) {
+        T s = x[i];
+        for (std::size_t j = 1; j < w; ++j) {
+            s += x[i + j];
+        }
+        out[i] = s / scale;
+    }
+}
+
+template <bool Mean, typename T>
+inline void direct_sum_block(const T *x, std::size_t w, std::size_t m, T *out,
+                             std::true_type)
+{
+    using V = Vector<T>;
+    const V scale = Mean ? T(w) : T(1);
+    std::size_t i = 0;
+    for (; i + V::Size <= m; i += V::Size) {
+        V s(x + i, Vc::Unaligned);
+        for (std::size_t j = 1; j < w; ++j) {
+            s += V(x + i + j, Vc::Unaligned);
+        }
+        (Mean ? s / scale : s).store(out + i, Vc::Unaligned);
+    }
+    direct_sum_block<Mean>(x + i, w, m - i, out + i, std::false_type());
+}
+
+/**\internal
+ * Variances of short windows, each computed with two passes over its \p w samples.
+ */
+template <typename T>
+inline void direct_variance_block(const T *x, std::size_t w, std::size_t m, T *out,
+                                  T divisor, std::false_type)
+{
+    for (std::size_t i = 0; i < m; ++i) {
+        T s = x[i];
+        for (std::size_t j = 1; j < w; ++j) {
+            s += x[i + j];
+        }
+        const T mean = s / T(w);
+        T m2 = 0;
+        for (std::size_t j = 0; j < w; ++j) {
+            m2 += (x[i + j] - mean) * (x[i + j] - mean);
+        }
+        out[i] = m2 / divisor;
+    }
+}
+
+template <typename T>
+inline void direct_variance_block(const T *x, std::size_t w, std::size_t m, T *out,
+                                  T divisor, std::true_type)
+{
+    using V = Vector<T>;
+    std::size_t i = 0;
+    for (; i + V::Size <= m; i += V::Size) {
+        V s(x + i, Vc::Unaligned);
+        for (std::size_t j = 1; j < w; ++j) {
+            s += V(x + i + j, Vc::Unaligned);
+        }
+        const V mean = s / T(w);
+        V m2 = V::Zero();
+        for (std::size_t j = 0; j < w; ++j) {
+            const V d = V(x + i + j, Vc::Unaligned) - mean;
+            m2 += d * d;
+        }
+        (m2 / divisor).store(out + i, Vc::Unaligned);
+    }
+    direct_variance_block(x + i, w, m - i, out + i, divisor, std::false_type());
+}
+
+// rolling_variance_block {{{1
+/**\internal
+ * Writes the variances of the \p m windows of length \p w starting at `x[0..m)`. The
+ * samples are shifted by the mean of the first window, so that the sum of squares stays
+ * small and `s2 - s1 * s1 / w` does not cancel catastrophically (the shifted-data
+ * algorithm). The shift is renewed with every block.
+ */
+template <typename T>
+inline void rolling_variance_block(const T *x, std::size_t w, std::size_t m, T *out,
+                                   T divisor, std::true_type)
+{
+    using V = Vector<T>;
+    const T shift = accurate_sum_impl(x, w, std::true_type()) / T(w);
+    const V k = shift;
+    CompensatedAccumulator<V> a1, a2;
+    std::size_t j = 0;
+    for (; j + V::Size <= w; j += V::Size) {
+        const V y = V(x + j, Vc::Unaligned) - k;
+        a1 += y;
+        a2 += y * y;
+    }
+    scalar_compensated<T> s1, s2;
+    s1.add(a1.sum());
+    s2.add(a2.sum());
+    for (; j < w; ++j) {
+        const T y = x[j] - shift;
+        s1.add(y);
+        s2.add(y * y);
+    }
+    const T inv_w = T(1) / T(w);
+    const T first1 = s1.value(), first2 = s2.value();
+    out[0] = std::max(first2 - first1 * first1 * inv_w, T()) / divisor;
+
+    running_sum<V> sum1(first1), sum2(first2);
+    std::size_t i = 1;
+    for (; i + V::Size <= m; i += V::Size) {
+        const V yn = V(x + i + w - 1, Vc::Unaligned) - k;
+        const V yo = V(x + i - 1, Vc::Unaligned) - k;
+        const V t1 = sum1.scan(yn - yo);
+        const V t2 = sum2.scan(yn * yn - yo * yo);
+        (Vc::max(t2 - t1 * t1 * inv_w, V::Zero()) / divisor)
+            .store(out + i, Vc::Unaligned);
+    }
+    scalar_running_sum<T> tail1 = sum1.scalar(), tail2 = sum2.scalar();
+    for (; i < m; ++i) {
+        const T yn = x[i + w - 1] - shift, yo = x[i - 1] - shift;
+        const T t1 = tail1.add(yn - yo);
+        const T t2 = tail2.add(yn * yn - yo * yo);
+        out[i] = std::max(t2 - t1 * t1 * inv_w, T()) / divisor;
+    }
+}
+
+template <typename T>
+inline void rolling_variance_block(const T *x, std::size_t w, std::size_t m, T *out,
+                                   T divisor, std::false_type)
+{
+    const T shift = accurate_sum_impl(x, w, std::false_type()) / T(w);
+    scalar_compensated<T> s1, s2;
+    for (std::size_t j = 0; j < w; ++j) {
+        const T y = x[j] - shift;
+        s1.add(y);
+        s2.add(y * y);
+    }
+    const T inv_w = T(1) / T(w);
+    scalar_running_sum<T> sum1 = {s1.value(), T()}, sum2 = {s2.value(), T()};
+    out[0] = std::max(sum2.hi - sum1.hi * sum1.hi * inv_w, T()) / divisor;
+    for (std::size_t i = 1; i < m; ++i) {
+        const T yn = x[i + w - 1] - shift, yo = x[i - 1] - shift;
+        const T t1 = sum1.add(yn - yo);
+        const T t2 = sum2.add(yn * yn - yo * yo);
+        out[i] = std::max(t2 - t1 * t1 * inv_w, T()) / divisor;
+    }
+}
+
+// extremum policies {{{1
+template <typename T> struct rolling_min_op {
+    static T identity() { return std::numeric_limits<T>::max(); }
+    static T combine(T a, T b) { return b < a ? b : a; }
+    template <typename V> static Vc_INTRINSIC V combine(const V &a, const V &b)
+    {
+        return Vc::min(a, b);
+    }
+};
+
+template <typename T> struct rolling_max_op {
+    static T identity() { return std::numeric_limits<T>::lowest(); }
+    static T combine(T a, T b) { return a < b ? b : a; }
+    template <typename V> static Vc_INTRINSIC V combine(const V &a, const V &b)
+    {
+        return Vc::max(a, b);
+    }
+};
+
+// van Herk/Gil-Werman {{{1
+/**\internal
+ * Writes the running extremum of `x[from..to)` to \p pre, restarting at every multiple of
+ * \p w, and returns it.
+ */
+template <typename Op, typename T>
+inline T segment_prefix(const T *x, std::size_t from, std::size_t to, std::size_t w,
+                        T carry, T *pre)
+{
+    std::size_t r = from % w;
+    for (std::size_t i = from; i < to; ++i) {
+        pre[i] = carry = r == 0 ? x[i] : Op::combine(carry, x[i]);
+        if (++r == w) {
+            r = 0;
+        }
+    }
+    return carry;
+}
+
+/**\internal
+ * Writes the extremum from every index in `[0, to)` up to the end of its segment of
+ * length \p w to \p suf. \p carry is the value at index \p to.
+ */
+template <typename Op, typename T>
+inline void segment_suffix(const T *x, std::size_t to, std::size_t w, T carry, T *suf)
+{
+    std::size_t r = to % w;
+    for (std::size_t i = to; i > 0;) {
+        --i;
+        r = r == 0 ? w - 1 : r - 1;
+        suf[i] = carry = r == w - 1 ? x[i] : Op::combine(x[i], carry);
+    }
+}
+
+/**\internal
+ * The steps of a log-step scan within a vector, towards higher lanes for \p Dir = -1
+ * (prefix scan) and towards lower lanes for \p Dir = 1 (suffix scan). The recursion makes
+ * the shift amounts compile-time constants, so that every shift is a single permutation.
+ */
+template <typename Op, int Dir, std::size_t Step, std::size_t Size, bool = (Step < Size)>
+struct scan_steps {
+    template <typename V> static Vc_INTRINSIC void apply(V &v, const V &fill)
+    {
+        v = Op::combine(v, v.shifted(Dir * int(Step), fill));
+        scan_steps<Op, Dir, 2 * Step, Size>::apply(v, fill);
+    }
+
+    /*
+     * The segmented variant restarts at the segment head \p b. \p lane holds the lane
+     * indexes in scan order: `0, 1, ...` for a prefix scan and reversed for a suffix
+     * scan. With at most one segment head per vector, the lanes that must not combine in
+     * a step follow from comparisons with the lane index, instead of being propagated by
+     * shifting a mask as in segmented_scan.
+     */
+    template <typename V>
+    static Vc_INTRINSIC void apply(V &v, const V &lane, const V &b, const V &fill)
+    {
+        const auto stop = lane >= b && lane < b + typename V::EntryType(Step);
+        v(!stop) = Op::combine(v, v.shifted(Dir * int(Step), fill));
+        scan_steps<Op, Dir, 2 * Step, Size>::apply(v, lane, b, fill);
+    }
+};
+template <typename Op, int Dir, std::size_t Step, std::size_t Size>
+struct scan_steps<Op, Dir, Step, Size, false> {
+    template <typename V> static Vc_INTRINSIC void apply(V &, const V &) {}
+    template <typename V>
+    static Vc_INTRINSIC void apply(V &, const V &, const V &, const V &)
+    {
+    }
+};
+
+/**\internal
+ * Rolling extremum of the \p m windows of length \p w > V::Size starting at `x[0..m)`
+ * (van Herk 1992, Gil and Werman 1993): the input is cut into segments of length \p w,
+ * and every window consists of the suffix of one segment and the prefix of the next. So
+ * the extremum over a window is that of one suffix and one prefix scan, independent of
+ * \p w. Inside a vector the segmented scans are log-step scans that stop at the segment
+ * boundaries, like in segmented_scan.
+ *
+ * \p pre needs room for `m + w - 1` and \p suf for `m + w - 1` values.
+ */
+template <typename Op, typename T>
+inline void van_herk_block(const T *x, std::size_t w, std::size_t m, T *out, T *pre,
+                           T *suf, std::true_type)
+{
+    using V = Vector<T>;
+    const V lane = V::IndexesFromZero();
+    const V reversed = T(V::Size - 1) - lane;
+    const V fill = Op::identity();
+    // The segment head of a vector in scan order, or 2 * Size if it has none. A vector
+    // never holds more than one, because w > Size.
+    auto head_lane = [](std::size_t k) { return V(T(std::min(k, 2 * V::Size))); };
+
+    // forward pass: prefix scans over [0, m + w - 1)
+    const std::size_t n_pre = m + w - 1;
+    std::size_t i = 0;
+    V carry = fill;
+    for (std::size_t r = 0; i + V::Size <= n_pre; i += V::Size) {
+        V v(x + i, Vc::Unaligned);
+        const std::size_t h = r == 0 ? 0 : w - r;
+        // Broadcasting before the carry is applied keeps the broadcast off the
+        // loop-carried dependency chain, which is then a single min/max.
+        if (h >= V::Size) {  // most vectors lie inside one segment
+            scan_steps<Op, -1, 1, V::Size>::apply(v, fill);
+            const V back = V(v[V::Size - 1]);
+            Op::combine(v, carry).store(pre + i, Vc::Unaligned);
+            carry = Op::combine(back, carry);
+        } else {
+            const V head = head_lane(h);
+            scan_steps<Op, -1, 1, V::Size>::apply(v, lane, head, fill);
+            const V back = V(v[V::Size - 1]);
+            v(lane < head) = Op::combine(v, carry);
+            v.store(pre + i, Vc::Unaligned);
+            carry = back;
+        }
+        r += V::Size;
+        if (r >= w) {
+            r -= w;
+        }
+    }
+    segment_prefix<Op>(x, i, n_pre, w, T(carry[0]), pre);
+
+    // backward pass: suffix scans over [0, k * w), which covers every window start
+    const std::size_t n_suf = (m + w - 1) / w * w;
+    i = n_suf;
+    carry = fill;
+    if (i >= V::Size) {
+        std::size_t r = (i - V::Size) % w;
+        for (; i >= V::Size; r = r >= V::Size ? r - V::Size : r + w - V::Size) {
+            i -= V::Size;
+            V v(x + i, Vc::Unaligned);
+            // the last lane of a segment is the head of the suffix scan
+            const std::size_t last = w - 1 - r;
+            if (last >= V::Size) {
+                scan_steps<Op, 1, 1, V::Size>::apply(v, fill);
+                const V front = V(v[0]);
+                Op::combine(v, carry).store(suf + i, Vc::Unaligned);
+                carry = Op::combine(front, carry);
+            } else {
+                const V head = head_lane(V::Size - 1 - last);
+                scan_steps<Op, 1, 1, V::Size>::apply(v, reversed, head, fill);
+                const V front = V(v[0]);
+                v(reversed < head) = Op::combine(v, carry);
+                v.store(suf + i, Vc::Unaligned);
+                carry = front;
+            }
+        }
+    }
+    segment_suffix<Op>(x, i, w, T(carry[0]), suf);
+
+    // combine the suffix at the window start with the prefix at the window end
+    i = 0;
+    for (; i + V::Size <= m; i += V::Size) {
+        Op::combine(V(suf + i, Vc::Unaligned), V(pre + i + w - 1, Vc::Unaligned))
+            .store(out + i, Vc::Unaligned);
+    }
+    for (; i < m; ++i) {
+        out[i] = Op::combine(suf[i], pre[i + w - 1]);
+    }
+}
+
+template <typename Op, typename T>
+inline void van_herk_block(const T *x, std::size_t w, std::size_t m, T *out, T *pre,
+                           T *suf, std::false_type)
+{
+    const std::size_t n_suf = (m + w - 1) / w * w;
+    segment_prefix<Op>(x, 0, m + w - 1, w, Op::identity(), pre);
+    segment_suffix<Op>(x, n_suf, w, Op::identity(), suf);
+    for (std::size_t i = 0; i < m; ++i) {
+        out[i] = Op::combine(suf[i], pre[i + w - 1]);
+    }
+}
+
+/**\internal
+ * Rolling extremum for short windows: every output vector is the extremum of \p w
+ * overlapping loads, which is cheaper than the three passes of van_herk_block.
+ */
+template <typename Op, typename T>
+inline void direct_extremum_block(const T *x, std::size_t w, std::size_t m, T *out,
+                                  std::false_type)
+{
+    for (std::size_t i = 0; i < m; ++i) {
+        T r = x[i];
+        for (std::size_t j = 1; j < w; ++j) {
+            r = Op::combine(r, x[i + j]);
+        }
+        out[i] = r;
+    }
+}
+
+template <typename Op, typename T>
+inline void direct_extremum_block(const T *x, std::size_t w, std::size_t m, T *out,
+                                  std::true_type)
+{
+    using V = Vector<T>;
+    std::size_t i = 0;
+    for (; i + V::Size <= m; i += V::Size) {
+        V r(x + i, Vc::Unaligned);
+        for (std::size_t j = 1; j < w; ++j) {
+            r = Op::combine(r, V(x + i + j, Vc::Unaligned));
+        }
+        r.store(out + i, Vc::Unaligned);
+    }
+    direct_extremum_block<Op>(x + i, w, m - i, out + i, std::false_type());
+}
+
+// kernels {{{1
+/**\internal
+ * The kernels compute the statistic of the \p count windows of length window() that start
+ * at `x[0..count)`; \p x must hold `count + window() - 1` samples. They work in blocks
+ * of rolling_block() windows.
+ */
+template <typename T, bool Mean> class rolling_sum_kernel
+{
+    static_assert(std::is_floating_point<T>::value,
+                  "Vc::rolling_sum and Vc::rolling_mean require a floating-point type");
+
+public:
+    explicit rolling_sum_kernel(std::size_t window) : m_window(window) {}
+    std::size_t window() const { return m_window; }
+
+    void operator()(const T *x, std::size_t count, T *out)
+    {
+        if (m_window <= rolling_direct_limit) {
+            direct_sum_block<Mean>(x, m_window, count, out,
+                                   Traits::is_valid_vector_argument<T>());
+            return;
+        }
+        const std::size_t block = rolling_block(m_window);
+        for (std::size_t b = 0; b < count; b += block) {
+            rolling_sum_block<Mean>(x + b, m_window, std::min(block, count - b), out + b,
+                                    Traits::is_valid_vector_argument<T>());
+        }
+    }
+
+private:
+    std::size_t m_window;
+};
+
+template <typename T> class rolling_variance_kernel
+{
+    static_assert(std::is_floating_point<T>::value,
+                  "Vc::rolling_variance requires a floating-point type");
+
+public:
+    explicit rolling_variance_kernel(std::size_t window, std::size_t ddof = 0)
+        : m_window(window), m_ddof(ddof)
+    {
+    }
+    std::size_t window() const { return m_window; }
+
+    void operator()(const T *x, std::size_t count, T *out)
+    {
+        if (m_window <= m_ddof) {
+            std::fill_n(out, count, std::numeric_limits<T>::quiet_NaN());
+            return;
+        }
+        if (m_window <= rolling_direct_limit) {
+            direct_variance_block(x, m_window, count, out, T(m_window - m_ddof),
+                                  Traits::is_valid_vector_argument<T>());
+            return;
+        }
+        const std::size_t block = rolling_block(m_window);
+        for (std::size_t b = 0; b < count; b += block) {
+            rolling_variance_block(x + b, m_window, std::min(block, count - b), out + b,
+                                   T(m_window - m_ddof),
+                                   Traits::is_valid_vector_argument<T>());
+        }
+    }
+
+private:
+    std::size_t m_window, m_ddof;
+};
+
+template <typename T, typename Op> class rolling_extremum_kernel
+{
+    using Vectorized = Traits::is_valid_vector_argument<T>;
+    static constexpr std::size_t Width = vector_width<T>::value;
+
+public:
+    /// Windows up to this length use direct_extremum_block, which is faster there.
+    static constexpr std::size_t DirectLimit = Width < 6 ? 8 : 3 * Width / 2;
+
+    explicit rolling_extremum_kernel(std::size_t window) : m_window(window) {}
+    std::size_t window() const { return m_window; }
+
+    void operator()(const T *x, std::size_t count, T *out)
+    {
+        const std::size_t w = m_window;
+        if (w <= DirectLimit) {
+            direct_extremum_block<Op>(x, w, count, out, Vectorized());
+            return;
+        }
+        const std::size_t block = rolling_block(w);
+        m_scratch.resize(2 * (std::min(block, count) + w - 1));
+        T *pre = m_scratch.data();
+        T *suf = pre + m_scratch.size() / 2;
+        for (std::size_t b = 0; b < count; b += block) {
+            van_herk_block<Op>(x + b, w, std::min(block, count - b), out + b, pre, suf,
+                               Vectorized());
+        }
+    }
+
+private:
+    std::size_t m_window;
+    std::vector<T> m_scratch;
+};
+
+// rolling_apply {{{1
+template <typename Kernel, typename InputIt, typename OutputIt, typename... Args>
+inline OutputIt rolling_apply(InputIt first, InputIt last, std::size_t window,
+                              OutputIt d_first, Args... args)
+{
+    Vc_ASSERT(window > 0);
+    const std::size_t n = std::distance(first, last);
+    if (n < window) {
+        return d_first;
+    }
+    Kernel kernel(window, args...);
+    kernel(std::addressof(*first), n - window + 1, std::addressof(*d_first));
+    return d_first + (n - window + 1);
+}
+// }}}1
+}  // namespace Common
+
+/**
+ * \ingroup Utilities
+ * \headerfile rolling.h <Vc/rolling>
+ *
+ * Computes a rolling-window statistic over a stream of samples that arrives in chunks.
+ * The last `window() - 1` samples are kept between calls to push(), so the outputs are
+ * the same as if the whole stream had been passed to the corresponding free function
+ * (e.g. rolling_sum()) at once, up to rounding: there is one output per complete window,
+ * i.e. `max(0, n - window() + 1)` outputs after \p n samples. Windows that lie within one
+ * chunk are computed directly from its samples; only `window() - 1` samples per chunk are
+ * copied. Every push() also costs about as much as `window()` samples, so chunks much
+ * shorter than the window are slower per sample.
+ *
+ * \code
+ * Vc::RollingMean<float> mean(20);
+ * std::vector<float> out(chunk.size());
+ * while (read(chunk)) {
+ *     auto end = mean.push(chunk.begin(), chunk.end(), out.begin());
+ *     consume(out.begin(), end);
+ * }
+ * \endcode
+ *
+ * \tparam T The sample type.
+ * \tparam Kernel The statistic; use the aliases RollingSum, RollingMean, RollingVariance,
+ *                RollingMin and RollingMax.
+ */
+template <typename T, typename Kernel> class RollingWindow
+{
+public:
+    /**
+     * Starts a stream with windows of \p window samples. Additional arguments are passed
+     * to the statistic (the \c ddof of RollingVariance).
+     */
+    template <typename... Args>
+    explicit RollingWindow(std::size_t window, Args... args) : m_kernel(window, args...)
+    {
+        Vc_ASSERT(window > 0);
+        m_history.reserve(2 * (window - 1));
+    }
+
+    /// Returns the window length.
+    std::size_t window() const { return m_kernel.window(); }
+
+    /// Drops the buffered samples; the next push() starts a new stream.
+    void reset() { m_history.clear(); }
+
+    /**
+     * Appends the contiguous range [\p first, \p last) to the stream and writes the
+     * statistic of every window that is now complete to the contiguous output starting
+     * at \p d_first. That is at most `std::distance(first, last)` values; the output must
+     * not overlap the input.
+     *
+     * \return The iterator past the last element written.
+     */
+    template <typename InputIt, typename OutputIt>
+    OutputIt push(InputIt first, InputIt last, OutputIt d_first)
+    {
+        const std::size_t n = std::distance(first, last);
+        if (n == 0) {
+            return d_first;
+        }
+        return d_first + push_impl(std::addressof(*first), n, std::addressof(*d_first));
+    }
+
+private:
+    std::size_t push_impl(const T *in, std::size_t n, T *out)
+    {
+        const std::size_t w = window();
+        // The windows that start in the history need up to w - 1 of the new samples.
+        m_history.insert(m_history.end(), in, in + std::min(n, w - 1));
+        std::size_t written = 0;
+        if (m_history.size() >= w) {
+            written = m_history.size() - w + 1;
+            m_kernel(m_history.data(), written, out);
+        }
+        if (n >= w) {
+            m_kernel(in, n - w + 1, out + written);
+            written += n - w + 1;
+        }
+        if (n >= w - 1) {
+            m_history.assign(in + n - (w - 1), in + n);
+        } else if (m_history.size() > w - 1) {
+            m_history.erase(m_history.begin(), m_history.end() - (w - 1));
+        }
+        return written;
+    }
+
+    Kernel m_kernel;
+    std::vector<T> m_history;
+};
+
+/// Streaming rolling_sum(): `RollingSum<float> s(window); s.push(first, last, out);`
+template <typename T>
+using RollingSum = RollingWindow<T, Common::rolling_sum_kernel<T, false>>;
+/// Streaming rolling_mean().
+template <typename T>
+using RollingMean = RollingWindow<T, Common::rolling_sum_kernel<T, true>>;
+/// Streaming rolling_variance(); the constructor takes `(window, ddof = 0)`.
+template <typename T>
+using RollingVariance = RollingWindow<T, Common::rolling_variance_kernel<T>>;
+/// Streaming rolling_min().
+template <typename T>
+using RollingMin =
+    RollingWindow<T, Common::rolling_extremum_kernel<T, Common::rolling_min_op<T>>>;
+/// Streaming rolling_max().
+template <typename T>
+using RollingMax =
+    RollingWindow<T, Common::rolling_extremum_kernel<T, Common::rolling_max_op<T>>>;
+
+/**
+ * \ingroup Utilities
+ * \headerfile rolling.h <Vc/rolling>
+ *
+ * Writes the sum of every window of \p window consecutive elements of the contiguous
+ * floating-point range [\p first, \p last) to the contiguous output starting at
+ * \p d_first: `n - window + 1` values for `n >= window`, none otherwise. The output must
+ * not overlap the input.
+ *
+ * The cost does not depend on \p window: every sum is the previous one plus the
+ * difference of the entering and the leaving sample, and the differences are added up
+ * with in-register prefix sums (Vector::partialSum). The running total is compensated and
+ * restarted from an accurately summed window every max(256, 4 · window) outputs, so the
+ * error does not grow with the length of the input. Windows of up to 16 elements are
+ * summed directly.
+ *
+ * \return The iterator past the last element written.
+ * \see RollingSum for input that arrives in chunks.
+ */
+template <typename InputIt, typename OutputIt>
+inline OutputIt rolling_sum(InputIt first, InputIt last, std::size_t window,
+                            OutputIt d_first)
+{
+    using T = typename std::iterator_traits<InputIt>::value_type;
+    using Kernel = Common::rolling_sum_kernel<T, false>;
+    return Common::rolling_apply<Kernel>(first, last, window, d_first);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile rolling.h <Vc/rolling>
+ *
+ * Like rolling_sum(), but writes the mean of every window.
+ */
+template <typename InputIt, typename OutputIt>
+inline OutputIt rolling_mean(InputIt first, InputIt last, std::size_t window,
+                             OutputIt d_first)
+{
+    using T = typename std::iterator_traits<InputIt>::value_type;
+    using Kernel = Common::rolling_sum_kernel<T, true>;
+    return Common::rolling_apply<Kernel>(first, last, window, d_first);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile rolling.h <Vc/rolling>
+ *
+ * Like rolling_sum(), but writes the variance of every window: \f$m_2 / (w -
+ * \mathrm{ddof})\f$ with \f$m_2\f$ the sum of squared deviations from the window mean,
+ * i.e. the population variance by default and the sample variance for \p ddof = 1. NaN
+ * if \p window ≤ \p ddof.
+ *
+ * The sums of the samples and of their squares are updated like in rolling_sum(), after
+ * shifting the samples by the mean of the first window of each block. This keeps the
+ * result accurate unless the data moves by many standard deviations within
+ * max(256, 4 · window) samples. Windows of up to 16 elements use the two-pass algorithm.
+ */
+template <typename InputIt, typename OutputIt>
+inline OutputIt rolling_variance(InputIt first, InputIt last, std::size_t window,
+                                 OutputIt d_first, std::size_t ddof = 0)
+{
+    using T = typename std::iterator_traits<InputIt>::value_type;
+    using Kernel = Common::rolling_variance_kernel<T>;
+    return Common::rolling_apply<Kernel>(first, last, window, d_first, ddof);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile rolling.h <Vc/rolling>
+ *
+ * Writes the minimum of every window of \p window consecutive elements of the contiguous
+ * range [\p first, \p last) to the contiguous output starting at \p d_first, like
+ * rolling_sum(). Works for all arithmetic types; the result for a window containing NaN
+ * is unspecified.
+ *
+ * Short windows take the minimum of \p window overlapping vector loads. Longer ones use
+ * the van Herk/Gil-Werman algorithm, whose cost does not depend on the window length: it
+ * cuts the input into segments of length \p window and combines a segmented
+ * prefix-minimum scan with a segmented suffix-minimum scan, both computed with log-step
+ * scans inside the vectors.
+ *
+ * \see RollingMin for input that arrives in chunks.
+ */
+template <typename InputIt, typename OutputIt>
+inline OutputIt rolling_min(InputIt first, InputIt last, std::size_t window,
+                            OutputIt d_first)
+{
+    using T = typename std::iterator_traits<InputIt>::value_type;
+    using Kernel = Common::rolling_extremum_kernel<T, Common::rolling_min_op<T>>;
+    return Common::rolling_apply<Kernel>(first, last, window, d_first);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile rolling.h <Vc/rolling>
+ *
+ * Like rolling_min(), but writes the maximum of every window.
+ */
+template <typename InputIt, typename OutputIt>
+inline OutputIt rolling_max(InputIt first, InputIt last, std::size_t window,
+                            OutputIt d_first)
+{
+    using T = typename std::iterator_traits<InputIt>::value_type;
+    using Kernel = Common::rolling_extremum_kernel<T, Common::rolling_max_op<T>>;
+    return Common::rolling_apply<Kernel>(first, last, window, d_first);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_ROLLING_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,391 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SCAN_H_
+#define VC_COMMON_SCAN_H_
+
+#include <iterator>
+#include <memory>
+#include <vector>
+#include "../vector.h"
+#include "parallel.h"
+#include "vectorwidth.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// inclusive_scan_impl {{{1
+/**\internal
+ * Writes the inclusive prefix sums of `in[0..n)` plus \p carry to \p out and returns the
+ * last sum (or \p carry if \p n is 0). \p in and \p out may be equal.
+ */
+template <typename T>
+inline T inclusive_scan_impl(const T *in, std::size_t n, T *out, T carry, std::true_type)
+{
+    using V = Vector<T>;
+    std::size_t i = 0;
+    if (n >= V::Size) {
+        V c = carry;
+        for (; i + V::Size <= n; i += V::Size) {
+            V x = V(in + i, Vc::Unaligned).partialSum() + c;
+            x.store(out + i, Vc::Unaligned);
+            c = V(x[V::Size - 1]);
+        }
+        carry = c[0];
+    }
+    for (; i < n; ++i) {
+        out[i] = carry = static_cast<T>(carry + in[i]);
+    }
+    return carry;
+}
+
+template <typename T>
+inline T inclusive_scan_impl(const T *in, std::size_t n, T *out, T carry, std::false_type)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = carry = static_cast<T>(carry + in[i]);
+    }
+    return carry;
+}
+
+// exclusive_scan_impl {{{1
+/**\internal
+ * Writes the exclusive prefix sums of `in[0..n)` starting at \p carry to \p out and
+ * returns the sum over all of `in` plus \p carry.
+ */
+template <typename T>
+inline T exclusive_scan_impl(const T *in, std::size_t n, T *out, T carry, std::true_type)
+{
+    using V = Vector<T>;
+    std::size_t i = 0;
+    if (n >= V::Size) {
+        V c = carry;
+        for (; i + V::Size <= n; i += V::Size) {
+            const V p = V(in + i, Vc::Unaligned).partialSum();
+            (p.shifted(-1) + c).store(out + i, Vc::Unaligned);
+            c += V(p[V::Size - 1]);
+        }
+        carry = c[0];
+    }
+    for (; i < n; ++i) {
+        const T x = in[i];
+        out[i] = carry;
+        carry = static_cast<T>(carry + x);
+    }
+    return carry;
+}
+
+template <typename T>
+inline T exclusive_scan_impl(const T *in, std::size_t n, T *out, T carry, std::false_type)
+{
+    for (std::size_t i = 0; i < n; ++i) {
+        const T x = in[i];
+        out[i] = carry;
+        carry = static_cast<T>(carry + x);
+    }
+    return carry;
+}
+
+// segmented_scan_impl {{{1
+/**\internal
+ * Inclusive scan that restarts at every index where \p flags is \c true.
+ */
+template <typename T>
+inline void segmented_scan_impl(const T *in, std::size_t n, const bool *flags, T *out,
+                                std::true_type)
+{
+    using V = Vector<T>;
+    using M = typename V::mask_type;
+    std::size_t i = 0;
+    T carry = T();
+    if (n >= V::Size) {
+        V c = carry;
+        for (; i + V::Size <= n; i += V::Size) {
+            V x(in + i, Vc::Unaligned);
+            M f(flags + i, Vc::Unaligned);
+            // Hillis-Steele scan over (flag, value) pairs: a lane only accumulates from
+            // its left neighbors until it has seen a segment head.
+            for (std::size_t s = 1; s < V::Size; s *= 2) {
+                x(!f) += x.shifted(-int(s));
+                f |= f.shifted(-int(s));
+            }
+            x(!f) += c;
+            x.store(out + i, Vc::Unaligned);
+            c = V(x[V::Size - 1]);
+        }
+        carry = c[0];
+    }
+    for (; i < n; ++i) {
+        out[i] = carry = static_cast<T>(flags[i] ? in[i] : carry + in[i]);
+    }
+}
+
+template <typename T>
+inline void segmented_scan_impl(const T *in, std::size_t n, const bool *flags, T *out,
+                                std::false_type)
+{
+    T carry = T();
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = carry = static_cast<T>(flags[i] ? in[i] : carry + in[i]);
+    }
+}
+
+// range_sum {{{1
+/**\internal
+ * Returns the sum of `in[0..n)`, using Vector<T> if possible.
+ */
+template <typename T> inline T range_sum(const T *in, std::size_t n, std::true_type)
+{
+    using V = Vector<T>;
+    V acc = V::Zero();
+    std::size_t i = 0;
+    for (; i + V::Size <= n; i += V::Size) {
+        acc += V(in + i, Vc::Unaligned);
+    }
+    T sum = acc.sum();
+    for (; i < n; ++i) {
+        sum = static_cast<T>(sum + in[i]);
+    }
+    return sum;
+}
+
+template <typename T> inline T range_sum(const T *in, std::size_t n, std::false_type)
+{
+    T sum = T();
+    for (std::size_t i = 0; i < n; ++i) {
+        sum = static_cast<T>(sum + in[i]);
+    }
+    return sum;
+}
+
+// parallel_scan_impl {{{1
+/**\internal
+ * Two-pass multithreaded scan: every thread first reduces its chunk, the chunk sums are
+ * scanned serially, and then every thread scans its chunk starting from its offset.
+ */
+template <bool Inclusive, typename T>
+inline void parallel_scan_impl(const T *in, std::size_t n, T *out, T init,
+                               unsigned threads)
+{
+    using Vectorize = Traits::is_valid_vector_argument<T>;
+    constexpr std::size_t Grain = 1 << 16;
+    const unsigned nthreads = thread_count(n, threads, Grain);
+    if (nthreads <= 1) {
+        if (Inclusive) {
+            inclusive_scan_impl(in, n, out, init, Vectorize());
+        } else {
+            exclusive_scan_impl(in, n, out, init, Vectorize());
+        }
+        return;
+    }
+    std::vector<T> offsets(nthreads);
+    parallel_chunks(n, nthreads, vector_width<T>::value,
+                    [&](unsigned t, std::size_t begin, std::size_t end) {
+                        offsets[t] = range_sum(in + begin, end - begin, Vectorize());
+                    });
+    exclusive_scan_impl(offsets.data(), nthreads, offsets.data(), init, std::false_type());
+    parallel_chunks(n, nthreads, vector_width<T>::value,
+                    [&](unsigned t, std::size_t begin, std::size_t end) {
+                        if (Inclusive) {
+                            inclusive_scan_impl(in + begin, end - begin, out + begin,
+                                                offsets[t], Vectorize());
+                        } else {
+                            exclusive_scan_impl(in + begin, end - begin, out + begin,
+                                                offsets[t], Vectorize());
+                        }
+                    });
+}
+//}}}1
+}  // namespace Common
+
+/**
+ * \ingroup Utilities
+ * \headerfile scan.h <Vc/algorithm>
+ *
+ * Vc variant of the `std::inclusive_scan` algorithm for contiguous ranges.
+ *
+ * Writes `init + first[0] + ... + first[i]` to `d_first[i]` for every `i` in the range.
+ * The sums within one vector are computed with Vector::partialSum and the running total
+ * is carried to the next vector as a broadcast. Element types that have no Vc::Vector
+ * (e.g. 64-bit integers) are summed with a scalar loop.
+ *
+ * \param first, last The contiguous input range.
+ * \param d_first The beginning of the contiguous output range. It may equal \p first.
+ * \param init The value added to all sums.
+ * \return The iterator past the last element written.
+ *
+ * \note The order of floating-point additions differs from a sequential loop, so results
+ * for \c float and \c double may differ in the last bits.
+ */
+template <typename InputIt, typename OutputIt, typename T>
+inline OutputIt inclusive_scan(InputIt first, InputIt last, OutputIt d_first, T init)
+{
+    using U = typename std::iterator_traits<InputIt>::value_type;
+    const std::size_t n = std::distance(first, last);
+    if (n > 0) {
+        Common::inclusive_scan_impl<U>(std::addressof(*first), n,
+                                       std::addressof(*d_first), static_cast<U>(init),
+                                       Traits::is_valid_vector_argument<U>());
+    }
+    return d_first + n;
+}
+
+///\copydoc inclusive_scan
+template <typename InputIt, typename OutputIt>
+inline OutputIt inclusive_scan(InputIt first, InputIt last, OutputIt d_first)
+{
+    using U = typename std::iterator_traits<InputIt>::value_type;
+    return inclusive_scan(first, last, d_first, U());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile scan.h <Vc/algorithm>
+ *
+ * Vc variant of the `std::exclusive_scan` algorithm for contiguous ranges.
+ *
+ * Writes `init + first[0] + ... + first[i - 1]` to `d_first[i]` for every `i` in the
+ * range, i.e. `d_first[0] == init`.
+ *
+ * \param first, last The contiguous input range.
+ * \param d_first The beginning of the contiguous output range. It may equal \p first.
+ * \param init The first output value.
+ * \return The iterator past the last element written.
+ */
+template <typename InputIt, typename OutputIt, typename T>
+inline OutputIt exclusive_scan(InputIt first, InputIt last, OutputIt d_first, T init)
+{
+    using U = typename std::iterator_traits<InputIt>::value_type;
+    const std::size_t n = std::distance(first, last);
+    if (n > 0) {
+        Common::exclusive_scan_impl<U>(std::addressof(*first), n,
+                                       std::addressof(*d_first), static_cast<U>(init),
+                                       Traits::is_valid_vector_argument<U>());
+    }
+    return d_first + n;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile scan.h <Vc/algorithm>
+ *
+ * Inclusive scan that restarts at every segment head.
+ *
+ * `d_first[i]` is the sum of `first[j..i]`, where `j` is the largest index `<= i` with
+ * `flags[j] == true` (or 0 if there is no such index). Inside each vector the segments are
+ * combined with a log-step scan on (flag, value) pairs, so the cost does not depend on the
+ * number or length of the segments.
+ *
+ * \param first, last The contiguous input range.
+ * \param flags A contiguous range of \c bool of the same length, marking segment heads.
+ * \param d_first The beginning of the contiguous output range. It may equal \p first.
+ * \return The iterator past the last element written.
+ */
+template <typename InputIt, typename FlagIt, typename OutputIt>
+inline OutputIt segmented_scan(InputIt first, InputIt last, FlagIt flags,
+                               OutputIt d_first)
+{
+    using T = typename std::iterator_traits<InputIt>::value_type;
+    static_assert(std::is_same<typename std::iterator_traits<FlagIt>::value_type,
+                               bool>::value,
+                  "segmented_scan requires a contiguous range of bool as flags");
+    const std::size_t n = std::distance(first, last);
+    if (n > 0) {
+        Common::segmented_scan_impl<T>(std::addressof(*first), n,
+                                       std::addressof(*flags), std::addressof(*d_first),
+                                       Traits::is_valid_vector_argument<T>());
+    }
+    return d_first + n;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile scan.h <Vc/algorithm>
+ *
+ * Multithreaded variant of Vc::inclusive_scan for large arrays.
+ *
+ * The range is split into one chunk per thread. The first pass reduces every chunk in
+ * parallel, the chunk sums are scanned, and the second pass scans every chunk starting
+ * from its offset. Ranges too short to be worth splitting run on the calling thread.
+ *
+ * \param first, last The contiguous input range.
+ * \param d_first The beginning of the contiguous output range. It may equal \p first.
+ * \param init The value added to all sums.
+ * \param threads The number of threads to use. 0 selects
+ *                `std::thread::hardware_concurrency()`.
+ * \return The iterator past the last element written.
+ */
+template <typename InputIt, typename OutputIt, typename T>
+inline OutputIt parallel_inclusive_scan(InputIt first, InputIt last, OutputIt d_first,
+                                        T init, unsigned threads = 0)
+{
+    using U = typename std::iterator_traits<InputIt>::value_type;
+    const std::size_t n = std::distance(first, last);
+    if (n > 0) {
+        Common::parallel_scan_impl<true, U>(std::addressof(*first), n,
+                                            std::addressof(*d_first),
+                                            static_cast<U>(init), threads);
+    }
+    return d_first + n;
+}
+
+///\copydoc parallel_inclusive_scan
+template <typename InputIt, typename OutputIt>
+inline OutputIt parallel_inclusive_scan(InputIt first, InputIt last, OutputIt d_first)
+{
+    using U = typename std::iterator_traits<InputIt>::value_type;
+    return parallel_inclusive_scan(first, last, d_first, U());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile scan.h <Vc/algorithm>
+ *
+ * Multithreaded variant of Vc::exclusive_scan for large arrays.
+ *
+ * \see parallel_inclusive_scan
+ */
+template <typename InputIt, typename OutputIt, typename T>
+inline OutputIt parallel_exclusive_scan(InputIt first, InputIt last, OutputIt d_first,
+                                        T init, unsigned threads = 0)
+{
+    using U = typename std::iterator_traits<InputIt>::value_type;
+    const std::size_t n = std::distance(first, last);
+    if (n > 0) {
+        Common::parallel_scan_impl<false, U>(std::addressof(*first), n,
+                                             std::addressof(*d_first),
+                                             static_cast<U>(init), threads);
+    }
+    return d_first + n;
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_SCAN_H_
+
+// vim: foldmethod=marker
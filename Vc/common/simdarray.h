@@ -307,6 +307,16 @@ public:
         data.store(std::forward<Args>(args)...);
     }
 
+    Vc_INTRINSIC void load_partial(const value_type *mem, std::size_t n)
+    {
+        data.load_partial(mem, n);
+    }
+
+    Vc_INTRINSIC void store_partial(value_type *mem, std::size_t n) const
+    {
+        data.store_partial(mem, n);
+    }
+
     Vc_INTRINSIC mask_type operator!() const
     {
         return {private_init, !data};
@@ -946,6 +956,24 @@ public:
         data1.store(mem + storage_type0::size(), Split::hi(std::forward<Args>(args))...);
     }
 
+    Vc_INTRINSIC void load_partial(const value_type *mem, std::size_t n)
+    {
+        data0.load_partial(mem, n);
+        if (n > N0) {
+            data1.load_partial(mem + N0, n - N0);
+        } else {
+            data1.setZero();
+        }
+    }
+
+    Vc_INTRINSIC void store_partial(value_type *mem, std::size_t n) const
+    {
+        data0.store_partial(mem, n);
+        if (n > N0) {
+            data1.store_partial(mem + N0, n - N0);
+        }
+    }
+
     Vc_INTRINSIC mask_type operator!() const
     {
         return {!data0, !data1};
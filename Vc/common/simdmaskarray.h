@@ -152,6 +152,17 @@ public:
         data.store(mem, f);
     }
 
+    // load/store (from/to packed bit arrays)
+    static Vc_INTRINSIC fixed_size_simd_mask<T, N> fromBits(const std::uint64_t *bits,
+                                                            std::size_t offset)
+    {
+        return {private_init, mask_type::fromBits(bits, offset)};
+    }
+    Vc_INTRINSIC void storeBits(std::uint64_t *bits, std::size_t offset) const
+    {
+        data.storeBits(bits, offset);
+    }
+
     // compares
     Vc_INTRINSIC Vc_PURE bool operator==(const SimdMaskArray &rhs) const
     {
@@ -505,6 +516,32 @@ public:
         data0.store(mem, f);
         data1.store(mem + storage_type0::size(), f);
     }
+
+    /**
+     * Load N boolean values from the packed bit array \p bits, starting at bit \p offset.
+     *
+     * \param bits A bit array storing bit `i` in bit `i % 64` of `bits[i / 64]`.
+     * \param offset The bit position of the first entry.
+     */
+    static Vc_INTRINSIC fixed_size_simd_mask<T, N> fromBits(const std::uint64_t *bits,
+                                                            std::size_t offset)
+    {
+        return {storage_type0::fromBits(bits, offset),
+                storage_type1::fromBits(bits, offset + storage_type0::size())};
+    }
+
+    /**
+     * Store N boolean values to the packed bit array \p bits, starting at bit \p offset.
+     * The other bits of \p bits are not modified.
+     *
+     * \param bits A bit array storing bit `i` in bit `i % 64` of `bits[i / 64]`.
+     * \param offset The bit position of the first entry.
+     */
+    Vc_INTRINSIC void storeBits(std::uint64_t *bits, std::size_t offset) const
+    {
+        data0.storeBits(bits, offset);
+        data1.storeBits(bits, offset + storage_type0::size());
+    }
     ///@}
 
     ///\copydoc Mask::operator==
@@ -0,0 +1,583 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_STATS_H_
+#define VC_COMMON_STATS_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "algorithms.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Utilities
+ *
+ * Descriptive statistics of contiguous ranges: sums, mean and variance, extrema and
+ * approximate quantiles.
+ *
+ * The reductions keep several independent vector accumulators, so that the loop is not
+ * bound by the latency of a single chain of additions (or min/max), and reduce them
+ * horizontally only once at the end. Element types without a Vc::Vector use scalar
+ * loops.
+ *
+ * \code
+ * const auto m = Vc::stats::describe(data.begin(), data.end());
+ * std::cout << m.mean << " ± " << m.stddev() << '\n';
+ * const auto q = Vc::stats::quantiles(data.begin(), data.end(), {0.05, 0.5, 0.95});
+ * \endcode
+ */
+namespace stats
+{
+/**
+ * Count, mean and sum of squared deviations from the mean of a sample, i.e. the state of
+ * Welford's online algorithm. Two states are combined with the update of Chan, Golub and
+ * LeVeque, so partial results of independent ranges (or threads) can be merged without
+ * loss of accuracy.
+ */
+template <typename T> struct moments {
+    static_assert(std::is_floating_point<T>::value,
+                  "Vc::stats::moments requires a floating-point type");
+
+    std::size_t count = 0;
+    T mean = 0;
+    /// The sum of squared deviations from the mean.
+    T m2 = 0;
+
+    /// Adds the observation \p x.
+    void push(T x)
+    {
+        ++count;
+        const T delta = x - mean;
+        mean += delta / T(count);
+        m2 += delta * (x - mean);
+    }
+
+    /// Merges the observations of \p b into this state.
+    moments &operator+=(const moments &b)
+    {
+        if (b.count == 0) {
+            return *this;
+        }
+        if (count == 0) {
+            return *this = b;
+        }
+        const double n = double(count) + double(b.count);
+        const T delta = b.mean - mean;
+        mean += delta * T(double(b.count) / n);
+        m2 += b.m2 + delta * delta * T(double(count) * double(b.count) / n);
+        count += b.count;
+        return *this;
+    }
+
+    /**
+     * Returns the variance, \f$m_2 / (n - \mathrm{ddof})\f$: the population variance by
+     * default, the unbiased sample variance for \p ddof = 1. NaN if \p count ≤ \p ddof.
+     */
+    T variance(std::size_t ddof = 0) const
+    {
+        return count > ddof ? m2 / T(count - ddof) : std::numeric_limits<T>::quiet_NaN();
+    }
+
+    /// Returns the square root of variance(\p ddof).
+    T stddev(std::size_t ddof = 0) const { return std::sqrt(variance(ddof)); }
+};
+
+template <typename T> inline moments<T> operator+(moments<T> a, const moments<T> &b)
+{
+    return a += b;
+}
+
+namespace Detail
+{
+// sum {{{1
+/**\internal
+ * Sum with four independent accumulators; the tail is a partial load padded with zeros.
+ */
+template <typename T> inline T sum_impl(const T *p, std::size_t n, std::true_type)
+{
+    using V = Vector<T>;
+    V a0 = V::Zero(), a1 = V::Zero(), a2 = V::Zero(), a3 = V::Zero();
+    std::size_t i = 0;
+    for (; i + 4 * V::Size <= n; i += 4 * V::Size) {
+        a0 += V(p + i, Vc::Unaligned);
+        a1 += V(p + i + V::Size, Vc::Unaligned);
+        a2 += V(p + i + 2 * V::Size, Vc::Unaligned);
+        a3 += V(p + i + 3 * V::Size, Vc::Unaligned);
+    }
+    for (; i + V::Size <= n; i += V::Size) {
+        a0 += V(p + i, Vc::Unaligned);
+    }
+    if (i < n) {
+        V x;
+        x.load_partial(p + i, n - i);
+        a1 += x;
+    }
+    return ((a0 + a1) + (a2 + a3)).sum();
+}
+
+template <typename T> inline T sum_impl(const T *p, std::size_t n, std::false_type)
+{
+    T s = T();
+    for (std::size_t i = 0; i < n; ++i) {
+        s += p[i];
+    }
+    return s;
+}
+
+// moments {{{1
+/**\internal
+ * Per-lane Welford states of \p K vectors which have all seen the same number of values.
+ */
+template <typename V, std::size_t K> struct lane_moments {
+    V mean[K];
+    V m2[K];
+
+    /// Chan's update of states holding \p na and \p nb values per lane.
+    void merge(std::size_t na, const lane_moments &b, std::size_t nb)
+    {
+        using T = typename V::EntryType;
+        const double n = double(na) + double(nb);
+        const V wb = T(double(nb) / n), w2 = T(double(na) * double(nb) / n);
+        for (std::size_t k = 0; k < K; ++k) {
+            const V delta = b.mean[k] - mean[k];
+            mean[k] += delta * wb;
+            m2[k] += b.m2[k] + delta * delta * w2;
+        }
+    }
+};
+
+/**\internal
+ * Welford's algorithm on K × V::Size interleaved lanes. The lanes restart every Block
+ * steps, and the block states are merged pairwise, like a binary counter: a stack level
+ * l holds 2^l blocks, so only states of equal weight are combined and the rounding error
+ * grows with the logarithm of the length only. Lanes are finally merged into one state,
+ * pairwise again, and the remainder that does not fill all lanes is added with scalar
+ * Welford updates.
+ */
+template <typename T>
+inline moments<T> moments_impl(const T *p, std::size_t n, std::true_type)
+{
+    using V = Vector<T>;
+    constexpr std::size_t K = 4;
+    constexpr std::size_t Group = K * V::Size;
+    constexpr std::size_t Block = 256;
+    constexpr std::size_t Levels = 48;
+    using State = lane_moments<V, K>;
+
+    State stack[Levels];
+    std::size_t blocks = 0;  // full blocks merged into the stack so far
+    State acc;
+    std::size_t steps = 0;  // steps of acc, at most Block
+    std::size_t i = 0;
+    for (; i + Group <= n; i += Group) {
+        if (steps == 0) {
+            for (std::size_t k = 0; k < K; ++k) {
+                acc.mean[k] = V::Zero();
+                acc.m2[k] = V::Zero();
+            }
+        }
+        const V r = T(1) / T(++steps);
+        for (std::size_t k = 0; k < K; ++k) {
+            const V x(p + i + k * V::Size, Vc::Unaligned);
+            const V delta = x - acc.mean[k];
+            acc.mean[k] += delta * r;
+            acc.m2[k] += delta * (x - acc.mean[k]);
+        }
+        if (steps == Block) {
+            std::size_t level = 0;
+            for (; blocks & (std::size_t(1) << level); ++level) {
+                const std::size_t w = Block << level;
+                stack[level].merge(w, acc, w);
+                acc = stack[level];
+            }
+            Vc_ASSERT(level < Levels);
+            stack[level] = acc;
+            ++blocks;
+            steps = 0;
+        }
+    }
+
+    // collapse the stack (and the incomplete block) from the lightest state upwards
+    std::size_t weight = steps;
+    for (std::size_t level = 0; (blocks >> level) != 0; ++level) {
+        if (blocks & (std::size_t(1) << level)) {
+            const std::size_t w = Block << level;
+            if (weight == 0) {
+                acc = stack[level];
+            } else {
+                acc.merge(weight, stack[level], w);
+            }
+            weight += w;
+        }
+    }
+
+    moments<T> result;
+    if (weight > 0) {
+        // states of equal weight w merge into mean (a + b) / 2, m2 + δ² w / 2
+        for (std::size_t k = 1; k < K; k *= 2) {
+            const V half_weight = T(0.5) * T(k * weight);
+            for (std::size_t j = 0; j + k < K; j += 2 * k) {
+                const V delta = acc.mean[j + k] - acc.mean[j];
+                acc.mean[j] += delta * V(T(0.5));
+                acc.m2[j] += acc.m2[j + k] + delta * delta * half_weight;
+            }
+        }
+        moments<T> lanes[V::Size];
+        for (std::size_t l = 0; l < V::Size; ++l) {
+            lanes[l].count = K * weight;
+            lanes[l].mean = acc.mean[0][l];
+            lanes[l].m2 = acc.m2[0][l];
+        }
+        for (std::size_t k = 1; k < V::Size; k *= 2) {
+            for (std::size_t j = 0; j + k < V::Size; j += 2 * k) {
+                lanes[j] += lanes[j + k];
+            }
+        }
+        result = lanes[0];
+    }
+    moments<T> tail;
+    for (; i < n; ++i) {
+        tail.push(p[i]);
+    }
+    return result += tail;
+}
+
+template <typename T>
+inline moments<T> moments_impl(const T *p, std::size_t n, std::false_type)
+{
+    moments<T> m;
+    for (std::size_t i = 0; i < n; ++i) {
+        m.push(p[i]);
+    }
+    return m;
+}
+
+// minmax {{{1
+/**\internal
+ * Minimum and maximum with two accumulators each. The first vector is the initial value
+ * and the tail is an overlapping load of the last vector, which does not change either
+ * result.
+ */
+template <typename T>
+inline std::pair<T, T> minmax_impl(const T *p, std::size_t n, std::true_type)
+{
+    using V = Vector<T>;
+    if (n < V::Size) {
+        const auto r = std::minmax_element(p, p + n);
+        return {*r.first, *r.second};
+    }
+    V lo0(p, Vc::Unaligned);
+    V hi0 = lo0, lo1 = lo0, hi1 = lo0;
+    std::size_t i = V::Size;
+    for (; i + 2 * V::Size <= n; i += 2 * V::Size) {
+        const V x0(p + i, Vc::Unaligned);
+        const V x1(p + i + V::Size, Vc::Unaligned);
+        lo0 = Vc::min(lo0, x0);
+        hi0 = Vc::max(hi0, x0);
+        lo1 = Vc::min(lo1, x1);
+        hi1 = Vc::max(hi1, x1);
+    }
+    if (i < n) {
+        const V x0(p + std::min(i, n - V::Size), Vc::Unaligned);
+        const V x1(p + n - V::Size, Vc::Unaligned);
+        lo0 = Vc::min(lo0, x0);
+        hi0 = Vc::max(hi0, x0);
+        lo1 = Vc::min(lo1, x1);
+        hi1 = Vc::max(hi1, x1);
+    }
+    return {Vc::min(lo0, lo1).min(), Vc::max(hi0, hi1).max()};
+}
+
+template <typename T>
+inline std::pair<T, T> minmax_impl(const T *p, std::size_t n, std::false_type)
+{
+    const auto r = std::minmax_element(p, p + n);
+    return {*r.first, *r.second};
+}
+
+// histogram {{{1
+/**\internal
+ * Adds the bin counts of \p n values to \p counts, with bin b = ⌊(x - lo) · scale⌋,
+ * clamped to [0, bins). The bin numbers of a block of values are computed a vector at a
+ * time and staged in memory; a second loop then increments four interleaved
+ * sub-histograms, so that equal bins in neighboring elements do not wait for each
+ * other's stores. (Reading the bin numbers back right after the vector store that wrote
+ * them costs several times more than the increments themselves.) The sub-histograms are
+ * padded apart, so that they do not alias at 4 KiB boundaries.
+ */
+template <typename T>
+inline void histogram_impl(const T *p, std::size_t n, T lo, T scale,
+                           std::vector<std::size_t> &counts, std::true_type)
+{
+    using V = Vector<T>;
+    using I = SimdArray<int, V::Size>;
+    constexpr std::size_t Ways = 4;
+    constexpr std::size_t Stage = 256;
+    constexpr std::size_t Chunk = std::size_t(1) << 30;  // keeps the counts below 2^32
+    const std::size_t bins = counts.size();
+    const std::size_t stride = bins + 16;
+    std::vector<std::uint32_t> sub(Ways * stride);
+    const V lo_v = lo, scale_v = scale, last_v = T(bins - 1);
+    alignas(64) int staged[Stage];
+    for (std::size_t chunk = 0; chunk < n; chunk += Chunk) {
+        const std::size_t end = std::min(n, chunk + Chunk);
+        std::size_t i = chunk;
+        for (; i + Stage <= end; i += Stage) {
+            for (std::size_t j = 0; j < Stage; j += V::Size) {
+                const V x(p + i + j, Vc::Unaligned);
+                simd_cast<I>(Vc::min((x - lo_v) * scale_v, last_v))
+                    .store(staged + j, Vc::Aligned);
+            }
+            for (std::size_t j = 0; j < Stage; j += Ways) {
+                ++sub[staged[j]];
+                ++sub[stride + staged[j + 1]];
+                ++sub[2 * stride + staged[j + 2]];
+                ++sub[3 * stride + staged[j + 3]];
+            }
+        }
+        for (; i < end; ++i) {
+            ++sub[static_cast<int>(std::min((p[i] - lo) * scale, T(bins - 1)))];
+        }
+        for (std::size_t w = 0; w < Ways; ++w) {
+            for (std::size_t b = 0; b < bins; ++b) {
+                counts[b] += sub[w * stride + b];
+                sub[w * stride + b] = 0;
+            }
+        }
+    }
+}
+
+template <typename T>
+inline void histogram_impl(const T *p, std::size_t n, T lo, T scale,
+                           std::vector<std::size_t> &counts, std::false_type)
+{
+    const std::size_t bins = counts.size();
+    for (std::size_t i = 0; i < n; ++i) {
+        ++counts[static_cast<int>(std::min((p[i] - lo) * scale, T(bins - 1)))];
+    }
+}
+
+/**\internal
+ * Estimates the order statistics for the ranks `p[j] * (n - 1)` from a histogram of \p
+ * bins equal bins over [lo, hi]: the value of rank k is placed at the corresponding
+ * fraction of its bin, and fractional ranks interpolate linearly between neighbors.
+ */
+template <typename T>
+inline std::vector<T> quantiles_impl(const T *data, std::size_t n, const double *p,
+                                     std::size_t np, std::size_t bins)
+{
+    using IsVector = Traits::is_valid_vector_argument<T>;
+    std::vector<T> result(np, std::numeric_limits<T>::quiet_NaN());
+    if (n == 0) {
+        return result;
+    }
+    const auto range = minmax_impl(data, n, IsVector());
+    const T lo = range.first, hi = range.second;
+    if (!(lo < hi)) {
+        std::fill(result.begin(), result.end(), lo);
+        return result;
+    }
+    std::vector<std::size_t> counts(bins);
+    histogram_impl(data, n, lo, T(bins) / (hi - lo), counts, IsVector());
+    std::vector<std::size_t> below(bins + 1);  // elements in the bins before b
+    for (std::size_t b = 0; b < bins; ++b) {
+        below[b + 1] = below[b] + counts[b];
+    }
+    const double width = (double(hi) - double(lo)) / double(bins);
+    const auto order_statistic = [&](std::size_t k) {
+        const std::size_t b =
+            std::upper_bound(below.begin() + 1, below.end(), k) - below.begin() - 1;
+        const double fraction = (double(k - below[b]) + 0.5) / double(counts[b]);
+        return double(lo) + (double(b) + fraction) * width;
+    };
+    for (std::size_t j = 0; j < np; ++j) {
+        Vc_ASSERT(p[j] >= 0 && p[j] <= 1);
+        const double rank = p[j] * double(n - 1);
+        const std::size_t k = std::min(static_cast<std::size_t>(rank), n - 1);
+        double x = order_statistic(k);
+        if (k + 1 < n && rank > double(k)) {
+            x += (rank - double(k)) * (order_statistic(k + 1) - x);
+        }
+        result[j] = static_cast<T>(std::min(double(hi), std::max(double(lo), x)));
+    }
+    return result;
+}
+// }}}1
+
+template <class It> using value_type = typename std::iterator_traits<It>::value_type;
+template <class It>
+using enable_if_floating =
+    enable_if<std::is_floating_point<value_type<It>>::value, value_type<It>>;
+}  // namespace Detail
+
+/**
+ * Returns the sum of the contiguous range [\p first, \p last), the same as
+ * `std::accumulate(first, last, T())` up to rounding. The elements are added in four
+ * interleaved vector accumulators.
+ */
+template <class It> inline Detail::value_type<It> sum(It first, It last)
+{
+    using T = Detail::value_type<It>;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return T();
+    }
+    return Detail::sum_impl(std::addressof(*first), n,
+                            Traits::is_valid_vector_argument<T>());
+}
+
+/**
+ * Returns the arithmetic mean of the floating-point range [\p first, \p last), or NaN
+ * if the range is empty.
+ */
+template <class It> inline Detail::enable_if_floating<It> mean(It first, It last)
+{
+    using T = Detail::value_type<It>;
+    const std::size_t n = std::distance(first, last);
+    return n == 0 ? std::numeric_limits<T>::quiet_NaN() : sum(first, last) / T(n);
+}
+
+/**
+ * Returns count, mean and the sum of squared deviations of the floating-point range
+ * [\p first, \p last), computed with Welford's algorithm per vector lane and combined
+ * pairwise. The result is as accurate as a two-pass computation for all but extremely
+ * long ranges, while reading the data only once.
+ */
+template <class It> inline moments<Detail::value_type<It>> describe(It first, It last)
+{
+    using T = Detail::value_type<It>;
+    static_assert(std::is_floating_point<T>::value,
+                  "Vc::stats::describe requires a floating-point range");
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return {};
+    }
+    return Detail::moments_impl(std::addressof(*first), n,
+                                Traits::is_valid_vector_argument<T>());
+}
+
+/**
+ * Returns the variance of the floating-point range [\p first, \p last).
+ * \see moments::variance
+ */
+template <class It>
+inline Detail::enable_if_floating<It> variance(It first, It last, std::size_t ddof = 0)
+{
+    return describe(first, last).variance(ddof);
+}
+
+/**
+ * Returns the smallest and the largest element of the non-empty contiguous range [\p
+ * first, \p last).
+ *
+ * \note The result is unspecified if a floating-point range contains NaNs.
+ */
+template <class It>
+inline std::pair<Detail::value_type<It>, Detail::value_type<It>> minmax(It first, It last)
+{
+    using T = Detail::value_type<It>;
+    Vc_ASSERT(first != last);
+    return Detail::minmax_impl(std::addressof(*first), std::distance(first, last),
+                               Traits::is_valid_vector_argument<T>());
+}
+
+/**
+ * Returns the index of the first smallest element of the contiguous range [\p first, \p
+ * last), or 0 if the range is empty. \see Vc::min_element
+ */
+template <class It> inline std::size_t argmin(It first, It last)
+{
+    return first == last ? 0 : Vc::min_element(first, last) - first;
+}
+
+/**
+ * Returns the index of the first largest element of the contiguous range [\p first, \p
+ * last), or 0 if the range is empty. \see Vc::max_element
+ */
+template <class It> inline std::size_t argmax(It first, It last)
+{
+    return first == last ? 0 : Vc::max_element(first, last) - first;
+}
+
+/**
+ * Returns approximations of the quantiles \p probabilities (each in [0, 1]) of the
+ * floating-point range [\p first, \p last), in the definition that interpolates linearly
+ * between the order statistics of rank ⌊p (n - 1)⌋ and ⌈p (n - 1)⌉ (as `numpy.quantile`
+ * does). The results are NaN if the range is empty.
+ *
+ * The range is read twice: for its minimum and maximum, and to fill a histogram of \p
+ * bins equal bins between them. Every estimate is then within one bin width, (max - min)
+ * / \p bins, of the exact quantile. The range must not contain NaNs or infinities.
+ */
+template <class It>
+inline std::vector<Detail::value_type<It>> quantiles(
+    It first, It last, const std::vector<double> &probabilities, std::size_t bins = 4096)
+{
+    using T = Detail::value_type<It>;
+    static_assert(std::is_floating_point<T>::value,
+                  "Vc::stats::quantiles requires a floating-point range");
+    Vc_ASSERT(bins > 0 && bins <= std::size_t(std::numeric_limits<int>::max()) / 4);
+    const std::size_t n = std::distance(first, last);
+    return Detail::quantiles_impl(n == 0 ? nullptr : std::addressof(*first), n,
+                                  probabilities.data(), probabilities.size(), bins);
+}
+
+/**
+ * Returns an approximation of the quantile \p probability of [\p first, \p last).
+ * \see quantiles
+ */
+template <class It>
+inline Detail::enable_if_floating<It> quantile(It first, It last, double probability,
+                                               std::size_t bins = 4096)
+{
+    return quantiles(first, last, std::vector<double>{probability}, bins)[0];
+}
+
+/**
+ * Returns an approximation of the median of [\p first, \p last). \see quantiles
+ */
+template <class It>
+inline Detail::enable_if_floating<It> median(It first, It last, std::size_t bins = 4096)
+{
+    return quantile(first, last, 0.5, bins);
+}
+}  // namespace stats
+}  // namespace Vc
+
+#endif  // VC_COMMON_STATS_H_
+
+// vim: foldmethod=marker
@@ -61,6 +61,18 @@ template <
     typename = enable_if<std::is_arithmetic<U>::value &&Traits::is_load_store_flag<Flags>::value>>
 Vc_INTRINSIC_L void Vc_VDECL store(U *mem, MaskType mask, Flags flags = Flags()) const Vc_INTRINSIC_R;
 
+/**
+ * Store the first \p n entries to \p mem.
+ *
+ * This is the counterpart to load_partial(): memory at or after `mem + n` is neither read
+ * nor written. If \p n is at least \VSize{T} this is equivalent to an unaligned store().
+ *
+ * \param mem A pointer to memory, where \p n consecutive values will be stored. No
+ *            alignment is required.
+ * \param n The number of entries to store.
+ */
+Vc_INTRINSIC_L void store_partial(EntryType *mem, std::size_t n) const Vc_INTRINSIC_R;
+
 //@{
 /**
  * The following store overloads support classes that have a cast operator to `EntryType
@@ -0,0 +1,577 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SUMMATION_H_
+#define VC_COMMON_SUMMATION_H_
+
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include "../vector.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// error-free transformations {{{1
+/**\internal
+ * Knuth's TwoSum: returns `a + b` rounded and stores the rounding error in \p err, such
+ * that the sum and \p err add up to `a + b` exactly. Unlike Fast2Sum (Kahan) it needs no
+ * ordering of the magnitudes, and therefore no branches or blends. Works for Vc vectors
+ * and for plain floating-point scalars.
+ */
+template <typename V> Vc_INTRINSIC V two_sum(const V &a, const V &b, V &err)
+{
+    const V s = a + b;
+    const V bb = s - a;
+    err = (a - (s - bb)) + (b - bb);
+    return s;
+}
+
+/**\internal
+ * Splits \p a into a high and a low part of half the mantissa each (Veltkamp), such that
+ * the products of the parts are exact.
+ */
+template <typename T, typename V>
+Vc_INTRINSIC void veltkamp_split(const V &a, V &hi, V &lo)
+{
+    const V factor = std::ldexp(T(1), (std::numeric_limits<T>::digits + 1) / 2) + T(1);
+    const V c = factor * a;
+    hi = c - (c - a);
+    lo = a - hi;
+}
+
+/**\internal
+ * Returns `a * b` rounded and stores the rounding error in \p err (TwoProduct). With
+ * hardware FMA the error is `fma(a, b, -p)`; otherwise Dekker's algorithm computes it
+ * from the split factors. Both are exact unless the product underflows or overflows.
+ *
+ * Dekker's algorithm is only exact if no multiply-add is contracted, which the compiler
+ * may do whenever the target has an FMA instruction (Vc itself builds with
+ * `-ffp-contract=fast`). Therefore the FMA is used explicitly as soon as the compiler
+ * targets one, even if Vc_IMPL does not enable it (e.g. the Scalar implementation).
+ */
+#if defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4 || defined __FMA__ || defined __FMA4__ || \
+    defined __FP_FAST_FMA || defined __FP_FAST_FMAF || defined FP_FAST_FMA ||            \
+    defined FP_FAST_FMAF
+#define Vc_SUMMATION_HAVE_FMA 1
+#endif
+
+template <typename V>
+Vc_INTRINSIC enable_if<Traits::is_simd_vector<V>::value, V> two_product(const V &a,
+                                                                       const V &b, V &err)
+{
+    const V p = a * b;
+#ifdef Vc_SUMMATION_HAVE_FMA
+    err = Vc::fma(a, b, -p);
+#else
+    using T = typename V::EntryType;
+    V ah, al, bh, bl;
+    veltkamp_split<T>(a, ah, al);
+    veltkamp_split<T>(b, bh, bl);
+    err = ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+#endif
+    return p;
+}
+
+template <typename T>
+inline enable_if<std::is_floating_point<T>::value, T> two_product(const T &a, const T &b,
+                                                                 T &err)
+{
+    const T p = a * b;
+#ifdef Vc_SUMMATION_HAVE_FMA
+    err = std::fma(a, b, -p);
+#else
+    T ah, al, bh, bl;
+    veltkamp_split<T>(a, ah, al);
+    veltkamp_split<T>(b, bh, bl);
+    err = ((ah * bh - p) + ah * bl + al * bh) + al * bl;
+#endif
+    return p;
+}
+#undef Vc_SUMMATION_HAVE_FMA
+// }}}1
+}  // namespace Common
+
+/**
+ * \ingroup Utilities
+ * \headerfile summation.h <Vc/summation>
+ *
+ * A per-lane sum of vectors with Neumaier's compensation: every addition also computes
+ * its exact rounding error (TwoSum), and the errors are summed separately. The result is
+ * as accurate as if the sum were computed in twice the precision and then rounded: the
+ * error after n additions is at most \f$\varepsilon|S| + (n\varepsilon)^2\sum|x_i|\f$
+ * (Ogita, Rump and Oishi, "Accurate sum and dot product", 2005).
+ *
+ * It is meant for use in loops that already work on vectors:
+ * \code
+ * Vc::CompensatedAccumulator<float_v> acc;
+ * for (std::size_t i = 0; i < data.vectorsCount(); ++i) {
+ *     acc += f(data.vector(i));
+ * }
+ * const float total = acc.sum();
+ * \endcode
+ *
+ * An addition costs four additions/subtractions more than a plain `+=`. Several
+ * independent accumulators hide the longer latency in tight loops. The compensation
+ * relies on IEEE rounding of every operation; it is optimized away with `-ffast-math`
+ * (or any other flag that allows reassociation).
+ *
+ * \tparam V A Vc::Vector or Vc::SimdArray with a floating-point entry type.
+ */
+template <typename V> class CompensatedAccumulator
+{
+    static_assert(Traits::is_simd_vector<V>::value &&
+                      std::is_floating_point<typename V::EntryType>::value,
+                  "CompensatedAccumulator requires a floating-point Vc vector type");
+
+public:
+    using vector_type = V;
+    using EntryType = typename V::EntryType;
+
+    /// Starts from zero in all lanes.
+    CompensatedAccumulator() : m_sum(V::Zero()), m_error(V::Zero()) {}
+    /// Starts from \p init.
+    explicit CompensatedAccumulator(const V &init) : m_sum(init), m_error(V::Zero()) {}
+
+    /// Adds \p x to every lane.
+    Vc_INTRINSIC CompensatedAccumulator &operator+=(const V &x)
+    {
+        V err;
+        m_sum = Common::two_sum(m_sum, x, err);
+        m_error += err;
+        return *this;
+    }
+
+    /// Subtracts \p x from every lane.
+    Vc_INTRINSIC CompensatedAccumulator &operator-=(const V &x) { return *this += -x; }
+
+    /// Adds the exact product `a * b`, including the rounding error of the
+    /// multiplication.
+    Vc_INTRINSIC void add_product(const V &a, const V &b)
+    {
+        V perr, serr;
+        const V p = Common::two_product(a, b, perr);
+        m_sum = Common::two_sum(m_sum, p, serr);
+        m_error += serr + perr;
+    }
+
+    /// Adds the sums of \p rhs lane by lane.
+    Vc_INTRINSIC CompensatedAccumulator &operator+=(const CompensatedAccumulator &rhs)
+    {
+        V err;
+        m_sum = Common::two_sum(m_sum, rhs.m_sum, err);
+        m_error += err + rhs.m_error;
+        return *this;
+    }
+
+    /// Returns the compensated sum of each lane.
+    V value() const { return m_sum + m_error; }
+
+    /// Returns the compensated sum of all lanes.
+    EntryType sum() const
+    {
+        EntryType s = m_sum[0], err = m_error[0];
+        for (std::size_t i = 1; i < V::Size; ++i) {
+            EntryType e;
+            s = Common::two_sum(s, EntryType(m_sum[i]), e);
+            err += e + m_error[i];
+        }
+        return s + err;
+    }
+
+    /// Returns the uncompensated sum of each lane.
+    const V &partial_sums() const { return m_sum; }
+    /// Returns the accumulated rounding errors of each lane.
+    const V &errors() const { return m_error; }
+
+private:
+    V m_sum;
+    V m_error;
+};
+
+namespace Common
+{
+// compensated kernels {{{1
+/**\internal
+ * Scalar compensated sum for element types without a Vc::Vector.
+ */
+template <typename T> struct scalar_compensated {
+    T sum = 0, error = 0;
+    void add(T x)
+    {
+        T e;
+        sum = two_sum(sum, x, e);
+        error += e;
+    }
+    void add_product(T a, T b)
+    {
+        T pe, se;
+        const T p = two_product(a, b, pe);
+        sum = two_sum(sum, p, se);
+        error += se + pe;
+    }
+    T value() const { return sum + error; }
+};
+
+/**\internal
+ * Sums `load(i)` for the vectors at element offsets i < \p n into four accumulators, and
+ * the partial tail into one of them. \p Add adds a loaded value (or product).
+ */
+template <typename V, typename Load, typename Add>
+Vc_INTRINSIC typename V::EntryType compensated_loop(std::size_t n, const Load &load,
+                                                     const Add &add)
+{
+    CompensatedAccumulator<V> a0, a1, a2, a3;
+    std::size_t i = 0;
+    for (; i + 4 * V::Size <= n; i += 4 * V::Size) {
+        add(a0, load(i, V::Size));
+        add(a1, load(i + V::Size, V::Size));
+        add(a2, load(i + 2 * V::Size, V::Size));
+        add(a3, load(i + 3 * V::Size, V::Size));
+    }
+    for (; i + V::Size <= n; i += V::Size) {
+        add(a0, load(i, V::Size));
+    }
+    if (i < n) {
+        add(a1, load(i, n - i));
+    }
+    a0 += a1;
+    a2 += a3;
+    a0 += a2;
+    return a0.sum();
+}
+
+template <typename V>
+Vc_INTRINSIC V load_vector(const typename V::EntryType *p, std::size_t n)
+{
+    if (n == V::Size) {
+        return V(p, Vc::Unaligned);
+    }
+    V x;
+    x.load_partial(p, n);
+    return x;
+}
+
+template <typename T>
+inline T accurate_sum_impl(const T *p, std::size_t n, std::true_type)
+{
+    using V = Vector<T>;
+    return compensated_loop<V>(
+        n, [&](std::size_t i, std::size_t k) { return load_vector<V>(p + i, k); },
+        [](CompensatedAccumulator<V> &acc, const V &x) { acc += x; });
+}
+
+template <typename T>
+inline T accurate_sum_impl(const T *p, std::size_t n, std::false_type)
+{
+    scalar_compensated<T> acc;
+    for (std::size_t i = 0; i < n; ++i) {
+        acc.add(p[i]);
+    }
+    return acc.value();
+}
+
+template <typename T>
+inline T accurate_dot_impl(const T *a, const T *b, std::size_t n, std::true_type)
+{
+    using V = Vector<T>;
+    using Pair = std::pair<V, V>;
+    return compensated_loop<V>(
+        n,
+        [&](std::size_t i, std::size_t k) {
+            return Pair(load_vector<V>(a + i, k), load_vector<V>(b + i, k));
+        },
+        [](CompensatedAccumulator<V> &acc, const Pair &x) {
+            acc.add_product(x.first, x.second);
+        });
+}
+
+template <typename T>
+inline T accurate_dot_impl(const T *a, const T *b, std::size_t n, std::false_type)
+{
+    scalar_compensated<T> acc;
+    for (std::size_t i = 0; i < n; ++i) {
+        acc.add_product(a[i], b[i]);
+    }
+    return acc.value();
+}
+
+// pairwise kernels {{{1
+/**\internal
+ * Pairwise summation over blocks: each block of Block vectors is summed by four
+ * interleaved accumulators, and the block sums are combined like a binary counter, so
+ * that only sums of equally many blocks are ever added. The rounding error grows with
+ * Block / 4 + log2(n) instead of n.
+ */
+template <typename V, typename Term>
+inline typename V::EntryType pairwise_loop(std::size_t n, const Term &term)
+{
+    constexpr std::size_t Block = 32;  // vectors per block
+    constexpr std::size_t Levels = 64;
+    V stack[Levels];
+    std::size_t blocks = 0;
+    std::size_t i = 0;
+    for (; i + Block * V::Size <= n; i += Block * V::Size) {
+        V a0 = V::Zero(), a1 = V::Zero(), a2 = V::Zero(), a3 = V::Zero();
+        for (std::size_t j = 0; j < Block * V::Size; j += 4 * V::Size) {
+            a0 = term(i + j, V::Size, a0);
+            a1 = term(i + j + V::Size, V::Size, a1);
+            a2 = term(i + j + 2 * V::Size, V::Size, a2);
+            a3 = term(i + j + 3 * V::Size, V::Size, a3);
+        }
+        V s = (a0 + a1) + (a2 + a3);
+        std::size_t level = 0;
+        for (; blocks & (std::size_t(1) << level); ++level) {
+            s += stack[level];
+        }
+        stack[level] = s;
+        ++blocks;
+    }
+    // the partial block, then the stack from the smallest sums upwards
+    V a0 = V::Zero(), a1 = V::Zero();
+    for (; i + 2 * V::Size <= n; i += 2 * V::Size) {
+        a0 = term(i, V::Size, a0);
+        a1 = term(i + V::Size, V::Size, a1);
+    }
+    if (i + V::Size <= n) {
+        a0 = term(i, V::Size, a0);
+        i += V::Size;
+    }
+    if (i < n) {
+        a1 = term(i, n - i, a1);
+    }
+    V s = a0 + a1;
+    for (std::size_t level = 0; (blocks >> level) != 0; ++level) {
+        if (blocks & (std::size_t(1) << level)) {
+            s += stack[level];
+        }
+    }
+    return s.sum();
+}
+
+/**\internal
+ * `a * b + c`, contracted to an FMA only where the target has one: Vc::fma is emulated
+ * otherwise, which is exact but several times slower.
+ */
+template <typename V> Vc_INTRINSIC V multiply_add(const V &a, const V &b, const V &c)
+{
+#if defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4
+    return Vc::fma(a, b, c);
+#else
+    return a * b + c;
+#endif
+}
+
+template <typename T>
+inline T pairwise_sum_impl(const T *p, std::size_t n, std::true_type)
+{
+    using V = Vector<T>;
+    return pairwise_loop<V>(n, [&](std::size_t i, std::size_t k, const V &acc) {
+        return acc + load_vector<V>(p + i, k);
+    });
+}
+
+template <typename T>
+inline T pairwise_dot_impl(const T *a, const T *b, std::size_t n, std::true_type)
+{
+    using V = Vector<T>;
+    return pairwise_loop<V>(n, [&](std::size_t i, std::size_t k, const V &acc) {
+        return multiply_add(load_vector<V>(a + i, k), load_vector<V>(b + i, k), acc);
+    });
+}
+
+/**\internal
+ * Recursive halving for element types without a Vc::Vector.
+ */
+template <typename T, typename Term>
+inline T pairwise_scalar(std::size_t first, std::size_t n, const Term &term)
+{
+    if (n <= 32) {
+        T s = 0;
+        for (std::size_t i = first; i < first + n; ++i) {
+            s += term(i);
+        }
+        return s;
+    }
+    return pairwise_scalar<T>(first, n / 2, term) +
+           pairwise_scalar<T>(first + n / 2, n - n / 2, term);
+}
+
+template <typename T>
+inline T pairwise_sum_impl(const T *p, std::size_t n, std::false_type)
+{
+    return pairwise_scalar<T>(0, n, [&](std::size_t i) { return p[i]; });
+}
+
+template <typename T>
+inline T pairwise_dot_impl(const T *a, const T *b, std::size_t n, std::false_type)
+{
+    return pairwise_scalar<T>(0, n, [&](std::size_t i) { return a[i] * b[i]; });
+}
+// }}}1
+
+template <class It> using floating_value_type = enable_if<
+    std::is_floating_point<typename std::iterator_traits<It>::value_type>::value,
+    typename std::iterator_traits<It>::value_type>;
+template <class R>
+using range_iterator = decltype(std::begin(std::declval<const R &>()));
+}  // namespace Common
+
+/**
+ * \ingroup Utilities
+ * \headerfile summation.h <Vc/summation>
+ *
+ * Returns the sum of the contiguous floating-point range [\p first, \p last) with
+ * Neumaier compensation in four interleaved vector accumulators. The result is as
+ * accurate as a plain sum computed in twice the precision of the elements, and about as
+ * fast as a plain vectorized sum in the element type when the data comes from memory.
+ *
+ * \see CompensatedAccumulator, pairwise_sum
+ */
+template <class It> inline Common::floating_value_type<It> accurate_sum(It first, It last)
+{
+    using T = typename std::iterator_traits<It>::value_type;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return T();
+    }
+    return Common::accurate_sum_impl(std::addressof(*first), n,
+                                     Traits::is_valid_vector_argument<T>());
+}
+
+/// \copydoc accurate_sum(It, It)
+template <class Range>
+inline auto accurate_sum(const Range &r)
+    -> decltype(accurate_sum(std::begin(r), std::end(r)))
+{
+    return accurate_sum(std::begin(r), std::end(r));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile summation.h <Vc/summation>
+ *
+ * Returns the dot product of [\p first1, \p last1) and the equally long range starting at
+ * \p first2, both contiguous and of the same floating-point type. The rounding errors of
+ * the products (TwoProduct, via FMA where the target has it) and of the sums (TwoSum) are
+ * accumulated separately, so the result is as accurate as a dot product computed in twice
+ * the precision.
+ */
+template <class It1, class It2>
+inline Common::floating_value_type<It1> accurate_dot(It1 first1, It1 last1, It2 first2)
+{
+    using T = typename std::iterator_traits<It1>::value_type;
+    static_assert(std::is_same<T, typename std::iterator_traits<It2>::value_type>::value,
+                  "Vc::accurate_dot requires both ranges to have the same value_type");
+    const std::size_t n = std::distance(first1, last1);
+    if (n == 0) {
+        return T();
+    }
+    return Common::accurate_dot_impl(std::addressof(*first1), std::addressof(*first2), n,
+                                     Traits::is_valid_vector_argument<T>());
+}
+
+/// Returns accurate_dot() of the ranges \p a and \p b, which must have the same size.
+template <class R1, class R2>
+inline auto accurate_dot(const R1 &a, const R2 &b)
+    -> decltype(accurate_dot(std::begin(a), std::end(a), std::begin(b)))
+{
+    Vc_ASSERT(std::distance(std::begin(a), std::end(a)) ==
+              std::distance(std::begin(b), std::end(b)));
+    return accurate_dot(std::begin(a), std::end(a), std::begin(b));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile summation.h <Vc/summation>
+ *
+ * Returns the sum of the contiguous floating-point range [\p first, \p last) by blocked
+ * pairwise summation. The error bound grows with log2(n) instead of n, at practically the
+ * cost of a plain vectorized sum. This is the cheaper choice when an error of a few ulp
+ * times the sum of magnitudes is acceptable; accurate_sum() is also accurate for sums
+ * with heavy cancellation.
+ */
+template <class It> inline Common::floating_value_type<It> pairwise_sum(It first, It last)
+{
+    using T = typename std::iterator_traits<It>::value_type;
+    const std::size_t n = std::distance(first, last);
+    if (n == 0) {
+        return T();
+    }
+    return Common::pairwise_sum_impl(std::addressof(*first), n,
+                                     Traits::is_valid_vector_argument<T>());
+}
+
+/// \copydoc pairwise_sum(It, It)
+template <class Range>
+inline auto pairwise_sum(const Range &r)
+    -> decltype(pairwise_sum(std::begin(r), std::end(r)))
+{
+    return pairwise_sum(std::begin(r), std::end(r));
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile summation.h <Vc/summation>
+ *
+ * Returns the dot product of [\p first1, \p last1) and the range starting at \p first2
+ * by blocked pairwise summation of the products. \see pairwise_sum
+ */
+template <class It1, class It2>
+inline Common::floating_value_type<It1> pairwise_dot(It1 first1, It1 last1, It2 first2)
+{
+    using T = typename std::iterator_traits<It1>::value_type;
+    static_assert(std::is_same<T, typename std::iterator_traits<It2>::value_type>::value,
+                  "Vc::pairwise_dot requires both ranges to have the same value_type");
+    const std::size_t n = std::distance(first1, last1);
+    if (n == 0) {
+        return T();
+    }
+    return Common::pairwise_dot_impl(std::addressof(*first1), std::addressof(*first2), n,
+                                     Traits::is_valid_vector_argument<T>());
+}
+
+/// Returns pairwise_dot() of the ranges \p a and \p b, which must have the same size.
+template <class R1, class R2>
+inline auto pairwise_dot(const R1 &a, const R2 &b)
+    -> decltype(pairwise_dot(std::begin(a), std::end(a), std::begin(b)))
+{
+    Vc_ASSERT(std::distance(std::begin(a), std::end(a)) ==
+              std::distance(std::begin(b), std::end(b)));
+    return pairwise_dot(std::begin(a), std::end(a), std::begin(b));
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_SUMMATION_H_
+
+// vim: foldmethod=marker
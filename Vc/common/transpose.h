@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define VC_COMMON_TRANSPOSE_H_
 
 #include "macros.h"
+#include <cstddef>
 #include <tuple>
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -50,6 +51,29 @@ template <typename... Vs> Common::TransposeProxy<Vs...> transpose(Vs... vs)
 {
     return {vs...};
 }
+
+namespace Detail
+{
+/**\internal
+ * Transposes the square matrix whose rows are the \c V::Size vectors in \p rows, in
+ * registers: log2(V::Size) rounds of interleaveLow/High (a perfect shuffle). \c V::Size
+ * must be a power of two.
+ */
+template <typename V> Vc_INTRINSIC void transpose_square(V *rows)
+{
+    constexpr std::size_t W = V::Size;
+    for (std::size_t round = 1; round < W; round *= 2) {
+        V t[W];
+        for (std::size_t i = 0; i < W / 2; ++i) {
+            t[2 * i] = rows[i].interleaveLow(rows[i + W / 2]);
+            t[2 * i + 1] = rows[i].interleaveHigh(rows[i + W / 2]);
+        }
+        for (std::size_t i = 0; i < W; ++i) {
+            rows[i] = t[i];
+        }
+    }
+}
+}  // namespace Detail
 }  // namespace Vc
 
 #endif  // VC_COMMON_TRANSPOSE_H_
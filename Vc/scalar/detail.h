@@ -35,6 +35,24 @@ namespace Vc_VERSIONED_NAMESPACE
 {
 namespace Detail
 {
+// mulhi{{{1
+/**\internal
+ * Returns the high half of the full product of \p a and \p b.
+ */
+Vc_INTRINSIC int mulhi(int a, int b, int)
+{
+    return static_cast<int>((static_cast<long long>(a) * b) >> 32);
+}
+Vc_INTRINSIC uint mulhi(uint a, uint b, uint)
+{
+    return static_cast<uint>((static_cast<unsigned long long>(a) * b) >> 32);
+}
+Vc_INTRINSIC short mulhi(short a, short b, short) { return static_cast<short>((a * b) >> 16); }
+Vc_INTRINSIC ushort mulhi(ushort a, ushort b, ushort)
+{
+    return static_cast<ushort>((static_cast<uint>(a) * b) >> 16);
+}
+
 //InterleaveImpl{{{1
 template<typename V, size_t Size, size_t VSize> struct InterleaveImpl;
 template<typename V, size_t VSize> struct InterleaveImpl<V, 1, VSize> {
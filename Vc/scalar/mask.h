@@ -29,6 +29,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define VC_SCALAR_MASK_H_
 
 #include "types.h"
+#include "../common/packedbits.h"
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -105,6 +106,15 @@ public:
         Vc_ALWAYS_INLINE void store(bool *mem) const { *mem = m; }
         template<typename Flags> Vc_ALWAYS_INLINE void store(bool *mem, Flags) const { *mem = m; }
 
+        static Vc_INTRINSIC Mask fromBits(const std::uint64_t *bits, std::size_t offset)
+        {
+            return Mask(Detail::load_bits<1>(bits, offset) != 0);
+        }
+        Vc_INTRINSIC void storeBits(std::uint64_t *bits, std::size_t offset) const
+        {
+            Detail::store_bits<1>(bits, offset, m);
+        }
+
         Vc_ALWAYS_INLINE bool operator==(const Mask &rhs) const { return m == rhs.m; }
         Vc_ALWAYS_INLINE bool operator!=(const Mask &rhs) const { return m != rhs.m; }
 
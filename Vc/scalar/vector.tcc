@@ -78,6 +78,22 @@ Vc_INTRINSIC void Vector<T, VectorAbi::Scalar>::store(U *mem, Mask mask, Flags)
         mem[0] = m_data;
 }
 
+// partial loads and stores{{{1
+template <typename T>
+Vc_INTRINSIC void Vector<T, VectorAbi::Scalar>::load_partial(const EntryType *mem,
+                                                             std::size_t n)
+{
+    m_data = n > 0 ? mem[0] : T(0);
+}
+template <typename T>
+Vc_INTRINSIC void Vector<T, VectorAbi::Scalar>::store_partial(EntryType *mem,
+                                                              std::size_t n) const
+{
+    if (n > 0) {
+        mem[0] = m_data;
+    }
+}
+
 // gather {{{1
 template <typename T>
 template <class MT, class IT, int Scale>
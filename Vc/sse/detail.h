@@ -330,6 +330,60 @@ Vc_INTRINSIC __m128 load(const T *mem, Flags f, LoadTag<__m128, float>)
     return _mm_cvtepi32_ps(load<__m128i, int>(mem, f));
 }
 
+// partial loads and stores{{{1
+/**\internal
+ * Returns a register with the first \p n entries (`n < 16 / sizeof(T)`) loaded from \p
+ * mem and the remaining entries set to zero.
+ *
+ * A 16-Byte load cannot fault if it does not cross a page boundary. In that (common)
+ * case the whole register is loaded and the excess bytes are masked off. Close to the end
+ * of a page, and always with AddressSanitizer (Vc_ASAN), the entries are copied via the
+ * stack instead.
+ */
+template <typename T> Vc_INTRINSIC __m128i load16_partial(const T *mem, std::size_t n)
+{
+    if (n == 0) {
+        return _mm_setzero_si128();  // mem may point past the last accessible page
+    }
+#ifndef Vc_ASAN
+    if ((reinterpret_cast<std::uintptr_t>(mem) & 4095) <= 4096 - 16) {
+        const __m128i keep =
+            _mm_cmpgt_epi8(_mm_set1_epi8(static_cast<char>(n * sizeof(T))),
+                           _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+        return _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(mem)), keep);
+    }
+#endif
+    alignas(16) T tmp[16 / sizeof(T)] = {};
+    for (std::size_t i = 0; i < n; ++i) {
+        tmp[i] = mem[i];
+    }
+    return _mm_load_si128(reinterpret_cast<const __m128i *>(tmp));
+}
+
+/**\internal
+ * Stores the first \p n entries (`n < 16 / sizeof(T)`) of \p x to \p mem. Memory past
+ * `mem + n` is not accessed: the entries are written with at most one 8-, 4-, and 2-Byte
+ * store each.
+ */
+template <typename T> Vc_INTRINSIC void store16_partial(T *mem, __m128i x, std::size_t n)
+{
+    char *p = reinterpret_cast<char *>(mem);
+    const std::size_t bytes = n * sizeof(T);
+    if (bytes & 8) {
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(p), x);
+        x = _mm_srli_si128(x, 8);
+        p += 8;
+    }
+    if (bytes & 4) {
+        _mm_store_ss(reinterpret_cast<float *>(p), _mm_castsi128_ps(x));
+        x = _mm_srli_si128(x, 4);
+        p += 4;
+    }
+    if (sizeof(T) == 2 && (bytes & 2)) {
+        *reinterpret_cast<T *>(p) = static_cast<T>(_mm_cvtsi128_si32(x));
+    }
+}
+
 // shifted{{{1
 template <int amount, typename T>
 Vc_INTRINSIC Vc_CONST enable_if<amount == 0, T> shifted(T k)
@@ -583,6 +637,81 @@ Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  uchar) {
 #endif
 }
 
+// mulhi{{{1
+/**\internal
+ * Returns the high half of the full product of every pair of lanes.
+ */
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b,   uint)
+{
+    const __m128i ab02 = _mm_mul_epu32(a, b);  // [a0 * b0, a2 * b2]
+    const __m128i ab13 = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+#ifdef Vc_IMPL_SSE4_1
+    return _mm_blend_epi16(_mm_srli_epi64(ab02, 32), ab13, 0xcc);
+#else
+    return _mm_or_si128(_mm_srli_epi64(ab02, 32),
+                        _mm_and_si128(ab13, _mm_setr_epi32(0, -1, 0, -1)));
+#endif
+}
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b,    int)
+{
+#ifdef Vc_IMPL_SSE4_1
+    const __m128i ab02 = _mm_mul_epi32(a, b);  // [a0 * b0, a2 * b2]
+    const __m128i ab13 = _mm_mul_epi32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_blend_epi16(_mm_srli_epi64(ab02, 32), ab13, 0xcc);
+#else
+    // the signed high half is the unsigned one minus b where a < 0 and minus a where b < 0
+    const __m128i hi = mulhi(a, b, uint());
+    return _mm_sub_epi32(_mm_sub_epi32(hi, _mm_and_si128(_mm_srai_epi32(a, 31), b)),
+                         _mm_and_si128(_mm_srai_epi32(b, 31), a));
+#endif
+}
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b,  short) { return _mm_mulhi_epi16(a, b); }
+Vc_INTRINSIC __m128i mulhi(__m128i a, __m128i b, ushort) { return _mm_mulhi_epu16(a, b); }
+
+// per-byte bit manipulation{{{1
+#ifdef Vc_IMPL_SSSE3
+/**\internal
+ * Returns the number of set bits of every byte, looked up per nibble with pshufb.
+ */
+Vc_INTRINSIC __m128i popcnt_epi8(__m128i x)
+{
+    const __m128i lut = _mm_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    return _mm_add_epi8(_mm_shuffle_epi8(lut, _mm_and_si128(x, nibble)),
+                        _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(x, 4), nibble)));
+}
+
+/**\internal
+ * Reverses the bit order within every byte: the low nibble is looked up pre-shifted
+ * into the high nibble and vice versa.
+ */
+Vc_INTRINSIC __m128i bitreverse_epi8(__m128i x)
+{
+    const __m128i lutLo = _mm_setr_epi8(0x00, char(0x80), 0x40, char(0xc0), 0x20,
+                                        char(0xa0), 0x60, char(0xe0), 0x10, char(0x90),
+                                        0x50, char(0xd0), 0x30, char(0xb0), 0x70, char(0xf0));
+    const __m128i lutHi = _mm_setr_epi8(0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe, 0x1, 0x9,
+                                        0x5, 0xd, 0x3, 0xb, 0x7, 0xf);
+    const __m128i nibble = _mm_set1_epi8(0x0f);
+    return _mm_or_si128(_mm_shuffle_epi8(lutLo, _mm_and_si128(x, nibble)),
+                        _mm_shuffle_epi8(lutHi, _mm_and_si128(_mm_srli_epi16(x, 4), nibble)));
+}
+
+/**\internal
+ * Reverses the byte order of every 16-/32-bit lane.
+ */
+Vc_INTRINSIC __m128i byteswap_epi16(__m128i x)
+{
+    return _mm_shuffle_epi8(
+        x, _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+}
+Vc_INTRINSIC __m128i byteswap_epi32(__m128i x)
+{
+    return _mm_shuffle_epi8(
+        x, _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+}
+#endif  // Vc_IMPL_SSSE3
+
 // div{{{1
 Vc_INTRINSIC __m128  div(__m128  a, __m128  b,  float) { return _mm_div_ps(a, b); }
 Vc_INTRINSIC __m128d div(__m128d a, __m128d b, double) { return _mm_div_pd(a, b); }
@@ -30,6 +30,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "intrinsics.h"
 #include "../common/maskbool.h"
+#include "../common/packedbits.h"
 #include "detail.h"
 #include "macros.h"
 
@@ -42,6 +43,8 @@ Vc_INTRINSIC_L Vc_CONST_L int mask_count(__m128i) Vc_INTRINSIC_R Vc_CONST_R;
 template <size_t Size>
 Vc_INTRINSIC_L Vc_CONST_L int mask_to_int(__m128i) Vc_INTRINSIC_R Vc_CONST_R;
 template <size_t Size>
+Vc_INTRINSIC_L Vc_CONST_L __m128 mask_from_int(unsigned) Vc_INTRINSIC_R Vc_CONST_R;
+template <size_t Size>
 Vc_INTRINSIC_L Vc_CONST_L bool is_equal(__m128, __m128) Vc_INTRINSIC_R Vc_CONST_R;
 template <size_t Size>
 Vc_INTRINSIC_L Vc_CONST_L bool is_not_equal(__m128, __m128) Vc_INTRINSIC_R Vc_CONST_R;
@@ -150,6 +153,15 @@ public:
         Vc_ALWAYS_INLINE_L void store(bool *) const Vc_ALWAYS_INLINE_R;
         template<typename Flags> Vc_ALWAYS_INLINE void store(bool *mem, Flags) const { store(mem); }
 
+        static Vc_INTRINSIC Mask fromBits(const std::uint64_t *bits, std::size_t offset)
+        {
+            return Detail::mask_from_int<Size>(Detail::load_bits<Size>(bits, offset));
+        }
+        Vc_INTRINSIC void storeBits(std::uint64_t *bits, std::size_t offset) const
+        {
+            Detail::store_bits<Size>(bits, offset, toInt());
+        }
+
         Vc_ALWAYS_INLINE Vc_PURE bool operator==(const Mask &rhs) const
         {
             return Detail::is_equal<Size>(dataF(), rhs.dataF());
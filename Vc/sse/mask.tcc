@@ -142,6 +142,27 @@ template<> Vc_ALWAYS_INLINE __m128 mask_load<2>(const bool *mem)
         _mm_set_epi32(-int(mem[1]), -int(mem[1]), -int(mem[0]), -int(mem[0])));
 }
 /*}}}*/
+// mask_from_int/*{{{*/
+// Broadcasts the bits and compares every entry against its own bit.
+template <> Vc_INTRINSIC Vc_CONST __m128 mask_from_int<2>(unsigned bits)
+{
+    const __m128i k = _mm_setr_epi32(1, 1, 2, 2);
+    return sse_cast<__m128>(
+        _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(bits), k), k));
+}
+template <> Vc_INTRINSIC Vc_CONST __m128 mask_from_int<4>(unsigned bits)
+{
+    const __m128i k = _mm_setr_epi32(1, 2, 4, 8);
+    return sse_cast<__m128>(
+        _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32(bits), k), k));
+}
+template <> Vc_INTRINSIC Vc_CONST __m128 mask_from_int<8>(unsigned bits)
+{
+    const __m128i k = _mm_setr_epi16(1, 2, 4, 8, 16, 32, 64, 128);
+    return sse_cast<__m128>(
+        _mm_cmpeq_epi16(_mm_and_si128(_mm_set1_epi16(bits), k), k));
+}
+/*}}}*/
 // is_equal{{{
 template <> Vc_INTRINSIC Vc_CONST bool is_equal<2>(__m128 k1, __m128 k2)
 {
@@ -271,6 +271,29 @@ Vc_INTRINSIC void Vector<T, VectorAbi::Sse>::store(U *mem, Mask mask, Flags flag
     HV::template store<Flags>(mem, data(), mask.data());
 }
 
+// partial loads and stores {{{1
+template <typename T>
+Vc_INTRINSIC void Vector<T, VectorAbi::Sse>::load_partial(const EntryType *mem,
+                                                          std::size_t n)
+{
+    if (n >= Size) {
+        load(mem, Vc::Unaligned);
+    } else {
+        d.v() = SSE::sse_cast<VectorType>(Detail::load16_partial(mem, n));
+    }
+}
+
+template <typename T>
+Vc_INTRINSIC void Vector<T, VectorAbi::Sse>::store_partial(EntryType *mem,
+                                                           std::size_t n) const
+{
+    if (n >= Size) {
+        store(mem, Vc::Unaligned);
+    } else {
+        Detail::store16_partial(mem, SSE::sse_cast<__m128i>(d.v()), n);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////
 // operator- {{{1
 template<typename T> Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::operator-() const
@@ -0,0 +1,72 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#ifndef VC_EXAMPLES_BENCHMARK_H_
+#define VC_EXAMPLES_BENCHMARK_H_
+
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include "tsc.h"
+
+// Result of one benchmark: the fastest of all repetitions, in cycles and in seconds.
+struct Timing
+{
+    double cycles = std::numeric_limits<double>::max();
+    double seconds = std::numeric_limits<double>::max();
+};
+
+// Keeps the compiler from optimizing away the computation of a result.
+template <typename T> inline void doNotOptimize(const T &x)
+{
+#if defined __GNUC__ || defined __clang__
+    asm volatile("" : : "g"(&x) : "memory");
+#else
+    volatile const void *unused = &x;
+    (void)unused;
+#endif
+}
+
+// Calls f once to warm up caches and then repetitions more times, returning the fastest
+// run.
+template <typename F> Timing benchmark(F &&f, int repetitions = 10)
+{
+    f();
+    Timing best;
+    TimeStampCounter tsc;
+    for (int i = 0; i < repetitions; ++i) {
+        const auto t0 = std::chrono::steady_clock::now();
+        tsc.start();
+        f();
+        tsc.stop();
+        const auto t1 = std::chrono::steady_clock::now();
+        best.cycles = std::min(best.cycles, double(tsc.cycles()));
+        best.seconds =
+            std::min(best.seconds, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return best;
+}
+
+#endif  // VC_EXAMPLES_BENCHMARK_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,100 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/biquad>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../benchmark.h"
+
+// Filters interleaved multichannel frames through a cascade of four low-pass sections
+// per channel, once with Vc::biquad_bank and once with one scalar cascade per channel,
+// and reports cycles per sample (one channel of one frame).
+
+constexpr std::size_t Sections = 4;
+constexpr std::size_t Frames = 1 << 16;
+
+template <typename V> static void run()
+{
+    constexpr std::size_t C = V::Size;
+    using Coefficients = Vc::biquad_coefficients<float>;
+    std::mt19937 rng(C);
+    std::uniform_real_distribution<float> dist(-1, 1);
+    std::vector<float> in(Frames * C), out(Frames * C);
+    for (auto &x : in) {
+        x = dist(rng);
+    }
+
+    Vc::biquad_bank<V> bank(Sections);
+    std::vector<Coefficients> scalar(C * Sections);
+    for (std::size_t c = 0; c < C; ++c) {
+        for (std::size_t s = 0; s < Sections; ++s) {
+            const auto k = Coefficients::lowpass(0.05f + 0.3f * c / C);
+            bank.set(s, c, k);
+            scalar[c * Sections + s] = k;
+        }
+    }
+    const Timing tBank = benchmark([&] {
+        bank.process(in.data(), out.data(), Frames);
+        doNotOptimize(out);
+    }, 5);
+
+    std::vector<float> z(2 * C * Sections);
+    const Timing tScalar = benchmark([&] {
+        for (std::size_t c = 0; c < C; ++c) {
+            for (std::size_t f = 0; f < Frames; ++f) {
+                float x = in[f * C + c];
+                for (std::size_t s = 0; s < Sections; ++s) {
+                    const Coefficients &k = scalar[c * Sections + s];
+                    float *zs = &z[2 * (c * Sections + s)];
+                    float &z1 = zs[0], &z2 = zs[1];
+                    const float y = k.b0 * x + z1;
+                    z1 = k.b1 * x - k.a1 * y + z2;
+                    z2 = k.b2 * x - k.a2 * y;
+                    x = y;
+                }
+                out[f * C + c] = x;
+            }
+        }
+        doNotOptimize(out);
+    }, 5);
+    std::cout << std::setw(9) << C << std::setw(12) << tScalar.cycles / (Frames * C)
+              << std::setw(12) << tBank.cycles / (Frames * C) << std::setw(10)
+              << tScalar.cycles / tBank.cycles << '\n';
+}
+
+int Vc_CDECL main()
+{
+    std::cout << std::setprecision(3);
+    std::cout << std::setw(9) << "channels" << std::setw(12) << "scalar" << std::setw(12)
+              << "bank" << std::setw(10) << "speedup"
+              << "  (cycles per sample, " << Sections << " sections)\n";
+    run<Vc::float_v>();
+    run<Vc::SimdArray<float, 16>>();
+    run<Vc::SimdArray<float, 32>>();
+    run<Vc::SimdArray<float, 64>>();
+    return 0;
+}
+
+// vim: foldmethod=marker
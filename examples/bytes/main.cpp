@@ -0,0 +1,141 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/bytes>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "../benchmark.h"
+
+// Throughput of the Vc::bytes kernels against the C library / std:: equivalents on a
+// synthetic CSV log (mostly ASCII, a few UTF-8 sequences). Compiled for the Scalar
+// target this measures the fallback loops.
+
+static void report(const char *name, std::size_t n, Timing ref, Timing vc)
+{
+    std::cout << std::setw(14) << name << std::setw(10) << n << std::setw(12)
+              << std::setprecision(3) << n / ref.seconds * 1e-9 << std::setw(12)
+              << n / vc.seconds * 1e-9 << std::setw(10) << ref.seconds / vc.seconds << '\n';
+}
+
+template <typename A, typename B> static void check(const char *name, A a, B b)
+{
+    if (a != b) {
+        std::cerr << name << ": Vc and reference results differ\n";
+        std::exit(1);
+    }
+}
+
+static std::string makeLog(std::size_t n)
+{
+    static const char *const words[] = {"GET", "/index.html", "200", "Mozilla/5.0",
+                                        "caf\xc3\xa9", "\"quoted, field\"", "12.5"};
+    std::default_random_engine rne;
+    std::uniform_int_distribution<int> pick(0, 6);
+    std::string s;
+    while (s.size() < n) {
+        for (int field = 0; field < 8; ++field) {
+            s += words[pick(rne)];
+            s += field == 7 ? '\n' : ',';
+        }
+    }
+    s.resize(n);
+    s.back() = '\n';
+    return s;
+}
+
+int Vc_CDECL main()
+{
+    std::cout << std::setw(14) << "kernel" << std::setw(10) << "bytes" << std::setw(12)
+              << "ref GB/s" << std::setw(12) << "Vc GB/s" << std::setw(10) << "speedup"
+              << '\n';
+    for (std::size_t N = 1024; N <= (std::size_t(1) << 24); N *= 16) {
+        const std::string log = makeLog(N);
+        const char *first = log.data();
+        const char *last = first + N;
+
+        // memchr for a byte that does not occur: both scan the whole input
+        check("find", Vc::bytes::find(first, last, '\t'), std::find(first, last, '\t'));
+        report("find", N, benchmark([&] {
+                   const void *r = std::memchr(first, '\t', N);
+                   doNotOptimize(r);
+               }),
+               benchmark([&] { doNotOptimize(Vc::bytes::find(first, last, '\t')); }));
+
+        const char delims[] = "\t;|";
+        const Vc::bytes::byte_set delimSet(delims);
+        check("find_first_of", Vc::bytes::find_first_of(first, last, delimSet),
+              std::find_first_of(first, last, delims, delims + 3));
+        report("find_first_of", N, benchmark([&] {
+                   doNotOptimize(std::strpbrk(first, delims));
+               }),
+               benchmark([&] {
+                   doNotOptimize(Vc::bytes::find_first_of(first, last, delimSet));
+               }));
+
+        check("count", Vc::bytes::count(first, last, '\n'),
+              std::size_t(std::count(first, last, '\n')));
+        report("count", N,
+               benchmark([&] { doNotOptimize(std::count(first, last, '\n')); }),
+               benchmark([&] { doNotOptimize(Vc::bytes::count(first, last, '\n')); }));
+
+        const Vc::bytes::byte_set structural(",\"\n");
+        std::vector<std::uint64_t> bits((N + 63) / 64);
+        report("match_bits", N, benchmark([&] {
+                   std::fill(bits.begin(), bits.end(), 0);
+                   for (std::size_t i = 0; i < N; ++i) {
+                       bits[i / 64] |= std::uint64_t(structural.contains(first[i]))
+                                       << (i % 64);
+                   }
+                   doNotOptimize(bits);
+               }),
+               benchmark([&] {
+                   Vc::bytes::match_bits(first, last, structural, bits.data());
+                   doNotOptimize(bits);
+               }));
+
+        check("validate_utf8", Vc::bytes::validate_utf8(first, last), true);
+        report("validate_utf8", N, benchmark([&] {
+                   doNotOptimize(Vc::bytes::Detail::validate_utf8_scalar(first, last, false));
+               }),
+               benchmark([&] { doNotOptimize(Vc::bytes::validate_utf8(first, last)); }));
+
+        std::string out(N, '\0');
+        report("to_upper", N, benchmark([&] {
+                   std::transform(first, last, &out[0], [](char c) {
+                       return c >= 'a' && c <= 'z' ? char(c - 32) : c;
+                   });
+                   doNotOptimize(out);
+               }),
+               benchmark([&] {
+                   Vc::bytes::to_upper(first, last, &out[0]);
+                   doNotOptimize(out);
+               }));
+    }
+    return 0;
+}
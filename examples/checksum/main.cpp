@@ -0,0 +1,81 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/checksum>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+#include "../benchmark.h"
+
+// Reports the throughput of the Vc::checksum kernels, and of the fallbacks that are used
+// on CPUs without the respective instructions, for buffers from L1-resident to far larger
+// than the last level cache.
+
+static std::uint32_t adler32Scalar(const unsigned char *p, std::size_t n)
+{
+    std::uint32_t s1 = 1, s2 = 0;
+    Vc::checksum::Detail::adler32_scalar(s1, s2, p, n);
+    return s2 << 16 | s1;
+}
+
+template <typename F> static void report(const char *name, std::size_t n, F &&f)
+{
+    std::uint64_t result = 0;
+    const Timing t = benchmark([&] {
+        result = f();
+        doNotOptimize(result);
+    });
+    std::cout << std::setw(16) << name << std::setw(12) << n << std::setw(10)
+              << n / t.seconds * 1e-9 << " GB/s" << std::setw(10) << n / t.cycles
+              << " B/cycle\n";
+}
+
+int Vc_CDECL main()
+{
+    std::cout << std::setprecision(3);
+    for (std::size_t n : {std::size_t(4) << 10, std::size_t(256) << 10,
+                          std::size_t(64) << 20}) {
+        std::vector<unsigned char> data(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            data[i] = static_cast<unsigned char>(i * 7 + (i >> 9));
+        }
+        const unsigned char *p = data.data();
+        const std::uint32_t crcTable = ~Vc::checksum::Detail::crc32c_table(~0u, p, n);
+        if (Vc::checksum::adler32(p, n) != adler32Scalar(p, n) ||
+            Vc::checksum::crc32c(p, n) != crcTable) {
+            std::cerr << "checksums differ\n";
+            return 1;
+        }
+        report("crc32c", n, [&] { return Vc::checksum::crc32c(p, n); });
+        report("crc32c (table)", n,
+               [&] { return Vc::checksum::Detail::crc32c_table(~0u, p, n); });
+        report("adler32", n, [&] { return Vc::checksum::adler32(p, n); });
+        report("adler32 (scalar)", n, [&] { return adler32Scalar(p, n); });
+        report("xxh64", n, [&] { return Vc::checksum::xxh64(p, n); });
+        std::cout << '\n';
+    }
+    return 0;
+}
+
+// vim: foldmethod=marker
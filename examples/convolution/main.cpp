@@ -0,0 +1,83 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/convolution>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../benchmark.h"
+
+// Streams one million samples through Vc::fir with both summation methods and reports
+// the effective GFLOP/s, counting 2 * taps flops per output as the direct sum needs
+// them. The crossover between the two columns is where fir_method::automatic switches
+// to overlap-save. short uses the direct method only.
+
+template <typename T>
+static double gflops(std::size_t taps, Vc::fir_method method, const std::vector<T> &x)
+{
+    std::mt19937 rng(taps);
+    std::uniform_real_distribution<float> dist(-1, 1);
+    std::vector<T> h(taps);
+    for (auto &v : h) {
+        v = static_cast<T>(dist(rng) * (std::is_floating_point<T>::value ? 1 : 1000));
+    }
+    Vc::fir<T> filter(h.data(), taps, method);
+    std::vector<typename Vc::fir<T>::result_type> y(x.size());
+    const Timing t = benchmark([&] {
+        filter.process(x.data(), x.size(), y.data());
+        doNotOptimize(y);
+    }, 3);
+    return 2e-9 * taps * x.size() / t.seconds;
+}
+
+int Vc_CDECL main()
+{
+    constexpr std::size_t N = 1 << 20;
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> dist(-1, 1);
+    std::vector<float> xf(N);
+    std::vector<double> xd(N);
+    std::vector<short> xs(N);
+    for (std::size_t i = 0; i < N; ++i) {
+        xf[i] = dist(rng);
+        xd[i] = xf[i];
+        xs[i] = static_cast<short>(xf[i] * 30000);
+    }
+    std::cout << std::setprecision(3);
+    std::cout << std::setw(6) << "taps" << std::setw(14) << "float direct"
+              << std::setw(12) << "float fft" << std::setw(15) << "double direct"
+              << std::setw(12) << "double fft" << std::setw(14) << "short direct"
+              << "  (GFLOP/s)\n";
+    for (std::size_t taps : {4u, 16u, 32u, 64u, 128u, 192u, 256u, 512u, 1024u, 4096u}) {
+        std::cout << std::setw(6) << taps << std::setw(14)
+                  << gflops(taps, Vc::fir_method::direct, xf) << std::setw(12)
+                  << gflops(taps, Vc::fir_method::fft, xf) << std::setw(15)
+                  << gflops(taps, Vc::fir_method::direct, xd) << std::setw(12)
+                  << gflops(taps, Vc::fir_method::fft, xd) << std::setw(14)
+                  << gflops(taps, Vc::fir_method::direct, xs) << '\n';
+    }
+    return 0;
+}
+
+// vim: foldmethod=marker
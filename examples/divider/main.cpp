@@ -0,0 +1,122 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+#include <Vc/Vc>
+#include <Vc/divider>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include "../benchmark.h"
+
+// Compares Vc::divider against the built-in vector division and modulo operators (and a
+// scalar loop) for the division of a whole array by a runtime-invariant divisor.
+
+static void report(const char *type, const char *op, int d, std::size_t n, Timing scalar,
+                   Timing vector, Timing divider)
+{
+    std::cout << std::setw(8) << type << std::setw(4) << op << std::setw(8) << d
+              << std::setw(12) << scalar.cycles / n << std::setw(12) << vector.cycles / n
+              << std::setw(12) << divider.cycles / n << std::setw(10)
+              << vector.cycles / divider.cycles << '\n';
+}
+
+template <typename V> static void run(const char *type, int d)
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t N = 1 << 14;
+    Vc::Memory<V, N> in;
+    Vc::Memory<V, N> out;
+    for (std::size_t i = 0; i < N; ++i) {
+        in[i] = static_cast<T>(std::rand());
+    }
+    const T divisor = static_cast<T>(d);
+    const Vc::divider<T> byD(divisor);
+
+    const auto scalarDiv = benchmark([&] {
+        for (std::size_t i = 0; i < N; ++i) {
+            out[i] = in[i] / divisor;
+        }
+        doNotOptimize(out);
+    });
+    const auto vectorDiv = benchmark([&] {
+        for (std::size_t i = 0; i < in.vectorsCount(); ++i) {
+            out.vector(i) = in.vector(i) / V(divisor);
+        }
+        doNotOptimize(out);
+    });
+    const auto dividerDiv = benchmark([&] {
+        for (std::size_t i = 0; i < in.vectorsCount(); ++i) {
+            out.vector(i) = V(in.vector(i)) / byD;
+        }
+        doNotOptimize(out);
+    });
+    for (std::size_t i = 0; i < N; ++i) {
+        if (out[i] != T(in[i] / divisor)) {
+            std::cerr << type << ": wrong quotient for " << in[i] << " / " << d << '\n';
+            std::exit(1);
+        }
+    }
+    report(type, "/", d, N, scalarDiv, vectorDiv, dividerDiv);
+
+    const auto scalarMod = benchmark([&] {
+        for (std::size_t i = 0; i < N; ++i) {
+            out[i] = in[i] % divisor;
+        }
+        doNotOptimize(out);
+    });
+    const auto vectorMod = benchmark([&] {
+        for (std::size_t i = 0; i < in.vectorsCount(); ++i) {
+            out.vector(i) = in.vector(i) % V(divisor);
+        }
+        doNotOptimize(out);
+    });
+    const auto dividerMod = benchmark([&] {
+        for (std::size_t i = 0; i < in.vectorsCount(); ++i) {
+            out.vector(i) = V(in.vector(i)) % byD;
+        }
+        doNotOptimize(out);
+    });
+    report(type, "%", d, N, scalarMod, vectorMod, dividerMod);
+}
+
+int Vc_CDECL main(int argc, char **argv)
+{
+    // the divisor is read at runtime so that the compiler cannot optimize the scalar loop
+    // into a multiplication itself
+    const int d = argc > 1 ? std::atoi(argv[1]) : 7;
+    if (d == 0) {
+        std::cerr << "the divisor must not be 0\n";
+        return 1;
+    }
+    std::cout << std::setprecision(3);
+    std::cout << std::setw(8) << "type" << std::setw(4) << "op" << std::setw(8) << "d"
+              << std::setw(12) << "scalar" << std::setw(12) << "operator"
+              << std::setw(12) << "divider" << std::setw(10) << "speedup"
+              << "  (cycles per element)\n";
+    run<Vc::int_v>("int", d);
+    run<Vc::uint_v>("uint", d < 0 ? -d : d);
+    run<Vc::short_v>("short", d);
+    run<Vc::ushort_v>("ushort", d < 0 ? -d : d);
+    return 0;
+}
+
+// vim: foldmethod=marker
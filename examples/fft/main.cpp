@@ -0,0 +1,127 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/fft>
+#include <cmath>
+#include <complex>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../benchmark.h"
+
+// Measures Vc::fft<float> for complex, real and batched transforms and compares the
+// complex transform to a textbook iterative radix-2 FFT on std::complex<float>. The
+// numbers are cycles per transform and the customary 5 n log2(n) flops per cycle.
+
+using Complex = std::complex<float>;
+
+static void radix2(std::vector<Complex> &x)
+{
+    const std::size_t n = x.size();
+    for (std::size_t i = 1, j = 0; i < n; ++i) {
+        std::size_t bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(x[i], x[j]);
+        }
+    }
+    for (std::size_t len = 2; len <= n; len *= 2) {
+        const float phi = -2 * 3.14159265358979f / len;
+        const Complex step(std::cos(phi), std::sin(phi));
+        for (std::size_t i = 0; i < n; i += len) {
+            Complex w = 1;
+            for (std::size_t k = 0; k < len / 2; ++k, w *= step) {
+                const Complex a = x[i + k], b = x[i + k + len / 2] * w;
+                x[i + k] = a + b;
+                x[i + k + len / 2] = a - b;
+            }
+        }
+    }
+}
+
+int Vc_CDECL main()
+{
+    using V = Vc::fft<float>::vector_type;
+    using C = Vc::fft<float>::complex_vector;
+    constexpr std::size_t W = V::Size;
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> dist(-1, 1);
+    std::cout << std::setprecision(3);
+    std::cout << std::setw(8) << "n" << std::setw(12) << "radix-2" << std::setw(12)
+              << "complex" << std::setw(12) << "real" << std::setw(12) << "batched"
+              << std::setw(14) << "flops/cycle" << "  (cycles per transform)\n";
+    const std::size_t sizes[] = {64,   256,  960,   1024,  4096,
+                                 6144, 16384, 65536, 245760, 262144};
+    for (std::size_t n : sizes) {
+        std::vector<Complex> x(n), y(n);
+        std::vector<float> real(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = {dist(rng), dist(rng)};
+            real[i] = x[i].real();
+        }
+        Vc::fft<float> plan(n);
+        const bool powerOfTwo = (n & (n - 1)) == 0;
+        Timing tRadix2;
+        if (powerOfTwo) {
+            tRadix2 = benchmark([&] {
+                y = x;
+                radix2(y);
+                doNotOptimize(y);
+            }, 5);
+        }
+        const Timing tComplex = benchmark([&] {
+            plan.forward(x.data(), y.data());
+            doNotOptimize(y);
+        }, 5);
+        const Timing tReal = benchmark([&] {
+            plan.forward_real(real.data(), y.data());
+            doNotOptimize(y);
+        }, 5);
+        // W independent transforms at once, reported per transform
+        std::vector<C, Vc::Allocator<C>> batch(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            batch[i] = C(V([&](int) { return dist(rng); }), V::Zero());
+        }
+        const Timing tBatch = benchmark([&] {
+            plan.forward(batch.data());
+            doNotOptimize(batch);
+        }, 5);
+        const double flops = 5 * n * std::log2(double(n));
+        std::cout << std::setw(8) << n << std::setw(12);
+        if (powerOfTwo) {
+            std::cout << tRadix2.cycles;
+        } else {
+            std::cout << "-";
+        }
+        std::cout << std::setw(12) << tComplex.cycles << std::setw(12) << tReal.cycles
+                  << std::setw(12) << tBatch.cycles / W << std::setw(14)
+                  << flops / tComplex.cycles << '\n';
+    }
+    return 0;
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,98 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+#include <Vc/filters>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../benchmark.h"
+
+// Measures batched membership tests against Vc::blocked_bloom_filter and
+// Vc::cuckoo_filter, as used to pre-filter the probe side of a join, and compares them
+// to testing one key at a time. Most probe keys are not in the filter.
+
+using Key = std::uint64_t;
+
+template <typename Filter>
+static void run(const char *name, const Filter &filter, const std::vector<Key> &probes,
+                std::size_t buildSize)
+{
+    const std::size_t n = probes.size();
+    std::vector<std::uint64_t> bits((n + 63) / 64);
+    std::size_t hits[2] = {};
+    const Timing tSingle = benchmark([&] {
+        hits[0] = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            hits[0] += filter.contains(probes[i]);
+        }
+        doNotOptimize(hits[0]);
+    }, 3);
+    const Timing tBatch = benchmark([&] {
+        hits[1] = filter.contains(probes.data(), n, bits.data());
+        doNotOptimize(bits);
+    }, 3);
+    if (hits[0] != hits[1]) {
+        std::cerr << "contains results differ\n";
+        std::exit(1);
+    }
+    std::cout << std::setw(10) << buildSize << std::setw(8) << name << std::setw(10)
+              << filter.size_in_bytes() / 1024 << std::setw(12)
+              << tSingle.cycles / n << std::setw(12) << tBatch.cycles / n
+              << std::setw(12) << 100. * hits[1] / n << '\n';
+}
+
+int Vc_CDECL main()
+{
+    std::mt19937_64 rng(1);
+    std::cout << std::setprecision(3);
+    constexpr std::size_t NProbes = 1 << 22;
+    std::cout << std::setw(10) << "keys" << std::setw(8) << "filter" << std::setw(10)
+              << "KiB" << std::setw(12) << "single" << std::setw(12) << "batch"
+              << std::setw(12) << "positive %" << "  (cycles per key)\n";
+    for (std::size_t n = 1 << 12; n <= (1 << 24); n *= 8) {
+        std::vector<Key> keys(n);
+        for (auto &k : keys) {
+            k = rng();
+        }
+        // one in sixteen probes is a build key
+        std::vector<Key> probes(NProbes);
+        for (std::size_t i = 0; i < NProbes; ++i) {
+            probes[i] = i % 16 == 0 ? keys[rng() % n] : rng();
+        }
+
+        Vc::blocked_bloom_filter<Key> bloom(n);
+        bloom.insert(keys.data(), n);
+        run("bloom", bloom, probes, n);
+        Vc::cuckoo_filter<Key> cuckoo(n);
+        cuckoo.insert(keys.data(), n);
+        if (cuckoo.full()) {
+            std::cerr << "cuckoo filter is full\n";
+            return 1;
+        }
+        run("cuckoo", cuckoo, probes, n);
+    }
+    return 0;
+}
+
+// vim: foldmethod=marker
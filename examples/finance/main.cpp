@@ -0,0 +1,182 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+#include <Vc/finance>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include "../benchmark.h"
+
+// Prices a batch of European options with Black-Scholes (price only, and price with all
+// greeks) and simulates Monte Carlo paths, in float and double, with plain scalar code
+// and with Vc::finance on one and on all threads. Reports millions of options (or path
+// steps) per second for the Vc implementation this was compiled for.
+
+using Vc::finance::option_type;
+
+constexpr std::size_t Options = 1 << 20;
+
+static const char *implementationName()
+{
+    switch (Vc::CurrentImplementation::current()) {
+    case Vc::ScalarImpl: return "Scalar";
+    case Vc::SSE2Impl:   return "SSE2";
+    case Vc::SSE3Impl:   return "SSE3";
+    case Vc::SSSE3Impl:  return "SSSE3";
+    case Vc::SSE41Impl:  return "SSE4.1";
+    case Vc::SSE42Impl:  return "SSE4.2";
+    case Vc::AVXImpl:    return "AVX";
+    case Vc::AVX2Impl:   return "AVX2";
+    default:             return "unknown";
+    }
+}
+
+template <typename T> static T scalar_cdf(T x)
+{
+    return T(0.5) * std::erfc(-x * T(0.70710678118654752440));
+}
+
+template <typename T>
+static void scalar_black_scholes(const Vc::finance::option_batch<T> &o,
+                                 Vc::Memory<Vc::Vector<T>> &price)
+{
+    for (std::size_t i = 0; i < o.count(); ++i) {
+        const T sd = o.volatility[i] * std::sqrt(o.expiry[i]);
+        const T d1 = (std::log(o.spot[i] / o.strike[i]) +
+                      (o.rate[i] - o.dividend[i]) * o.expiry[i]) / sd + T(0.5) * sd;
+        price[i] = o.spot[i] * std::exp(-o.dividend[i] * o.expiry[i]) * scalar_cdf(d1) -
+                   o.strike[i] * std::exp(-o.rate[i] * o.expiry[i]) * scalar_cdf(d1 - sd);
+    }
+}
+
+// GBM paths with std::mt19937 and std::normal_distribution, as a plain implementation
+// would draw them.
+template <typename T>
+static T scalar_monte_carlo(const Vc::finance::gbm<T> &m, T expiry, std::size_t steps,
+                            std::size_t paths, T strike)
+{
+    std::mt19937 rng(1);
+    std::normal_distribution<T> normal;
+    const T dt = expiry / steps;
+    const T drift = (m.rate - m.dividend - T(0.5) * m.volatility * m.volatility) * dt;
+    const T diffusion = m.volatility * std::sqrt(dt);
+    double sum = 0;
+    for (std::size_t p = 0; p < paths; ++p) {
+        T x = 0, average = 0;
+        for (std::size_t j = 0; j < steps; ++j) {
+            x += drift + diffusion * normal(rng);
+            average += m.spot * std::exp(x);
+        }
+        sum += std::max(average / steps - strike, T(0));
+    }
+    return T(std::exp(-m.rate * expiry) * sum / paths);
+}
+
+static void report(const std::string &name, double work, const Timing &scalar,
+                   const Timing &one, const Timing &all)
+{
+    const auto rate = [&](const Timing &t) { return work / t.seconds * 1e-6; };
+    std::cout << std::setw(28) << name << std::setw(10);
+    if (scalar.seconds < std::numeric_limits<double>::max()) {
+        std::cout << rate(scalar);
+    } else {
+        std::cout << "-";
+    }
+    std::cout << std::setw(10) << rate(one) << std::setw(10) << rate(all) << '\n';
+}
+
+template <typename T> static void run(const char *type)
+{
+    using V = Vc::Vector<T>;
+    std::mt19937 rng(1);
+    const auto uniform = [&](double a, double b) {
+        return T(std::uniform_real_distribution<double>(a, b)(rng));
+    };
+    Vc::finance::option_batch<T> options(Options);
+    for (std::size_t i = 0; i < Options; ++i) {
+        options.spot[i] = uniform(10, 100);
+        options.strike[i] = uniform(10, 100);
+        options.rate[i] = uniform(0, 0.05);
+        options.dividend[i] = uniform(0, 0.03);
+        options.volatility[i] = uniform(0.05, 0.6);
+        options.expiry[i] = uniform(0.1, 3);
+    }
+    Vc::Memory<V> price(Options);
+    Vc::finance::option_greeks<T> greeks(Options);
+    const std::string prefix = std::string(type) + ' ';
+
+    const Timing scalar = benchmark([&] {
+        scalar_black_scholes(options, price);
+        doNotOptimize(price);
+    }, 5);
+    const auto bs = [&](unsigned threads) {
+        return benchmark([&] {
+            Vc::finance::black_scholes(options, option_type::call, price, threads);
+            doNotOptimize(price);
+        }, 10);
+    };
+    report(prefix + "black-scholes price", Options, scalar, bs(1), bs(0));
+    const auto bsg = [&](unsigned threads) {
+        return benchmark([&] {
+            Vc::finance::black_scholes(options, option_type::call, greeks, threads);
+            doNotOptimize(greeks);
+        }, 10);
+    };
+    report(prefix + "black-scholes greeks", Options, Timing(), bsg(1), bsg(0));
+
+    const Vc::finance::gbm<T> model = {T(100), T(0.03), T(0.01), T(0.3)};
+    const auto mc = [&](const char *name, std::size_t steps, std::size_t paths) {
+        const Vc::finance::asian<T> payoff = {option_type::call, T(100)};
+        const Timing s = benchmark([&] {
+            doNotOptimize(scalar_monte_carlo(model, T(1), steps, paths, T(100)));
+        }, 2);
+        const auto vc = [&](unsigned threads) {
+            return benchmark([&] {
+                using Vc::finance::monte_carlo;
+                doNotOptimize(
+                    monte_carlo(model, T(1), steps, paths, payoff, 1, threads).price);
+            }, 5);
+        };
+        report(prefix + name, double(steps) * paths, s, vc(1), vc(0));
+    };
+    mc("monte carlo 1 step", 1, 1 << 20);
+    mc("monte carlo 64 steps", 64, 1 << 15);
+}
+
+int Vc_CDECL main()
+{
+    std::cout << std::setprecision(4) << implementationName() << ": float_v::Size "
+              << Vc::float_v::Size << ", double_v::Size " << Vc::double_v::Size << '\n';
+    std::cout << std::setw(28) << "" << std::setw(10) << "scalar" << std::setw(10)
+              << "1 thread" << std::setw(10)
+              << std::to_string(std::thread::hardware_concurrency()) + " threads"
+              << "  (millions of options or path steps/s)\n";
+    run<float>("float");
+    run<double>("double");
+    return 0;
+}
+
+// vim: foldmethod=marker
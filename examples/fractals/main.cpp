@@ -0,0 +1,489 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/Vc>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../benchmark.h"
+
+// Headless Mandelbrot and Buddhabrot throughput benchmark. The kernels are the ones of
+// examples/mandelbrot and examples/buddhabrot without the Qt dependency: they render
+// into Vc::Memory buffers and hand out rows (columns for the Buddhabrot) to a pool of
+// threads. Both fractals diverge heavily between neighboring pixels, so the Vc paths
+// spend most of their time in masked iterations with an early exit once all lanes are
+// done.
+
+using Vc::float_v;
+using Vc::float_m;
+using int_v = Vc::SimdArray<int, float_v::size()>;
+using int_m = int_v::mask_type;
+
+enum MandelImpl { VcImpl, ScalarImpl };
+
+static const float S = 4.f;
+
+struct Options {
+    int width = 1024;
+    int height = 768;
+    int maxIt = 1000;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    std::string pgm;  // prefix for image output; empty for no output
+};
+
+// Calls f(i) for all i in [0, count) from nthreads threads. Items are handed out one at
+// a time, because the cost of a row varies by orders of magnitude.
+template <typename F> static void parallelFor(int count, unsigned nthreads, F &&f)
+{
+    std::atomic<int> next(0);
+    auto worker = [&]() {
+        for (int i = next++; i < count; i = next++) {
+            f(i);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < nthreads; ++t) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto &t : pool) {
+        t.join();
+    }
+}
+
+// Mandelbrot {{{1
+// The image stores the iteration count of every pixel. Rows are padded to a multiple of
+// float_v::Size so that every row starts aligned.
+struct MandelImage {
+    MandelImage(int w, int h)
+        : width(w)
+        , height(h)
+        , stride((w + float_v::Size - 1) / float_v::Size * float_v::Size)
+        , counts(stride * h)
+    {
+    }
+    float *row(int y) { return &counts[y * stride]; }
+    int width, height;
+    std::size_t stride;
+    Vc::Memory<float_v> counts;
+};
+
+template <typename T> struct MyComplex {
+    MyComplex(T r, T i) : m_real(r), m_imag(i), m_real2(r * r), m_imag2(i * i) {}
+    MyComplex squaredPlus(T r, T i) const
+    {
+        return MyComplex(m_real2 + r - m_imag2, (m_real + m_real) * m_imag + i);
+    }
+    T norm() const { return m_real2 + m_imag2; }
+
+private:
+    T m_real, m_imag;
+    T m_real2, m_imag2;
+};
+
+template <MandelImpl Impl> struct Mandel;
+
+template <> struct Mandel<VcImpl> {
+    static void row(float *Vc_RESTRICT line, int width, float x0, float c_imag_, float scale,
+                    int maxIt)
+    {
+        typedef MyComplex<float_v> Z;
+        const float_v c_imag = c_imag_;
+        for (int x = 0; x < width; x += float_v::Size) {
+            const float_v c_real = x0 + (x + float_v::IndexesFromZero()) * scale;
+            Z z(c_real, c_imag);
+            float_v n = float_v::Zero();
+            float_m inside = z.norm() < S;
+            while (any_of(inside)) {
+                z = z.squaredPlus(c_real, c_imag);
+                Vc::where(inside) | n += 1.f;
+                inside = z.norm() < S && n < float(maxIt);
+            }
+            n.store(line + x, Vc::Aligned);
+        }
+    }
+};
+
+template <> struct Mandel<ScalarImpl> {
+    static void row(float *Vc_RESTRICT line, int width, float x0, float c_imag, float scale,
+                    int maxIt)
+    {
+        typedef MyComplex<float> Z;
+        for (int x = 0; x < width; ++x) {
+            const float c_real = x0 + x * scale;
+            Z z(c_real, c_imag);
+            int n = 0;
+            for (; z.norm() < S && n < maxIt; ++n) {
+                z = z.squaredPlus(c_real, c_imag);
+            }
+            line[x] = n;
+        }
+    }
+};
+
+template <MandelImpl Impl>
+static void mandelbrot(MandelImage &image, int maxIt, unsigned nthreads)
+{
+    const float scale = 3.2f / image.width;
+    const float x0 = -2.2f;
+    const float y0 = -0.5f * scale * image.height;
+    parallelFor(image.height, nthreads, [&](int y) {
+        Mandel<Impl>::row(image.row(y), image.width, x0, y0 + y * scale, scale, maxIt);
+    });
+}
+
+// Buddhabrot {{{1
+// The canvas counts how often an escaping orbit passes through each pixel. Every thread
+// renders into its own canvas; the canvases are summed afterwards.
+struct Canvas {
+    Canvas(int w, int h) : width(w), height(h), hits(std::size_t(w) * h)
+    {
+        hits.setZero();
+    }
+    void addDot(float x, float y) { hits[int(y) * width + int(x)] += 1.f; }
+    Canvas &operator+=(const Canvas &rhs)
+    {
+        hits += rhs.hits;
+        return *this;
+    }
+    int width, height;
+    Vc::Memory<float_v> hits;
+};
+
+struct BuddhaParams {
+    float realMin = -2.102613f, realMax = 1.200613f;
+    float imagMin = 0.f, imagMax = 1.23971f;
+    float viewX, viewY = -1.f, viewHeight = 2.f;  // the visible part of the plane
+    int realSteps, imagSteps;
+    int minIt, maxIt;
+    float xFact, yFact, maxX, maxY;
+
+    BuddhaParams(const Canvas &c, int maxIterations)
+        : realSteps(c.width * 2), imagSteps(c.height), minIt(20), maxIt(maxIterations)
+    {
+        const float viewWidth = viewHeight * c.width / c.height;
+        viewX = viewWidth * -0.667f;
+        xFact = c.width / viewWidth;
+        yFact = c.height / viewHeight;
+        maxX = c.width - 1.f;
+        maxY = c.height - 1.f;
+    }
+    float real(int i) const { return realMin + (realMax - realMin) / realSteps * i; }
+    float imag(int j) const { return imagMin + (imagMax - imagMin) / imagSteps * j; }
+};
+
+template <typename T> static inline T fastNorm(T real, T imag)
+{
+    return real * real + imag * imag;
+}
+
+// points inside the main cardioid and the period-2 bulb never escape
+template <typename T>
+static inline auto knownInside(float real, T imag) -> decltype(imag < 0.f)
+{
+    const float r2 = 1.08f * real + 0.15f;
+    auto inside = fastNorm(T(real + 1.f), imag) < 0.06f;
+    if (r2 < 0.42f) {
+        inside = inside || fastNorm(T(r2), imag) < 0.417f;
+    }
+    return inside;
+}
+
+template <MandelImpl Impl> struct Buddha;
+
+template <> struct Buddha<ScalarImpl> {
+    // returns the number of iterations of the escape test
+    static std::uint64_t column(Canvas &canvas, const BuddhaParams &p, int i)
+    {
+        std::uint64_t iterations = 0;
+        const float real = p.real(i);
+        for (int j = 0; j < p.imagSteps; ++j) {
+            const float imag = p.imag(j);
+            if (knownInside(real, imag)) {
+                continue;
+            }
+            float zr = real, zi = imag;
+            int n = 0;
+            for (; n < p.maxIt && fastNorm(zr, zi) < S; ++n) {
+                const float t = zr * zr - zi * zi + real;
+                zi = 2.f * zr * zi + imag;
+                zr = t;
+            }
+            iterations += n;
+            if (n < p.minIt || n >= p.maxIt) {
+                continue;
+            }
+            zr = real;
+            zi = imag;
+            for (int k = 0; k < n; ++k) {
+                const float x = (zr - p.viewX) * p.xFact;
+                const float y = (zi - p.viewY) * p.yFact;
+                const float yn = (-zi - p.viewY) * p.yFact;
+                if (x >= 0.f && x < p.maxX && y >= 0.f && y < p.maxY && yn >= 0.f &&
+                    yn < p.maxY) {
+                    canvas.addDot(x, y);
+                    canvas.addDot(x, yn);
+                }
+                const float t = zr * zr - zi * zi + real;
+                zi = 2.f * zr * zi + imag;
+                zr = t;
+            }
+        }
+        return iterations;
+    }
+};
+
+template <> struct Buddha<VcImpl> {
+    static std::uint64_t column(Canvas &canvas, const BuddhaParams &p, int i)
+    {
+        std::uint64_t iterations = 0;
+        const float real = p.real(i);
+        const float imagStep = (p.imagMax - p.imagMin) / p.imagSteps;
+        for (int j = 0; j < p.imagSteps; j += float_v::Size) {
+            const int_v index = j + int_v::IndexesFromZero();
+            const float_v imag = p.imagMin + simd_cast<float_v>(index) * imagStep;
+            // lanes past the end of the column and lanes known to be inside are neither
+            // iterated nor traced, like the points skipped by the scalar code
+            const int_m active = simd_cast<int_m>(index < p.imagSteps) &&
+                                 !simd_cast<int_m>(knownInside(real, imag));
+            if (none_of(active)) {
+                continue;
+            }
+            float_v zr = real, zi = imag;
+            int_v n = 0;
+            int_m inside = active && simd_cast<int_m>(fastNorm(zr, zi) < S);
+            while (any_of(inside)) {
+                const float_v t = zr * zr - zi * zi + real;
+                zi = 2.f * zr * zi + imag;
+                zr = t;
+                Vc::where(inside) | n += 1;
+                inside &= simd_cast<int_m>(fastNorm(zr, zi) < S) && n < p.maxIt;
+            }
+            iterations += n.sum(active);
+            const int_m trace = active && n >= p.minIt && n < p.maxIt;
+            if (none_of(trace)) {
+                continue;
+            }
+            const int traceLength = n.max(trace);
+            zr = real;
+            zi = imag;
+            for (int k = 0; k < traceLength; ++k) {
+                const float_v x = (zr - p.viewX) * p.xFact;
+                const float_v y = (zi - p.viewY) * p.yFact;
+                const float_v yn = (-zi - p.viewY) * p.yFact;
+                const float_m draw = simd_cast<float_m>(trace && k < n) && x >= 0.f &&
+                                     x < p.maxX && y >= 0.f && y < p.maxY && yn >= 0.f &&
+                                     yn < p.maxY;
+                for (int lane : Vc::where(draw)) {
+                    canvas.addDot(x[lane], y[lane]);
+                    canvas.addDot(x[lane], yn[lane]);
+                }
+                const float_v t = zr * zr - zi * zi + real;
+                zi = 2.f * zr * zi + imag;
+                zr = t;
+            }
+        }
+        return iterations;
+    }
+};
+
+template <MandelImpl Impl>
+static std::uint64_t buddhabrot(Canvas &canvas, int maxIt, unsigned nthreads)
+{
+    const BuddhaParams p(canvas, maxIt);
+    std::vector<Canvas> canvases(nthreads, Canvas(canvas.width, canvas.height));
+    std::vector<std::uint64_t> iterations(nthreads, 0);
+    std::atomic<unsigned> nextId(0);
+    std::atomic<int> nextColumn(0);
+    auto worker = [&]() {
+        const unsigned id = nextId++;
+        for (int i = nextColumn++; i < p.realSteps; i = nextColumn++) {
+            iterations[id] += Buddha<Impl>::column(canvases[id], p, i);
+        }
+    };
+    std::vector<std::thread> pool;
+    for (unsigned t = 1; t < nthreads; ++t) {
+        pool.emplace_back(worker);
+    }
+    worker();
+    for (auto &t : pool) {
+        t.join();
+    }
+    canvas.hits.setZero();
+    std::uint64_t total = 0;
+    for (unsigned t = 0; t < nthreads; ++t) {
+        canvas += canvases[t];
+        total += iterations[t];
+    }
+    return total;
+}
+
+// output {{{1
+static void writePgm(const std::string &filename, const float *data, int width, int height,
+                     std::size_t stride)
+{
+    float max = 0.f;
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            max = std::max(max, data[y * stride + x]);
+        }
+    }
+    std::ofstream out(filename, std::ios::binary);
+    out << "P5\n" << width << ' ' << height << "\n255\n";
+    for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+            const float v = max > 0.f ? std::sqrt(data[y * stride + x] / max) : 0.f;
+            out.put(static_cast<char>(v * 255.f + 0.5f));
+        }
+    }
+}
+
+static void report(const char *fractal, const char *impl, unsigned threads,
+                   std::uint64_t iterations, Timing t, double baseline)
+{
+    std::cout << std::setw(11) << fractal << std::setw(8) << impl << std::setw(9) << threads
+              << std::setw(12) << std::setprecision(4) << t.seconds << std::setw(12)
+              << iterations / t.seconds * 1e-6 << std::setw(10) << std::setprecision(3)
+              << baseline / t.seconds << '\n';
+}
+
+static void usage(const char *argv0)
+{
+    std::cout << "Usage: " << argv0 << " [options]\n\n"
+              << "Options:\n"
+              << "  -h|--help              This message.\n"
+              << "  -s|--size <w> <h>      Image size. [1024 768]\n"
+              << "  -t|--threads <n>       Number of threads. [hardware concurrency]\n"
+              << "  --maxIt <n>            Iteration limit. [1000]\n"
+              << "  --pgm <prefix>         Write the images to <prefix>mandelbrot.pgm and "
+                 "<prefix>buddhabrot.pgm.\n";
+}
+
+int Vc_CDECL main(int argc, char **argv) //{{{1
+{
+    Options opt;
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg = argv[i];
+        if ((arg == "-s" || arg == "--size") && i + 2 < argc) {
+            opt.width = std::atoi(argv[++i]);
+            opt.height = std::atoi(argv[++i]);
+        } else if ((arg == "-t" || arg == "--threads") && i + 1 < argc) {
+            opt.threads = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--maxIt" && i + 1 < argc) {
+            opt.maxIt = std::atoi(argv[++i]);
+        } else if (arg == "--pgm" && i + 1 < argc) {
+            opt.pgm = argv[++i];
+        } else {
+            usage(argv[0]);
+            return arg == "-h" || arg == "--help" ? 0 : 1;
+        }
+    }
+    if (opt.width <= 0 || opt.height <= 0 || opt.maxIt <= 0) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    std::cout << "float_v::Size = " << float_v::Size << ", " << opt.width << 'x'
+              << opt.height << ", maxIt = " << opt.maxIt << "\n\n"
+              << std::setw(11) << "fractal" << std::setw(8) << "impl" << std::setw(9)
+              << "threads" << std::setw(12) << "seconds" << std::setw(12) << "Mit/s"
+              << std::setw(10) << "speedup" << '\n';
+
+    std::vector<unsigned> threadCounts = {1};
+    if (opt.threads > 1) {
+        threadCounts.push_back(opt.threads);
+    }
+
+    // Mandelbrot
+    MandelImage scalarImage(opt.width, opt.height), vcImage(opt.width, opt.height);
+    mandelbrot<ScalarImpl>(scalarImage, opt.maxIt, 1);
+    std::uint64_t iterations = 0;
+    std::size_t mismatches = 0;
+    mandelbrot<VcImpl>(vcImage, opt.maxIt, 1);
+    for (int y = 0; y < opt.height; ++y) {
+        for (int x = 0; x < opt.width; ++x) {
+            iterations += scalarImage.row(y)[x];
+            mismatches += scalarImage.row(y)[x] != vcImage.row(y)[x];
+        }
+    }
+    double baseline = 0;
+    for (unsigned threads : threadCounts) {
+        const Timing s =
+            benchmark([&] { mandelbrot<ScalarImpl>(scalarImage, opt.maxIt, threads); }, 3);
+        if (baseline == 0) {
+            baseline = s.seconds;
+        }
+        report("mandelbrot", "scalar", threads, iterations, s, baseline);
+        const Timing v =
+            benchmark([&] { mandelbrot<VcImpl>(vcImage, opt.maxIt, threads); }, 3);
+        report("mandelbrot", "Vc", threads, iterations, v, baseline);
+    }
+    if (mismatches * 1000 > std::size_t(opt.width) * opt.height) {
+        // rounding differences (e.g. FMA contraction) may change the count of a few pixels
+        // on the boundary of the set, but not more
+        std::cerr << "Vc and scalar Mandelbrot differ in " << mismatches << " pixels\n";
+        return 1;
+    }
+
+    // Buddhabrot
+    Canvas scalarCanvas(opt.width, opt.height), vcCanvas(opt.width, opt.height);
+    const std::uint64_t scalarIterations =
+        buddhabrot<ScalarImpl>(scalarCanvas, opt.maxIt, 1);
+    const std::uint64_t vcIterations = buddhabrot<VcImpl>(vcCanvas, opt.maxIt, 1);
+    baseline = 0;
+    for (unsigned threads : threadCounts) {
+        const Timing s =
+            benchmark([&] { buddhabrot<ScalarImpl>(scalarCanvas, opt.maxIt, threads); }, 3);
+        if (baseline == 0) {
+            baseline = s.seconds;
+        }
+        report("buddhabrot", "scalar", threads, scalarIterations, s, baseline);
+        const Timing v =
+            benchmark([&] { buddhabrot<VcImpl>(vcCanvas, opt.maxIt, threads); }, 3);
+        report("buddhabrot", "Vc", threads, vcIterations, v, baseline);
+    }
+    const double difference = double(vcIterations) - double(scalarIterations);
+    if (std::abs(difference) > 1e-3 * scalarIterations) {
+        std::cerr << "Vc and scalar Buddhabrot differ: " << vcIterations << " vs. "
+                  << scalarIterations << " iterations\n";
+        return 1;
+    }
+
+    if (!opt.pgm.empty()) {
+        writePgm(opt.pgm + "mandelbrot.pgm", vcImage.row(0), opt.width, opt.height,
+                 vcImage.stride);
+        writePgm(opt.pgm + "buddhabrot.pgm", &vcCanvas.hits[0], opt.width, opt.height,
+                 opt.width);
+    }
+    return 0;
+}
+
+// vim: foldmethod=marker
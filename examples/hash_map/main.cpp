@@ -0,0 +1,136 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/hash>
+#include <Vc/hash_map>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <unordered_map>
+#include <vector>
+#include "../benchmark.h"
+
+// Measures the vectorized key hashes and compares lookups into Vc::flat_hash_map (one key
+// at a time and batched) against std::unordered_map, for tables from cache-resident to
+// far larger than the last level cache.
+
+using Key = std::uint64_t;
+
+static void hashThroughput(const std::vector<Key> &keys)
+{
+    const std::size_t n = keys.size() / Vc::uint_v::Size * Vc::uint_v::Size;
+    const Vc::uint *const words = reinterpret_cast<const Vc::uint *>(keys.data());
+    const auto run = [&](const char *name, Vc::uint_v (*hash)(Vc::uint_v, Vc::uint_v)) {
+        const Timing t = benchmark([&] {
+            Vc::uint_v acc = Vc::uint_v::Zero();
+            for (std::size_t i = 0; i < n; i += Vc::uint_v::Size) {
+                Vc::uint_v lo, hi;
+                Vc::deinterleave(&lo, &hi, words + 2 * i, Vc::Unaligned);
+                acc ^= hash(lo, hi);
+            }
+            doNotOptimize(acc);
+        });
+        std::cout << std::setw(12) << name << std::setw(10) << t.cycles / n
+                  << " cycles/key\n";
+    };
+    run("murmur3_32",
+        [](Vc::uint_v lo, Vc::uint_v hi) { return Vc::murmur3_32(lo, hi); });
+    run("xxh32", [](Vc::uint_v lo, Vc::uint_v hi) { return Vc::xxh32(lo, hi); });
+    run("crc32c", [](Vc::uint_v lo, Vc::uint_v hi) { return Vc::crc32c(lo, hi); });
+}
+
+static void lookups(std::size_t tableSize, std::mt19937_64 &rng)
+{
+    std::vector<Key> keys(tableSize);
+    for (auto &k : keys) {
+        k = rng();
+    }
+    std::unordered_map<Key, int> stdMap;
+    Vc::flat_hash_map<Key, int> vcMap(tableSize);
+    for (std::size_t i = 0; i < tableSize; ++i) {
+        stdMap.emplace(keys[i], int(i));
+        vcMap.insert(keys[i], int(i));
+    }
+
+    // half of the probes hit, in random order
+    constexpr std::size_t NProbes = 1 << 20;
+    std::vector<Key> probes(NProbes);
+    for (std::size_t i = 0; i < NProbes; ++i) {
+        probes[i] = i % 2 ? keys[rng() % tableSize] : rng();
+    }
+    std::vector<int> out(NProbes);
+
+    std::size_t hits[3] = {};
+    const Timing tStd = benchmark([&] {
+        hits[0] = 0;
+        for (std::size_t i = 0; i < NProbes; ++i) {
+            const auto it = stdMap.find(probes[i]);
+            out[i] = it == stdMap.end() ? -1 : it->second;
+            hits[0] += it != stdMap.end();
+        }
+        doNotOptimize(out);
+    }, 3);
+    const Timing tFind = benchmark([&] {
+        hits[1] = 0;
+        for (std::size_t i = 0; i < NProbes; ++i) {
+            const int *v = vcMap.find(probes[i]);
+            out[i] = v ? *v : -1;
+            hits[1] += v != nullptr;
+        }
+        doNotOptimize(out);
+    }, 3);
+    const Timing tBatch = benchmark([&] {
+        hits[2] = vcMap.lookup(probes.data(), NProbes, out.data(), -1);
+        doNotOptimize(out);
+    }, 3);
+    if (hits[0] != hits[1] || hits[0] != hits[2]) {
+        std::cerr << "lookup results differ\n";
+        std::exit(1);
+    }
+    std::cout << std::setw(10) << tableSize << std::setw(16) << tStd.cycles / NProbes
+              << std::setw(16) << tFind.cycles / NProbes << std::setw(16)
+              << tBatch.cycles / NProbes << '\n';
+}
+
+int Vc_CDECL main()
+{
+    std::mt19937_64 rng(1);
+    std::cout << std::setprecision(3);
+    std::vector<Key> keys(1 << 16);
+    for (auto &k : keys) {
+        k = rng();
+    }
+    hashThroughput(keys);
+
+    std::cout << '\n'
+              << std::setw(10) << "keys" << std::setw(16) << "unordered_map"
+              << std::setw(16) << "find" << std::setw(16) << "lookup"
+              << "  (cycles per lookup)\n";
+    for (std::size_t n = 1 << 12; n <= (1 << 24); n *= 8) {
+        lookups(n, rng);
+    }
+    return 0;
+}
+
+// vim: foldmethod=marker
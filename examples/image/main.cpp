@@ -0,0 +1,149 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/image>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../benchmark.h"
+
+// Blurs and resizes a 12 megapixel plane of 8-bit and of float pixels, with a plain
+// scalar implementation and with Vc::image on one and on all threads, and reports the
+// throughput in megapixels (of the source plane) per second.
+
+constexpr std::size_t Rows = 3000;
+constexpr std::size_t Columns = 4000;
+
+// A straightforward separable filter with clamped borders and a float intermediate.
+template <typename T>
+static void scalar_filter(const Vc::PaddedMemory<Vc::Vector<T>> &in,
+                          Vc::PaddedMemory<Vc::Vector<T>> &out,
+                          const Vc::image::kernel &k, std::vector<float> &tmp)
+{
+    const long rows = in.rowsCount(), cols = in.columnsCount(), r = k.radius();
+    for (long y = 0; y < rows; ++y) {
+        for (long x = 0; x < cols; ++x) {
+            float sum = 0;
+            for (long i = -r; i <= r; ++i) {
+                sum += k[i + r] * in(y, std::min(cols - 1, std::max(0l, x + i)));
+            }
+            tmp[y * cols + x] = sum;
+        }
+    }
+    for (long y = 0; y < rows; ++y) {
+        for (long x = 0; x < cols; ++x) {
+            float sum = 0;
+            for (long i = -r; i <= r; ++i) {
+                sum += k[i + r] * tmp[std::min(rows - 1, std::max(0l, y + i)) * cols + x];
+            }
+            out(y, x) = std::is_integral<T>::value
+                            ? static_cast<T>(std::min(255.f, std::max(0.f, sum)) + 0.5f)
+                            : static_cast<T>(sum);
+        }
+    }
+}
+
+static void report(const char *name, std::size_t pixels, const Timing &scalar,
+                   const Timing &one, const Timing &all)
+{
+    const auto mps = [&](const Timing &t) { return pixels / t.seconds * 1e-6; };
+    std::cout << std::setw(24) << name << std::setw(10);
+    if (scalar.seconds < std::numeric_limits<double>::max()) {
+        std::cout << mps(scalar);
+    } else {
+        std::cout << "-";
+    }
+    std::cout << std::setw(10) << mps(one) << std::setw(10) << mps(all) << '\n';
+}
+
+template <typename T> static void run(const char *type)
+{
+    using V = Vc::Vector<T>;
+    using Vc::image::interpolation;
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> dist(0, 255);
+    Vc::PaddedMemory<V> in(Rows, Columns), out(Rows, Columns);
+    for (std::size_t y = 0; y < Rows; ++y) {
+        for (std::size_t x = 0; x < Columns; ++x) {
+            in(y, x) = static_cast<T>(dist(rng));
+        }
+    }
+    std::vector<float> tmp(Rows * Columns);
+    const std::string prefix = std::string(type) + ' ';
+
+    for (float sigma : {1.f, 3.f}) {
+        const auto k = Vc::image::kernel::gaussian(sigma);
+        const Timing scalar = benchmark([&] {
+            scalar_filter(in, out, k, tmp);
+            doNotOptimize(out);
+        }, 2);
+        const Timing one = benchmark([&] {
+            Vc::image::gaussian_blur(in, out, sigma, 1);
+            doNotOptimize(out);
+        }, 5);
+        const Timing all = benchmark([&] {
+            Vc::image::gaussian_blur(in, out, sigma);
+            doNotOptimize(out);
+        }, 5);
+        const std::string name = prefix + "gauss sigma " + std::to_string(int(sigma));
+        report(name.c_str(), Rows * Columns, scalar, one, all);
+    }
+
+    const auto resize = [&](const char *name, std::size_t rows, std::size_t cols,
+                            interpolation method) {
+        Vc::PaddedMemory<V> small(rows, cols);
+        const Timing one = benchmark([&] {
+            Vc::image::resize(in, small, method, 1);
+            doNotOptimize(small);
+        }, 5);
+        const Timing all = benchmark([&] {
+            Vc::image::resize(in, small, method);
+            doNotOptimize(small);
+        }, 5);
+        report((prefix + name).c_str(), Rows * Columns, Timing(), one, all);
+    };
+    resize("bilinear 1/10", Rows / 10, Columns / 10, interpolation::bilinear);
+    resize("bicubic 1/10", Rows / 10, Columns / 10, interpolation::bicubic);
+    resize("bilinear 1/2", Rows / 2, Columns / 2, interpolation::bilinear);
+    resize("bicubic 1/2", Rows / 2, Columns / 2, interpolation::bicubic);
+}
+
+int Vc_CDECL main()
+{
+    std::cout << std::setprecision(3);
+    const std::string extents = std::to_string(Columns) + 'x' + std::to_string(Rows);
+    std::cout << std::setw(24) << extents << std::setw(10) << "scalar" << std::setw(10)
+              << "1 thread" << std::setw(10)
+              << std::to_string(std::thread::hardware_concurrency()) + " threads"
+              << "  (megapixels/s)\n";
+    run<unsigned char>("uchar");
+    run<float>("float");
+    return 0;
+}
+
+// vim: foldmethod=marker
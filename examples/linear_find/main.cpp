@@ -38,88 +38,8 @@ typedef typename double_v::mask_type double_m;
 typedef typename int32_v::mask_type int32_m;
 typedef typename uint32_v::mask_type uint32_m;
 
-namespace std
-{
-template <typename T>
-struct less<Vc::Vector<T>>
-    : public binary_function<Vc::Vector<T>, Vc::Vector<T>, Vc::Mask<T>>
-{
-    Vc::Mask<T> operator()(const Vc::Vector<T> &x, const Vc::Vector<T> &y) const
-    {
-        return x < y;
-    }
-};
-
-template <typename T, std::size_t N>
-struct less<Vc::SimdArray<T, N>>
-    : public binary_function<Vc::SimdArray<T, N>, Vc::SimdArray<T, N>,
-                             typename Vc::SimdArray<T, N>::mask_type>
-{
-    typename Vc::SimdArray<T, N>::mask_type operator()(const Vc::SimdArray<T, N> &x,
-                                                       const Vc::SimdArray<T, N> &y) const
-    {
-        return x < y;
-    }
-};
-}  // namespace std
-
 namespace Vc_VERSIONED_NAMESPACE
 {
-template <class Iterator, class T, class C>
-inline Iterator lower_bound(Iterator first, Iterator last,
-                                   const T &value, C comp)
-{
-    typedef simdize<T> V;
-    constexpr auto Size = V::size();
-    typedef simdize<C, Size> CV;
-    CV comp_v;
-
-#if 1
-    const V value_v = value;
-    while (first < last) {
-        const auto l2 = (std::size_t(last - first) / 2) & ~(Size - 1);
-        const auto m = first + l2;
-        const auto mask = comp_v(V(&*m, Vc::Aligned), value_v);
-        if (all_of(mask)) {
-            first = m + Size;
-        } else if (none_of(mask)) {
-            last = m;
-        } else {
-            return m + mask.count();
-        }
-    }
-#else
-    auto len = std::distance(first, last);
-    while (len >= Size) {
-        const auto l2 = len / 2;
-        Iterator m = first;
-        std::advance(m, l2);
-        if (comp(*m, value)) {
-            first = ++m;
-            len -= l2 + 1;
-        } else {
-            len = l2;
-        }
-    }
-    const auto mask = comp_v(V(&*first), value);
-    std::advance(first, all_of(mask) ? Size : (!mask).firstOne());
-#endif
-    return first;
-}
-
-template <class Iterator, class T>
-inline Iterator find(Iterator first, Iterator last, const T &value)
-{
-    typename simdize<Iterator>::value_type value_v = value;
-    for (simdize<Iterator> it = first; it < last; ++it) {
-        const auto mask = *it == value_v;
-        if (any_of(mask)) {
-            return static_cast<Iterator>(it) + mask.firstOne();
-        }
-    }
-    return last;
-}
-
 template <class Iterator, class V>
 inline std::array<Iterator, V::size()> find_parallel(Iterator first, Iterator last,
                                                      const V &value)
@@ -0,0 +1,186 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+#include <Vc/image>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include "../benchmark.h"
+
+// Converts a 1080p video frame between packed RGB and NV12, reorders channels and blends
+// premultiplied RGBA, with plain scalar code and with Vc::image on one and on all
+// threads, and reports the throughput in megapixels per second.
+
+constexpr std::size_t Rows = 1080;
+constexpr std::size_t Columns = 1920;
+
+using Image = Vc::PaddedMemory<Vc::uchar_v>;
+
+static unsigned char saturate(float x)
+{
+    return static_cast<unsigned char>(std::min(255.f, std::max(0.f, x)) + 0.5f);
+}
+
+// BT.601 limited range, as codecs expect it.
+static void scalar_rgb_to_nv12(const Image &rgb, Image &y, Image &uv)
+{
+    for (std::size_t i = 0; i < Rows; ++i) {
+        for (std::size_t j = 0; j < Columns; ++j) {
+            const float r = rgb(i, 3 * j), g = rgb(i, 3 * j + 1), b = rgb(i, 3 * j + 2);
+            y(i, j) = saturate(16 + 0.2568f * r + 0.5041f * g + 0.0979f * b);
+        }
+    }
+    for (std::size_t i = 0; i < Rows; i += 2) {
+        for (std::size_t j = 0; j < Columns; j += 2) {
+            float c[3];
+            for (int k = 0; k < 3; ++k) {
+                c[k] = (rgb(i, 3 * j + k) + rgb(i, 3 * j + 3 + k) +
+                        rgb(i + 1, 3 * j + k) + rgb(i + 1, 3 * j + 3 + k)) *
+                       0.25f;
+            }
+            uv(i / 2, j) =
+                saturate(128 - 0.1482f * c[0] - 0.2910f * c[1] + 0.4392f * c[2]);
+            uv(i / 2, j + 1) =
+                saturate(128 + 0.4392f * c[0] - 0.3678f * c[1] - 0.0714f * c[2]);
+        }
+    }
+}
+
+static void scalar_nv12_to_rgba(const Image &y, const Image &uv, Image &rgba)
+{
+    for (std::size_t i = 0; i < Rows; ++i) {
+        for (std::size_t j = 0; j < Columns; ++j) {
+            const float l = 1.1644f * (y(i, j) - 16);
+            const float u = uv(i / 2, j & ~1) - 128.f, v = uv(i / 2, j | 1) - 128.f;
+            rgba(i, 4 * j) = saturate(l + 1.5960f * v);
+            rgba(i, 4 * j + 1) = saturate(l - 0.3918f * u - 0.8130f * v);
+            rgba(i, 4 * j + 2) = saturate(l + 2.0172f * u);
+            rgba(i, 4 * j + 3) = 255;
+        }
+    }
+}
+
+static void scalar_rgb_to_bgra(const Image &rgb, Image &bgra)
+{
+    for (std::size_t i = 0; i < Rows; ++i) {
+        for (std::size_t j = 0; j < Columns; ++j) {
+            bgra(i, 4 * j) = rgb(i, 3 * j + 2);
+            bgra(i, 4 * j + 1) = rgb(i, 3 * j + 1);
+            bgra(i, 4 * j + 2) = rgb(i, 3 * j);
+            bgra(i, 4 * j + 3) = 255;
+        }
+    }
+}
+
+static void scalar_blend_over(const Image &src, Image &dst)
+{
+    for (std::size_t i = 0; i < Rows; ++i) {
+        for (std::size_t j = 0; j < 4 * Columns; j += 4) {
+            const unsigned t = 255 - src(i, j + 3);
+            for (std::size_t k = 0; k < 4; ++k) {
+                dst(i, j + k) = static_cast<unsigned char>(
+                    src(i, j + k) + (dst(i, j + k) * t + 127) / 255);
+            }
+        }
+    }
+}
+
+template <typename S, typename F>
+static void run(const char *name, S &&scalar, F &&vectorized)
+{
+    const Timing s = benchmark([&] { scalar(); }, 5);
+    const Timing one = benchmark([&] { vectorized(1); }, 20);
+    const Timing all = benchmark([&] { vectorized(0); }, 20);
+    const auto mps = [&](const Timing &t) { return Rows * Columns / t.seconds * 1e-6; };
+    std::cout << std::setw(16) << name << std::setw(10) << mps(s) << std::setw(10)
+              << mps(one) << std::setw(10) << mps(all) << '\n';
+}
+
+int Vc_CDECL main()
+{
+    using namespace Vc::image;
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> dist(0, 255);
+    Image rgb(Rows, 3 * Columns), rgba(Rows, 4 * Columns), other(Rows, 4 * Columns);
+    Image y(Rows, Columns), uv(Rows / 2, Columns);
+    for (std::size_t i = 0; i < Rows; ++i) {
+        for (std::size_t j = 0; j < 3 * Columns; ++j) {
+            rgb(i, j) = static_cast<unsigned char>(dist(rng));
+        }
+    }
+    convert(rgb, pixel_format::rgb, rgba, pixel_format::rgba);
+    for (std::size_t i = 0; i < Rows; ++i) {
+        for (std::size_t j = 3; j < 4 * Columns; j += 4) {
+            rgba(i, j) = static_cast<unsigned char>(dist(rng));
+        }
+    }
+    premultiply(rgba, rgba);
+
+    std::cout << std::setprecision(4) << std::setw(16) << "1920x1080" << std::setw(10)
+              << "scalar" << std::setw(10) << "1 thread" << std::setw(10)
+              << std::to_string(std::thread::hardware_concurrency()) + " threads"
+              << "  (megapixels/s)\n";
+    run("rgb -> nv12",
+        [&] {
+            scalar_rgb_to_nv12(rgb, y, uv);
+            doNotOptimize(uv);
+        },
+        [&](unsigned threads) {
+            rgb_to_nv12(rgb, pixel_format::rgb, y, uv, yuv_matrix::bt601,
+                        yuv_range::limited, threads);
+            doNotOptimize(uv);
+        });
+    run("nv12 -> rgba",
+        [&] {
+            scalar_nv12_to_rgba(y, uv, other);
+            doNotOptimize(other);
+        },
+        [&](unsigned threads) {
+            nv12_to_rgb(y, uv, other, pixel_format::rgba, yuv_matrix::bt601,
+                        yuv_range::limited, threads);
+            doNotOptimize(other);
+        });
+    run("rgb -> bgra",
+        [&] {
+            scalar_rgb_to_bgra(rgb, other);
+            doNotOptimize(other);
+        },
+        [&](unsigned threads) {
+            convert(rgb, pixel_format::rgb, other, pixel_format::bgra, threads);
+            doNotOptimize(other);
+        });
+    run("blend over",
+        [&] {
+            scalar_blend_over(rgba, other);
+            doNotOptimize(other);
+        },
+        [&](unsigned threads) {
+            blend_over(rgba, other, threads);
+            doNotOptimize(other);
+        });
+    return 0;
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,171 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/rolling>
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "../benchmark.h"
+
+// Rolling sums, variances and maxima of a float time series: the naive reduction of every
+// window (O(n·w)), the classic scalar O(n) algorithms (running update, monotonic deque),
+// and Vc's kernels, on the whole series and fed in chunks of 1000 samples. Reports cycles
+// per element and, for the sums, the largest error relative to the window's sum of
+// magnitudes in units of float epsilon.
+
+using Data = std::vector<float>;
+
+static double sumError(const Data &x, std::size_t w, const Data &out)
+{
+    double worst = 0;
+    for (std::size_t i = 0; i + w <= x.size(); i += 97) {
+        double s = 0, a = 0;
+        for (std::size_t j = i; j < i + w; ++j) {
+            s += x[j];
+            a += std::abs(x[j]);
+        }
+        worst = std::max(worst, std::abs(out[i] - s) / a);
+    }
+    return worst / std::numeric_limits<float>::epsilon();
+}
+
+// Feeds x to stream in chunks of 1000 samples, as they would arrive from a device.
+template <typename Stream> static void pushChunks(Stream &&stream, const Data &x, Data &out)
+{
+    auto o = out.begin();
+    for (std::size_t i = 0; i < x.size(); i += 1000) {
+        o = stream.push(x.begin() + i, x.begin() + std::min(x.size(), i + 1000), o);
+    }
+    doNotOptimize(out[0]);
+}
+
+// Times f and prints the cycles per element.
+template <typename F>
+static void report(const char *name, std::size_t w, std::size_t n, int reps, F &&f)
+{
+    const Timing t = benchmark(f, reps);
+    std::cout << std::setw(24) << name << std::setw(7) << w << std::setw(10)
+              << std::setprecision(3) << t.cycles / n << '\n';
+}
+
+// Also prints error() of the output of f.
+template <typename F, typename E>
+static void report(const char *name, std::size_t w, std::size_t n, int reps, F &&f,
+                   E &&error)
+{
+    const Timing t = benchmark(f, reps);
+    std::cout << std::setw(24) << name << std::setw(7) << w << std::setw(10)
+              << std::setprecision(3) << t.cycles / n << std::setw(10) << error() << '\n';
+}
+
+int Vc_CDECL main()
+{
+    const std::size_t n = 1 << 18;
+    Data x(n), out(n);
+    std::mt19937 rng(1);
+    std::normal_distribution<float> noise(0, 1);
+    float level = 100;
+    for (auto &v : x) {
+        level += 0.01f * noise(rng);
+        v = level + noise(rng);
+    }
+    const int reps = 5;
+
+    std::cout << std::setw(24) << "kernel" << std::setw(7) << "window" << std::setw(10)
+              << "cyc/elem" << std::setw(10) << "error/eps" << '\n';
+    for (std::size_t w : {5, 50, 500, 5000}) {
+        const std::size_t count = n - w + 1;
+        auto error = [&] { return sumError(x, w, out); };
+        report("sum, naive", w, n, 1, [&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = std::accumulate(&x[i], &x[i] + w, 0.f);
+            }
+            doNotOptimize(out[0]);
+        }, error);
+        report("sum, running update", w, n, reps, [&] {
+            float s = std::accumulate(&x[0], &x[0] + w, 0.f);
+            out[0] = s;
+            for (std::size_t i = 1; i < count; ++i) {
+                out[i] = s += x[i + w - 1] - x[i - 1];
+            }
+            doNotOptimize(out[0]);
+        }, error);
+        report("Vc::rolling_sum", w, n, reps, [&] {
+            Vc::rolling_sum(x.begin(), x.end(), w, out.begin());
+            doNotOptimize(out[0]);
+        }, error);
+        report("Vc::RollingSum, chunks", w, n, reps,
+               [&] { pushChunks(Vc::RollingSum<float>(w), x, out); }, error);
+
+        report("variance, naive", w, n, 1, [&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                const float mean = std::accumulate(&x[i], &x[i] + w, 0.f) / w;
+                float m2 = 0;
+                for (std::size_t j = i; j < i + w; ++j) {
+                    m2 += (x[j] - mean) * (x[j] - mean);
+                }
+                out[i] = m2 / w;
+            }
+            doNotOptimize(out[0]);
+        });
+        report("Vc::rolling_variance", w, n, reps, [&] {
+            Vc::rolling_variance(x.begin(), x.end(), w, out.begin());
+            doNotOptimize(out[0]);
+        });
+
+        report("max, naive", w, n, 1, [&] {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = *std::max_element(&x[i], &x[i] + w);
+            }
+            doNotOptimize(out[0]);
+        });
+        report("max, monotonic deque", w, n, reps, [&] {
+            std::deque<std::size_t> q;  // indexes of decreasing values
+            for (std::size_t i = 0; i < n; ++i) {
+                while (!q.empty() && x[q.back()] <= x[i]) {
+                    q.pop_back();
+                }
+                q.push_back(i);
+                if (q.front() + w <= i) {
+                    q.pop_front();
+                }
+                if (i + 1 >= w) {
+                    out[i + 1 - w] = x[q.front()];
+                }
+            }
+            doNotOptimize(out[0]);
+        });
+        report("Vc::rolling_max", w, n, reps, [&] {
+            Vc::rolling_max(x.begin(), x.end(), w, out.begin());
+            doNotOptimize(out[0]);
+        });
+        report("Vc::RollingMax, chunks", w, n, reps,
+               [&] { pushChunks(Vc::RollingMax<float>(w), x, out); });
+    }
+    return 0;
+}
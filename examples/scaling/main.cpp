@@ -1,5 +1,5 @@
 /*{{{
-    Copyright (C) 2013 Matthias Kretz <kretz@kde.org>
+    Copyright (C) 2013-2026 Matthias Kretz <kretz@kde.org>
 
     Permission to use, copy, modify, and distribute this software
     and its documentation for any purpose and without fee is hereby
@@ -21,146 +21,298 @@
 
 }}}*/
 
-#include <array>
-#include <memory>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
 
 #include <Vc/Vc>
-#include "../tsc.h"
-
-using Vc::float_v;
+#include <Vc/cpuid.h>
+#include "../benchmark.h"
 
 /*
- * This example shows how an arbitrary problem scales depending on working-set size and FLOPs per
- * load/store. Understanding this can help to create better implementations.
+ * This example measures the roofline of the machine: the achieved FLOP/s and bytes/s of a
+ * simple streaming kernel depending on the working-set size (which cache level the data
+ * lives in) and the number of FLOPs per load/store (the arithmetic intensity).
+ * Understanding where a kernel sits relative to these limits can help to create better
+ * implementations.
+ *
+ * The results are written as JSON to stdout, a human-readable table goes to stderr.
  */
 
 /*
- * The Runner is a method to generate the different scenarios with all parameters to the Work
- * available as constant expressions.
- * The idea is to have the compiler able to optimize as much as possible so that the actual workload
- * alone is benchmarked.
- *
- * The Runner recursively calls operator() on the Work template class with varying arguments for N
- * and FLOPs.
+ * The Flops helper struct generates code that executes FLOPs many floating-point SIMD
+ * instructions (add, sub, and mul). The FLOP count is encoded in the type, so that the
+ * compiler sees the whole workload as one expression.
  */
-template<template<std::size_t N, std::size_t M, int, int> class Work, std::size_t N = 256, std::size_t M = 4> struct Runner
-{
-    static void run() {
-        Work<N, M, (N > 4096 ? 1 : 4096 / N), 2>()();
-        Work<N, M, (N > 4096 ? 1 : 4096 / N), 3>()();
-        Work<N, M, (N > 4096 ? 1 : 4096 / N), 4>()();
-        Work<N, M, (N > 4096 ? 1 : 4096 / N), 6>()();
-        Work<N, M, (N > 4096 ? 1 : 4096 / N), 9>()();
-        Work<N, M, (N > 4096 ? 1 : 4096 / N), 13>()();
-        Work<N, M, (N > 4096 ? 1 : 4096 / N), 19>()();
-        Work<N, M, (N > 4096 ? 1 : 4096 / N), 28>()();
-        Work<N, M, (N > 4096 ? 1 : 4096 / N), 42>()();
-        Work<N, M, (N > 4096 ? 1 : 4096 / N), 63>()();
-        Work<N, M, (N > 4096 ? 1 : 4096 / N), 94>()();
-        Work<N, M, (N > 4096 ? 1 : 4096 / N), 141>()();
-        Work<N, M, (N > 4096 ? 1 : 4096 / N), 211>()();
-        Runner<Work, N * 2, M>::run();
+template <int FLOPs> struct Flops {
+    template <typename V> inline V operator()(V a, V b, V c) const
+    {
+        typedef Flops<(FLOPs - 5) / 2> F1;
+        typedef Flops<(FLOPs - 4) / 2> F2;
+        return F1()(a + b, a * b, c) + F2()(a * c, b + c, a);
     }
 };
 
-template <template <std::size_t N, std::size_t M, int, int> class Work, std::size_t M>
-struct Runner<Work, 256 * 1024 * 32,  // don't make this number larger, otherwise GCC6
-                                      // blows up with Vc::Scalar to 10GB of memory usage
-              M> {
-    static void run() {
+template <> struct Flops<2> {
+    template <typename V> V operator()(V a, V b, V c) const { return a * b + c; }
+};
+template <> struct Flops<3> {
+    template <typename V> V operator()(V a, V b, V c) const { return a * b + (c - a); }
+};
+template <> struct Flops<4> {
+    template <typename V> V operator()(V a, V b, V c) const { return (a * b + c) + a * c; }
+};
+template <> struct Flops<5> {
+    template <typename V> V operator()(V a, V b, V c) const
+    {
+        return a * b + (a + c) + a * c;
+    }
+};
+template <> struct Flops<6> {
+    template <typename V> V operator()(V a, V b, V c) const
+    {
+        return (a * b + (a + c)) + (a * c - b);
+    }
+};
+template <> struct Flops<7> {
+    template <typename V> V operator()(V a, V b, V c) const
+    {
+        return (a * b + (a + c)) + (a * c - (b + c));
+    }
+};
+template <> struct Flops<8> {
+    template <typename V> V operator()(V a, V b, V c) const
+    {
+        return (a * b + (a + c) + b) + (a * c - (b + c));
     }
 };
 
 /*
- * The Flops helper struct generates code that executes FLOPs many floating-point SIMD instructions
- * (add, sub, and mul)
+ * The working set consists of M arrays. Every pass computes array m from the arrays m + 1,
+ * m + 2, and m + 3, i.e. three loads and one store per FLOPs * V::Size FLOPs.
  */
-template<int FLOPs> struct Flops
-{
-    inline float_v operator()(float_v a, float_v b, float_v c)
+static constexpr std::size_t M = 4;
+
+template <typename V> struct WorkingSet {
+    using T = typename V::EntryType;
+
+    // n entries per array; the padding between the arrays avoids 4k aliasing and leaves
+    // room for the unaligned offset
+    explicit WorkingSet(std::size_t n_)
+        : n(n_), stride(n + 3 * 64 / sizeof(T)), memory(M * stride)
     {
-        typedef Flops<(FLOPs - 5) / 2> F1;
-        typedef Flops<(FLOPs - 4) / 2> F2;
-        return F1()(a + b, a * b, c) + F2()(a * c, b + c, a);
+        for (std::size_t i = 0; i < M * stride; ++i) {
+            memory[i] = T(1) + T(i % 7) * T(0.125);
+        }
     }
+    std::size_t bytes() const { return M * n * sizeof(T); }
+    T *array(std::size_t m, std::size_t offset) { return &memory[m * stride + offset]; }
+
+    std::size_t n;
+    std::size_t stride;
+    Vc::Memory<V> memory;
 };
 
-template<> inline float_v Flops<2>::operator()(float_v a, float_v b, float_v c)
-{
-    return a * b + c;
-}
-template<> inline float_v Flops<3>::operator()(float_v a, float_v b, float_v c)
+template <int FLOPs, typename V, typename Flags>
+static void kernel(WorkingSet<V> &ws, std::size_t offset, int repetitions, Flags flags)
 {
-    return a * b + (c - a);
+    using T = typename V::EntryType;
+    for (int r = 0; r < repetitions; ++r) {
+        for (std::size_t m = 0; m < M; ++m) {
+            T *Vc_RESTRICT out = ws.array(m, offset);
+            const T *Vc_RESTRICT a = ws.array((m + 1) % M, offset);
+            const T *Vc_RESTRICT b = ws.array((m + 2) % M, offset);
+            const T *Vc_RESTRICT c = ws.array((m + 3) % M, offset);
+            for (std::size_t i = 0; i < ws.n; i += V::Size) {
+                Flops<FLOPs>()(V(a + i, flags), V(b + i, flags), V(c + i, flags))
+                    .store(out + i, flags);
+            }
+        }
+    }
 }
-template<> inline float_v Flops<4>::operator()(float_v a, float_v b, float_v c)
+
+// output {{{1
+struct Result {
+    const char *type;
+    const char *loads;
+    const char *level;
+    std::size_t workingSet;
+    int flops;
+    double flopPerByte;
+    double gflops;
+    double gbytes;
+    double flopPerCycle;
+};
+
+static const char *implementationName()
 {
-    return (a * b + c) + a * c;
+    switch (Vc::CurrentImplementation::current()) {
+    case Vc::ScalarImpl: return "Scalar";
+    case Vc::SSE2Impl:   return "SSE2";
+    case Vc::SSE3Impl:   return "SSE3";
+    case Vc::SSSE3Impl:  return "SSSE3";
+    case Vc::SSE41Impl:  return "SSE4.1";
+    case Vc::SSE42Impl:  return "SSE4.2";
+    case Vc::AVXImpl:    return "AVX";
+    case Vc::AVX2Impl:   return "AVX2";
+    case Vc::MICImpl:    return "MIC";
+    default:             return "unknown";
+    }
 }
-template<> inline float_v Flops<5>::operator()(float_v a, float_v b, float_v c)
+
+static void printJson(const std::vector<Result> &results)
 {
-    return a * b + (a + c) + a * c;
+    using Vc::CpuId;
+    std::printf("{\n  \"implementation\": \"%s\",\n", implementationName());
+    std::printf("  \"float_v::Size\": %d,\n  \"double_v::Size\": %d,\n",
+                int(Vc::float_v::Size), int(Vc::double_v::Size));
+    std::printf("  \"cpu\": {\"L1Data\": %u, \"L2Data\": %u, \"L3Data\": %u, "
+                "\"cacheLineSize\": %u},\n",
+                CpuId::L1Data(), CpuId::L2Data(), CpuId::L3Data(),
+                unsigned(CpuId::cacheLineSize()));
+    std::printf("  \"results\": [\n");
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const Result &r = results[i];
+        std::printf("    {\"type\": \"%s\", \"loads\": \"%s\", \"level\": \"%s\", "
+                    "\"working_set\": %zu, \"flops_per_element\": %d, "
+                    "\"flop_per_byte\": %.4f, \"gflop_per_s\": %.3f, \"gbyte_per_s\": %.3f, "
+                    "\"flop_per_cycle\": %.3f}%s\n",
+                    r.type, r.loads, r.level, r.workingSet, r.flops, r.flopPerByte, r.gflops,
+                    r.gbytes, r.flopPerCycle, i + 1 == results.size() ? "" : ",");
+    }
+    std::printf("  ]\n}\n");
 }
-template<> inline float_v Flops<6>::operator()(float_v a, float_v b, float_v c)
+
+// the benchmark driver {{{1
+template <typename V> const char *typeName();
+template <> const char *typeName<Vc::float_v>() { return "float"; }
+template <> const char *typeName<Vc::double_v>() { return "double"; }
+
+template <int FLOPs, typename V, typename Flags>
+static void measure(std::vector<Result> &results, WorkingSet<V> &ws, const char *level,
+                    const char *loads, std::size_t offset, Flags flags)
 {
-    return (a * b + (a + c)) + (a * c - b);
+    // every measurement moves at least 64 MiB so that short runs are not dominated by
+    // timer overhead
+    const int repetitions = int(std::max<std::size_t>(1, (64u << 20) / ws.bytes()));
+    const Timing t = benchmark([&] { kernel<FLOPs>(ws, offset, repetitions, flags); }, 3);
+    const double elements = double(repetitions) * M * ws.n;
+    const double bytes = elements * 4 * sizeof(typename V::EntryType);  // 3 loads + 1 store
+    const double flops = elements * FLOPs;
+    const Result r = {typeName<V>(),
+                      loads,
+                      level,
+                      ws.bytes(),
+                      FLOPs,
+                      flops / bytes,
+                      flops / t.seconds * 1e-9,
+                      bytes / t.seconds * 1e-9,
+                      flops / t.cycles};
+    std::fprintf(stderr,
+                 "%-6s %-9s %-4s %10zu B %7.3f FLOP/B %8.2f GFLOP/s %8.2f GB/s "
+                 "%6.2f FLOP/cycle\n",
+                 r.type, r.loads, r.level, r.workingSet, r.flopPerByte, r.gflops, r.gbytes,
+                 r.flopPerCycle);
+    results.push_back(r);
 }
-template<> inline float_v Flops<7>::operator()(float_v a, float_v b, float_v c)
+
+template <int... FLOPs> struct FlopsList {};
+
+template <typename V, typename Flags, int... FLOPs>
+static void sweepIntensity(std::vector<Result> &results, WorkingSet<V> &ws,
+                           const char *level, const char *loads, std::size_t offset,
+                           Flags flags, FlopsList<FLOPs...>)
 {
-    return (a * b + (a + c)) + (a * c - (b + c));
+    const int unused[] = {(measure<FLOPs>(results, ws, level, loads, offset, flags), 0)...};
+    (void)unused;
 }
-template<> inline float_v Flops<8>::operator()(float_v a, float_v b, float_v c)
+
+using Intensities = FlopsList<2, 4, 9, 19, 42, 94, 211>;
+
+template <typename V>
+static void run(std::vector<Result> &results, std::size_t bytes, const char *level)
 {
-    return (a * b + (a + c) + b) + (a * c - (b + c));
+    using T = typename V::EntryType;
+    const std::size_t n = std::max<std::size_t>(
+        V::Size, bytes / (M * sizeof(T)) / V::Size * V::Size);
+    WorkingSet<V> ws(n);
+    sweepIntensity(results, ws, level, "aligned", 0, Vc::Aligned, Intensities());
+    sweepIntensity(results, ws, level, "unaligned", 1, Vc::Unaligned, Intensities());
+    sweepIntensity(results, ws, level, "streaming", 0, Vc::Aligned | Vc::Streaming,
+                   Intensities());
 }
 
-/*
- * This is the benchmark code. It is called from Runner and uses Flops to do the work.
- */
-template<std::size_t _N, std::size_t M, int Repetitions, int FLOPs>
-struct ScaleWorkingSetSize
+struct Level {
+    const char *name;
+    std::size_t workingSet;
+};
+
+// Picks one working-set size per cache level: half of the cache, but at least twice the
+// previous level, so that the data does not fit into the faster cache.
+static std::vector<Level> cacheLevels()
 {
-    void operator()()
-    {
-        constexpr std::size_t N = _N / sizeof(float_v) + 3 * 16 / float_v::Size;
-        typedef std::array<std::array<float_v, N>, M> Cont;
-        auto data = Vc::make_unique<Cont, Vc::AlignOnPage>();
-        for (auto &arr : *data) {
-            for (auto &value : arr) {
-                value = float_v::Random();
-            }
+    using Vc::CpuId;
+    const std::size_t sizes[3] = {CpuId::L1Data(), CpuId::L2Data(), CpuId::L3Data()};
+    static const char *const names[3] = {"L1", "L2", "L3"};
+    std::vector<Level> levels;
+    std::size_t previous = 0;
+    for (int i = 0; i < 3; ++i) {
+        if (sizes[i] > previous) {
+            const std::size_t ws =
+                std::max(sizes[i] / 2, std::min(2 * previous, sizes[i] * 3 / 4));
+            levels.push_back({names[i], ws});
+            previous = sizes[i];
         }
+    }
+    // main memory: well beyond the last level cache
+    const std::size_t dram = std::max<std::size_t>(4 * previous, 64u << 20);
+    levels.push_back({"DRAM", std::min<std::size_t>(dram, 1u << 30)});
+    return levels;
+}
 
-        TimeStampCounter tsc;
-        double throughput = 0.;
-        for (std::size_t i = 0; i < 2 + 512 / N; ++i) {
-            tsc.start();
-            // ------------- start of the benchmarked code ---------------
-            for (int repetitions = 0; repetitions < Repetitions; ++repetitions) {
-                for (std::size_t m = 0; m < M; ++m) {
-                    for (std::size_t n = 0; n < N; ++n) {
-                        (*data)[m][n] = Flops<FLOPs>()((*data)[(m + 1) % M][n],
-                                (*data)[(m + 2) % M][n],
-                                (*data)[(m + 3) % M][n]);
-                    }
-                }
-            }
-            // -------------- end of the benchmarked code ----------------
-            tsc.stop();
+// Classifies an arbitrary working-set size for --sweep.
+static const char *levelName(std::size_t bytes)
+{
+    using Vc::CpuId;
+    if (bytes <= CpuId::L1Data()) {
+        return "L1";
+    } else if (bytes <= CpuId::L2Data()) {
+        return "L2";
+    } else if (bytes <= CpuId::L3Data()) {
+        return "L3";
+    }
+    return "DRAM";
+}
 
-            throughput = std::max(throughput, (Repetitions * M * N * float_v::Size * FLOPs) / static_cast<double>(tsc.cycles()));
+int Vc_CDECL main(int argc, char **argv)
+{
+    std::vector<Level> levels = cacheLevels();
+    if (argc > 1 && std::strcmp(argv[1], "--sweep") == 0) {
+        // all powers of two from 4 KiB up to the main memory size chosen above
+        const std::size_t largest = levels.back().workingSet;
+        levels.clear();
+        for (std::size_t bytes = 4096; bytes <= largest; bytes *= 2) {
+            levels.push_back({levelName(bytes), bytes});
         }
-
-        const long bytes = N * M * sizeof(float_v);
-        printf("%10lu Byte | %4.2f FLOP/Byte | %4.1f FLOP/cycle\n", bytes, static_cast<double>(float_v::Size * FLOPs) / (4 * sizeof(float_v)), throughput
-                );
+    } else if (argc > 1) {
+        std::fprintf(stderr, "Usage: %s [--sweep]\n\n"
+                             "Writes the roofline measurements as JSON to stdout. By default "
+                             "one working-set\nsize per cache level is measured, --sweep "
+                             "measures all powers of two instead.\n",
+                     argv[0]);
+        return 1;
     }
-};
 
-int Vc_CDECL main()
-{
-    ScaleWorkingSetSize<256, 4, 10, 2>()();
-    printf("%10s | %4s | %4s\n", "Working-Set Size", "FLOPs per Byte", "Throughput (FLOPs/Cycle)");
-    Runner<ScaleWorkingSetSize>::run();
+    std::vector<Result> results;
+    for (const Level &l : levels) {
+        run<Vc::float_v>(results, l.workingSet, l.name);
+        run<Vc::double_v>(results, l.workingSet, l.name);
+    }
+    printJson(results);
     return 0;
 }
+
+// vim: foldmethod=marker
@@ -0,0 +1,132 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/Vc>
+#include <algorithm>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../benchmark.h"
+
+// Compares the search algorithms of Vc/common/algorithms.h against their std:: counterparts.
+// All ranges start one element past an aligned address to exercise the unaligned head.
+
+using T = float;
+using Data = std::vector<T, Vc::Allocator<T>>;
+
+static void report(const char *name, std::size_t n, Timing std_t, Timing vc_t)
+{
+    std::cout << std::setw(14) << name << std::setw(10) << n << std::setw(14)
+              << std_t.cycles / n << std::setw(14) << vc_t.cycles / n << std::setw(10)
+              << std::setprecision(3) << std_t.cycles / vc_t.cycles << '\n';
+}
+
+template <typename A, typename B> static void check(const char *name, A a, B b)
+{
+    if (a != b) {
+        std::cerr << name << ": Vc and std results differ\n";
+        std::exit(1);
+    }
+}
+
+int Vc_CDECL main()
+{
+    std::cout << std::setw(14) << "algorithm" << std::setw(10) << "N" << std::setw(14)
+              << "std cyc/elem" << std::setw(14) << "Vc cyc/elem" << std::setw(10)
+              << "speedup" << '\n';
+
+    std::default_random_engine rne;
+    std::uniform_real_distribution<T> dist(-1000, 1000);
+    for (std::size_t N = 64; N <= (1u << 20); N *= 8) {
+        Data storage(N + 1);
+        for (auto &x : storage) {
+            x = dist(rne);
+        }
+        const auto first = storage.begin() + 1;
+        const auto last = storage.end();
+        const T missing = 2000;  // never found: every search runs over the whole range
+
+        check("find", Vc::find(first, last, missing), std::find(first, last, missing));
+        report("find", N, benchmark([&] { doNotOptimize(std::find(first, last, missing)); }),
+               benchmark([&] { doNotOptimize(Vc::find(first, last, missing)); }));
+
+        const auto bigStd = [](T x) { return x > 1500; };
+        const auto bigVc = [](auto x) { return x > 1500; };
+        check("find_if", Vc::find_if(first, last, bigVc), std::find_if(first, last, bigStd));
+        report("find_if", N,
+               benchmark([&] { doNotOptimize(std::find_if(first, last, bigStd)); }),
+               benchmark([&] { doNotOptimize(Vc::find_if(first, last, bigVc)); }));
+
+        const auto negStd = [](T x) { return x < 0; };
+        const auto negVc = [](auto x) { return x < 0; };
+        check("count_if", Vc::count_if(first, last, negVc),
+              std::count_if(first, last, negStd));
+        report("count_if", N,
+               benchmark([&] { doNotOptimize(std::count_if(first, last, negStd)); }),
+               benchmark([&] { doNotOptimize(Vc::count_if(first, last, negVc)); }));
+
+        Data copy = storage;
+        const auto first2 = copy.begin() + 1;
+        check("mismatch", Vc::mismatch(first, last, first2).first,
+              std::mismatch(first, last, first2).first);
+        report("mismatch", N,
+               benchmark([&] { doNotOptimize(std::mismatch(first, last, first2)); }),
+               benchmark([&] { doNotOptimize(Vc::mismatch(first, last, first2)); }));
+
+        check("min_element", Vc::min_element(first, last), std::min_element(first, last));
+        report("min_element", N,
+               benchmark([&] { doNotOptimize(std::min_element(first, last)); }),
+               benchmark([&] { doNotOptimize(Vc::min_element(first, last)); }));
+
+        // bounds: 1024 lookups of random keys in the sorted range
+        Data sorted = storage;
+        std::sort(sorted.begin() + 1, sorted.end());
+        std::vector<T> keys(1024);
+        for (auto &k : keys) {
+            k = dist(rne);
+        }
+        const auto sfirst = sorted.begin() + 1;
+        const auto slast = sorted.end();
+        for (T k : keys) {
+            check("lower_bound", Vc::lower_bound(sfirst, slast, k),
+                  std::lower_bound(sfirst, slast, k));
+        }
+        const auto stdBound = benchmark([&] {
+            for (T k : keys) {
+                doNotOptimize(std::lower_bound(sfirst, slast, k));
+            }
+        });
+        const auto vcBound = benchmark([&] {
+            for (T k : keys) {
+                doNotOptimize(Vc::lower_bound(sfirst, slast, k));
+            }
+        });
+        std::cout << std::setw(14) << "lower_bound" << std::setw(10) << N << std::setw(14)
+                  << stdBound.cycles / keys.size() << std::setw(14)
+                  << vcBound.cycles / keys.size() << std::setw(10)
+                  << stdBound.cycles / vcBound.cycles << "  (cycles per lookup)\n";
+    }
+    return 0;
+}
@@ -0,0 +1,120 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/stats>
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "../benchmark.h"
+
+// Compares the reductions of Vc::stats against the scalar code they replace, for working
+// sets in L1, in the last-level cache and in memory. Reports cycles per element for both
+// and the bandwidth of the Vc version in GB/s.
+
+template <typename T> using Data = std::vector<T, Vc::Allocator<T>>;
+
+template <typename T>
+static void report(const char *name, std::size_t n, int passes, Timing scalar, Timing vc)
+{
+    std::cout << std::setw(10) << name << std::setw(10) << n << std::setw(12)
+              << std::setprecision(3) << scalar.cycles / n << std::setw(12)
+              << vc.cycles / n << std::setw(10) << scalar.cycles / vc.cycles
+              << std::setw(10) << passes * n * sizeof(T) / vc.seconds * 1e-9 << '\n';
+}
+
+template <typename T> static void run(const char *type)
+{
+    std::cout << type << ":\n"
+              << std::setw(10) << "kernel" << std::setw(10) << "N" << std::setw(12)
+              << "scalar c/e" << std::setw(12) << "Vc c/e" << std::setw(10) << "speedup"
+              << std::setw(10) << "Vc GB/s" << '\n';
+    std::mt19937 rng(1);
+    std::normal_distribution<T> dist(100, 15);
+    for (std::size_t n : {std::size_t(4) << 10, std::size_t(256) << 10,
+                          std::size_t(16) << 20}) {
+        Data<T> data(n);
+        for (auto &x : data) {
+            x = dist(rng);
+        }
+        const auto first = data.begin(), last = data.end();
+        const int reps = n > (1u << 20) ? 3 : 20;
+
+        report<T>("sum", n, 1, benchmark([&] {
+                      doNotOptimize(std::accumulate(first, last, T()));
+                  }, reps),
+                  benchmark([&] { doNotOptimize(Vc::stats::sum(first, last)); }, reps));
+
+        // scalar Welford, the usual single-pass variance
+        report<T>("variance", n, 1, benchmark([&] {
+                      T mean = 0, m2 = 0;
+                      std::size_t count = 0;
+                      for (auto it = first; it != last; ++it) {
+                          const T delta = *it - mean;
+                          mean += delta / T(++count);
+                          m2 += delta * (*it - mean);
+                      }
+                      doNotOptimize(m2 / T(count));
+                  }, reps),
+                  benchmark([&] { doNotOptimize(Vc::stats::variance(first, last)); },
+                            reps));
+
+        report<T>("minmax", n, 1, benchmark([&] {
+                      doNotOptimize(std::minmax_element(first, last));
+                  }, reps),
+                  benchmark([&] { doNotOptimize(Vc::stats::minmax(first, last)); },
+                            reps));
+
+        report<T>("argmin", n, 1, benchmark([&] {
+                      doNotOptimize(std::min_element(first, last) - first);
+                  }, reps),
+                  benchmark([&] { doNotOptimize(Vc::stats::argmin(first, last)); },
+                            reps));
+
+        // exact quartiles by selection on a copy vs. the histogram estimate
+        const std::vector<double> p = {0.25, 0.5, 0.75};
+        Data<T> copy(n);
+        report<T>("quartiles", n, 2, benchmark([&] {
+                      std::copy(first, last, copy.begin());
+                      for (double q : p) {
+                          const auto k = copy.begin() + std::size_t(q * (n - 1));
+                          std::nth_element(copy.begin(), k, copy.end());
+                          doNotOptimize(*k);
+                      }
+                  }, reps),
+                  benchmark([&] { doNotOptimize(Vc::stats::quantiles(first, last, p)); },
+                            reps));
+    }
+}
+
+int Vc_CDECL main()
+{
+    std::cout << Vc::Vector<float>::Size << " floats and " << Vc::Vector<double>::Size
+              << " doubles per vector\n";
+    run<float>("float");
+    run<double>("double");
+    return 0;
+}
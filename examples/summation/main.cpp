@@ -0,0 +1,104 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/Allocator>
+#include <Vc/summation>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "../benchmark.h"
+
+// Sums and dot products of float data: plain float loops, the usual workaround of double
+// (or long double) accumulators, and Vc's pairwise and compensated variants. Reports
+// cycles per element and the relative error against a reference computed by
+// Vc::accurate_sum on the data converted to double.
+
+using Data = std::vector<float, Vc::Allocator<float>>;
+
+// Times f, which returns the result, and reports it against exact.
+template <typename F>
+static void report(const char *name, std::size_t n, int reps, F &&f, double exact)
+{
+    double result = 0;
+    const Timing t = benchmark([&] {
+        result = f();
+        doNotOptimize(result);
+    }, reps);
+    std::cout << std::setw(26) << name << std::setw(10) << n << std::setw(10)
+              << std::setprecision(3) << t.cycles / n << std::setw(12)
+              << std::abs(result - exact) / std::abs(exact) << '\n';
+}
+
+int Vc_CDECL main()
+{
+    std::cout << std::setw(26) << "kernel" << std::setw(10) << "N" << std::setw(10)
+              << "cyc/elem" << std::setw(12) << "rel. error" << '\n';
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> dist(0, 1);
+    for (std::size_t n : {std::size_t(1) << 16, std::size_t(1) << 24}) {
+        Data a(n), b(n);
+        std::vector<double> a64(n), products(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            a[i] = dist(rng);
+            b[i] = dist(rng) - 0.49f;
+            a64[i] = a[i];
+            products[i] = double(a[i]) * b[i];  // exact in double
+        }
+        const double exact = Vc::accurate_sum(a64);
+        const double exactDot = Vc::accurate_sum(products);
+        const int reps = n > (1u << 20) ? 3 : 20;
+        using V = Vc::float_v;
+        const auto first = a.begin(), last = a.end();
+
+        report("sum, float", n, reps, [&] { return std::accumulate(first, last, 0.f); },
+               exact);
+        report("sum, double accumulator", n, reps,
+               [&] { return std::accumulate(first, last, 0.); }, exact);
+        report("sum, long double", n, reps,
+               [&] { return double(std::accumulate(first, last, 0.L)); }, exact);
+        report("Vc::pairwise_sum", n, reps, [&] { return Vc::pairwise_sum(a); }, exact);
+        report("Vc::accurate_sum", n, reps, [&] { return Vc::accurate_sum(a); }, exact);
+        // a loop that sums a computed term: CompensatedAccumulator in place of a float_v
+        // accumulator
+        report("CompensatedAccumulator", n, reps, [&] {
+            Vc::CompensatedAccumulator<V> acc;
+            for (std::size_t i = 0; i < n; i += V::Size) {  // n is a power of 2
+                acc += V(&a[i], Vc::Aligned);
+            }
+            return acc.sum();
+        }, exact);
+
+        report("dot, float", n, reps,
+               [&] { return std::inner_product(first, last, b.begin(), 0.f); }, exactDot);
+        report("dot, double accumulator", n, reps,
+               [&] { return std::inner_product(first, last, b.begin(), 0.); }, exactDot);
+        report("Vc::pairwise_dot", n, reps, [&] { return Vc::pairwise_dot(a, b); },
+               exactDot);
+        report("Vc::accurate_dot", n, reps, [&] { return Vc::accurate_dot(a, b); },
+               exactDot);
+    }
+    return 0;
+}
@@ -0,0 +1,157 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <algorithm>
+#include <vector>
+
+using namespace Vc;
+
+// Every test runs on all subranges [offset, offset + n) of a vector, so that heads and
+// tails take every possible alignment.
+template <typename T> std::vector<T, Vc::Allocator<T>> searchData(std::size_t n)
+{
+    std::vector<T, Vc::Allocator<T>> data(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        data[i] = static_cast<T>((i * 37 + 11) % 101);
+    }
+    return data;
+}
+
+template <typename F> void forAllSubranges(std::size_t maxSize, F &&f)
+{
+    for (std::size_t offset = 0; offset < 9; ++offset) {
+        for (std::size_t n = 0; n < maxSize; n += n < 40 ? 1 : 17) {
+            f(offset, n);
+        }
+    }
+}
+
+TEST_TYPES(V, find, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    const auto data = searchData<T>(300);
+    forAllSubranges(290, [&](std::size_t offset, std::size_t n) {
+        const auto first = data.begin() + offset;
+        const auto last = first + n;
+        for (int value : {0, 11, 48, 100, 200}) {
+            COMPARE(Vc::find(first, last, value) - first,
+                    std::find(first, last, T(value)) - first)
+                << "offset: " << offset << ", n: " << n << ", value: " << value;
+        }
+        COMPARE(Vc::find_if(first, last, [](auto x) { return x > 90; }) - first,
+                std::find_if(first, last, [](T x) { return x > 90; }) - first)
+            << "offset: " << offset << ", n: " << n;
+    });
+}
+
+TEST_TYPES(V, countIf, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    const auto data = searchData<T>(300);
+    forAllSubranges(290, [&](std::size_t offset, std::size_t n) {
+        const auto first = data.begin() + offset;
+        const auto last = first + n;
+        COMPARE(Vc::count_if(first, last, [](auto x) { return x < 30; }),
+                std::count_if(first, last, [](T x) { return x < 30; }))
+            << "offset: " << offset << ", n: " << n;
+        COMPARE(Vc::count(first, last, 48), std::count(first, last, T(48)))
+            << "offset: " << offset << ", n: " << n;
+    });
+}
+
+TEST_TYPES(V, bounds, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    auto data = searchData<T>(300);
+    std::sort(data.begin(), data.end());
+    forAllSubranges(290, [&](std::size_t offset, std::size_t n) {
+        const auto first = data.begin() + offset;
+        const auto last = first + n;
+        for (int value = -1; value <= 102; value += 3) {
+            COMPARE(Vc::lower_bound(first, last, value) - first,
+                    std::lower_bound(first, last, T(value)) - first)
+                << "offset: " << offset << ", n: " << n << ", value: " << value;
+            COMPARE(Vc::upper_bound(first, last, value) - first,
+                    std::upper_bound(first, last, T(value)) - first)
+                << "offset: " << offset << ", n: " << n << ", value: " << value;
+        }
+    });
+}
+
+TEST_TYPES(V, mismatch, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    const auto data = searchData<T>(300);
+    forAllSubranges(290, [&](std::size_t offset, std::size_t n) {
+        auto copy = data;
+        const auto first = data.begin() + offset;
+        const auto last = first + n;
+        const auto first2 = copy.begin() + (offset + 3) % 9;
+        std::copy(first, last, first2);
+        COMPARE(Vc::mismatch(first, last, first2).first - first, std::ptrdiff_t(n));
+        for (std::size_t i = 0; i < n; i += 5) {
+            first2[i] += 1;
+            const auto r = Vc::mismatch(first, last, first2);
+            COMPARE(r.first - first, std::ptrdiff_t(i)) << "offset: " << offset
+                                                        << ", n: " << n;
+            COMPARE(r.second - first2, std::ptrdiff_t(i));
+            first2[i] -= 1;
+        }
+    });
+}
+
+TEST_TYPES(V, minMaxElement, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    auto data = searchData<T>(2000);
+    data[1500] = 200;  // a single maximum beyond the first block
+    forAllSubranges(1990, [&](std::size_t offset, std::size_t n) {
+        const auto first = data.begin() + offset;
+        const auto last = first + n;
+        COMPARE(Vc::min_element(first, last) - first, std::min_element(first, last) - first)
+            << "offset: " << offset << ", n: " << n;
+        COMPARE(Vc::max_element(first, last) - first, std::max_element(first, last) - first)
+            << "offset: " << offset << ", n: " << n;
+    });
+}
+
+TEST_TYPES(T, scalarFallback, vir::Typelist<long long, unsigned char>) //{{{1
+{
+    auto data = searchData<T>(100);
+    COMPARE(Vc::find(data.begin(), data.end(), 48) - data.begin(),
+            std::find(data.begin(), data.end(), T(48)) - data.begin());
+    COMPARE(Vc::count_if(data.begin(), data.end(), [](T x) { return x < 30; }),
+            std::count_if(data.begin(), data.end(), [](T x) { return x < 30; }));
+    COMPARE(Vc::max_element(data.begin(), data.end()) - data.begin(),
+            std::max_element(data.begin(), data.end()) - data.begin());
+    std::sort(data.begin(), data.end());
+    COMPARE(Vc::lower_bound(data.begin(), data.end(), 50) - data.begin(),
+            std::lower_bound(data.begin(), data.end(), T(50)) - data.begin());
+}
+
+// vim: foldmethod=marker
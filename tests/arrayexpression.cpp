@@ -0,0 +1,192 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/array_expression>
+#include <vector>
+
+using namespace Vc;
+
+// the sizes cover partial vectors and arrays with a remainder (Memory<V>(0) is invalid)
+static const std::size_t exprSizes[] = {1, 3, 4, 7, 8, 15, 16, 17, 31, 64, 100, 1023};
+
+template <typename T> T exprInput(std::size_t i, std::size_t k)
+{
+    return static_cast<T>((i * (2 * k + 3) + k) % 13 + 1);
+}
+
+template <typename V> void fill(Memory<V> &m, std::size_t k)
+{
+    for (std::size_t i = 0; i < m.entriesCount(); ++i) {
+        m[i] = exprInput<typename V::EntryType>(i, k);
+    }
+}
+
+TEST_TYPES(V, fusedArithmetic, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : exprSizes) {
+        Memory<V> a(n), b(n), c(n), d(n), e(n);
+        fill(b, 1);
+        fill(c, 2);
+        fill(d, 3);
+        fill(e, 4);
+        a = b * c + d * e;
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(b[i] * c[i] + d[i] * e[i])) << "n: " << n << ", i: " << i;
+        }
+        a = T(2) * b - c / d + T(1);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(T(2) * b[i] - c[i] / d[i] + T(1))) << "n: " << n << ", i: " << i;
+        }
+        a = Vc::min(b, c) + Vc::max(d, e) * -b;
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(std::min(b[i], c[i]) + std::max(d[i], e[i]) * T(-b[i])))
+                << "n: " << n << ", i: " << i;
+        }
+        a = fma(b, c, T(3));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(b[i] * c[i] + T(3))) << "n: " << n << ", i: " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, compoundAssignment, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : exprSizes) {
+        Memory<V> a(n), b(n), c(n), ref(n);
+        fill(a, 0);
+        fill(b, 1);
+        fill(c, 2);
+        ref = a;
+        a += b * c;
+        a -= b;
+        a *= c + T(1);
+        a /= make_expression(c);  // Memory /= Memory would also divide the padding
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(T(T(ref[i] + b[i] * c[i] - b[i]) * T(c[i] + 1)) / c[i]))
+                << "n: " << n << ", i: " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, maskedAssignment, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : exprSizes) {
+        Memory<V> a(n), b(n), c(n), ref(n);
+        fill(a, 0);
+        fill(b, 1);
+        fill(c, 2);
+        ref = a;
+        Vc::where(make_expression(b) > c, a) = b - c;
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], b[i] > c[i] ? T(b[i] - c[i]) : ref[i]) << "n: " << n << ", i: " << i;
+        }
+        Vc::where(make_expression(b) <= c && c > 5) | a += T(10);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], b[i] > c[i] ? T(b[i] - c[i]) : c[i] > 5 ? T(ref[i] + 10) : ref[i])
+                << "n: " << n << ", i: " << i;
+        }
+        a = iif(b < 4, b, c * T(2));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], b[i] < 4 ? b[i] : T(c[i] * 2)) << "n: " << n << ", i: " << i;
+        }
+        // comparing two Memory objects keeps its whole-array meaning
+        VERIFY(a == a);
+        a = iif(make_expression(b) == c, T(1), T(0));
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(b[i] == c[i] ? 1 : 0)) << "n: " << n << ", i: " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, spanOperands, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : exprSizes) {
+        // offset by one entry to force unaligned accesses
+        std::vector<T> x(n + 2), y(n + 2), out(n + 2, T(42));
+        for (std::size_t i = 0; i < n + 2; ++i) {
+            x[i] = exprInput<T>(i, 1);
+            y[i] = exprInput<T>(i, 2);
+        }
+        Memory<V> m(n);
+        fill(m, 3);
+        const span<const T> xs(&x[1], n), ys(&y[1], n);
+        Vc::assign(span<T>(&out[1], n), xs * m + ys / xs);
+        COMPARE(out[0], T(42));
+        COMPARE(out[n + 1], T(42)) << "n: " << n;
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i + 1], T(x[i + 1] * m[i] + y[i + 1] / x[i + 1]))
+                << "n: " << n << ", i: " << i;
+        }
+        m = xs;
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(m[i], x[i + 1]) << "n: " << n << ", i: " << i;
+        }
+        Vc::assign(span<T>(&out[1], 0), span<const T>(&x[1], 0) * T(2));
+        span<T> outs(&out[1], n);
+        Vc::where(ys > xs, outs) = T(7);
+        COMPARE(out[n + 1], T(42)) << "n: " << n;
+        for (std::size_t i = 0; i < n; ++i) {
+            if (y[i + 1] > x[i + 1]) {
+                COMPARE(out[i + 1], T(7)) << "n: " << n << ", i: " << i;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, parallelAssign, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : {std::size_t(1000), std::size_t(300001)}) {
+        Memory<V> a(n), b(n), c(n);
+        fill(b, 1);
+        fill(c, 2);
+        Vc::parallel_assign(a, b * c + b, 4);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(a[i], T(b[i] * c[i] + b[i])) << "n: " << n << ", i: " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, fixedSizeMemory, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    Memory<V, 37> a, b;
+    for (std::size_t i = 0; i < b.entriesCount(); ++i) {
+        b[i] = exprInput<T>(i, 5);
+    }
+    a = b * b - b;
+    for (std::size_t i = 0; i < a.entriesCount(); ++i) {
+        COMPARE(a[i], T(b[i] * b[i] - b[i])) << "i: " << i;
+    }
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,205 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/biquad>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Vc;
+
+using BankTypes = vir::concat<RealVectors, RealSimdArrays<3>, RealSimdArrays<16>>;
+
+// A straightforward scalar cascade for one channel, in double precision.
+struct ReferenceCascade {
+    struct Section {
+        biquad_coefficients<double> c;
+        double z1 = 0, z2 = 0;
+    };
+    std::vector<Section> sections;
+
+    double operator()(double x)
+    {
+        for (auto &s : sections) {
+            const double y = s.c.b0 * x + s.z1;
+            s.z1 = s.c.b1 * x - s.c.a1 * y + s.z2;
+            s.z2 = s.c.b2 * x - s.c.a2 * y;
+            x = y;
+        }
+        return x;
+    }
+};
+
+template <typename T> static biquad_coefficients<double> widen(biquad_coefficients<T> c)
+{
+    biquad_coefficients<double> r;
+    r.b0 = c.b0;
+    r.b1 = c.b1;
+    r.b2 = c.b2;
+    r.a1 = c.a1;
+    r.a2 = c.a2;
+    return r;
+}
+
+// Sets random low- and high-passes on all sections and channels of bank and refs.
+template <typename Bank>
+static void randomize(Bank &bank, std::vector<ReferenceCascade> &refs, std::mt19937 &rng)
+{
+    using T = typename Bank::value_type;
+    std::uniform_real_distribution<T> frequency(T(0.01), T(0.4));
+    refs.resize(bank.channels());
+    for (std::size_t c = 0; c < bank.channels(); ++c) {
+        refs[c].sections.resize(bank.sections());
+        for (std::size_t s = 0; s < bank.sections(); ++s) {
+            const auto coeffs = (c + s) % 2 == 0
+                                    ? biquad_coefficients<T>::lowpass(frequency(rng))
+                                    : biquad_coefficients<T>::highpass(frequency(rng));
+            bank.set(s, c, coeffs);
+            refs[c].sections[s].c = widen(coeffs);
+        }
+    }
+}
+
+template <typename T> static T tolerance()
+{
+    return std::is_same<T, float>::value ? T(2e-4) : T(1e-11);
+}
+
+TEST_TYPES(V, interleaved, BankTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t C = V::Size;
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<T> dist(-1, 1);
+    for (std::size_t sections : {1u, 3u, 7u}) {
+        biquad_bank<V> bank(sections);
+        COMPARE(bank.sections(), sections);
+        COMPARE(bank.channels(), C);
+        std::vector<ReferenceCascade> refs;
+        randomize(bank, refs, rng);
+        // two extra channels around the bank's to check the stride
+        const std::size_t frames = 1000, stride = C + 2;
+        std::vector<T> data(frames * stride);
+        for (auto &x : data) {
+            x = dist(rng);
+        }
+        std::vector<T> out = data;
+        // chunks shorter than the section pipelines, too
+        const std::size_t chunks[] = {1, 2, 3, 300};
+        for (std::size_t f = 0, i = 0; f < frames; ++i) {
+            const std::size_t n = std::min(chunks[i % 4], frames - f);
+            bank.process(data.data() + 1 + f * stride, out.data() + 1 + f * stride, n,
+                         stride);
+            f += n;
+        }
+        for (std::size_t f = 0; f < frames; ++f) {
+            COMPARE(out[f * stride], data[f * stride]);
+            COMPARE(out[f * stride + C + 1], data[f * stride + C + 1]);
+            for (std::size_t c = 0; c < C; ++c) {
+                const double expected = refs[c](data[f * stride + 1 + c]);
+                const double err = std::abs(out[f * stride + 1 + c] - expected);
+                VERIFY(err <= tolerance<T>() * (1 + std::abs(expected)))
+                    << "frame " << f << ", channel " << c << ": " << err;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, planarAndFrames, BankTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t C = V::Size;
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<T> dist(-1, 1);
+    biquad_bank<V> planar(2), single(2);
+    std::vector<ReferenceCascade> refs;
+    randomize(planar, refs, rng);
+    for (std::size_t s = 0; s < 2; ++s) {
+        for (std::size_t c = 0; c < C; ++c) {
+            single.set(s, c, planar.get(s, c));
+        }
+    }
+    const std::size_t frames = 3 * 64 + 5;
+    std::vector<std::vector<T>> channels(C, std::vector<T>(frames));
+    std::vector<T *> pointers;
+    for (auto &ch : channels) {
+        for (auto &x : ch) {
+            x = dist(rng);
+        }
+        pointers.push_back(ch.data());
+    }
+    const auto input = channels;
+    planar.process(pointers.data(), pointers.data(), frames);  // in place
+    for (std::size_t f = 0; f < frames; ++f) {
+        const V y = single.process(V([&](std::size_t c) { return input[c][f]; }));
+        for (std::size_t c = 0; c < C; ++c) {
+            COMPARE(channels[c][f], y[c]) << "frame " << f << ", channel " << c;
+        }
+    }
+}
+
+TEST_TYPES(V, updatesAndReset, BankTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    constexpr std::size_t C = V::Size;
+    biquad_bank<V> bank(1);
+    // identity until set
+    const V x([](int i) { return T(i + 1); });
+    VERIFY(all_of(bank.process(x) == x));
+
+    // a one-pole smoother y = x/2 + y'/2 on channel 0 only, then an impulse
+    biquad_coefficients<T> smooth;
+    smooth.b0 = T(0.5);
+    smooth.a1 = T(-0.5);
+    bank.set(0, 0, smooth);
+    COMPARE(bank.get(0, 0).a1, T(-0.5));
+    if (C > 1) {
+        COMPARE(bank.get(0, C - 1).b0, T(1));
+    }
+    V y = bank.process(V(1));
+    COMPARE(y[0], T(0.5));
+    y = bank.process(V(0));
+    COMPARE(y[0], T(0.25));
+    if (C > 1) {
+        COMPARE(y[1], T(0));
+    }
+    // the state survives a coefficient change of the same channel
+    smooth.b0 = 0;
+    bank.set(0, 0, smooth);
+    y = bank.process(V(0));
+    COMPARE(y[0], T(0.125));
+    bank.reset(0);
+    y = bank.process(V(0));
+    COMPARE(y[0], T(0));
+    bank.set(0, biquad_coefficients<T>::identity());
+    bank.reset();
+    VERIFY(all_of(bank.process(x) == x));
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,151 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/bitmap>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace Vc;
+
+static std::vector<std::uint64_t> randomBitmap(std::size_t n, std::mt19937_64 &rng,
+                                               int density)
+{
+    std::vector<std::uint64_t> bits(bitmap::words(n));
+    for (auto &w : bits) {
+        w = rng();
+        for (int i = 1; i < density; ++i) {
+            w &= rng();
+        }
+    }
+    if (n % 64 != 0) {
+        bits.back() &= (std::uint64_t(1) << (n % 64)) - 1;
+    }
+    return bits;
+}
+
+static bool bitAt(const std::vector<std::uint64_t> &bits, std::size_t i)
+{
+    return (bits[i / 64] >> (i % 64)) & 1;
+}
+
+TEST(combine) //{{{1
+{
+    std::mt19937_64 rng(1);
+    for (std::size_t n : {0, 1, 63, 64, 65, 127, 128, 500, 1000, 4096, 4097}) {
+        const auto a = randomBitmap(n, rng, 1);
+        const auto b = randomBitmap(n, rng, 2);
+        std::vector<std::uint64_t> andBits(a.size()), orBits(a.size()),
+            andNotBits(a.size());
+        bitmap::bit_and(a.data(), b.data(), andBits.data(), n);
+        bitmap::bit_or(a.data(), b.data(), orBits.data(), n);
+        bitmap::bit_andnot(a.data(), b.data(), andNotBits.data(), n);
+        std::size_t ones = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(bitAt(andBits, i), bitAt(a, i) && bitAt(b, i)) << i;
+            COMPARE(bitAt(orBits, i), bitAt(a, i) || bitAt(b, i)) << i;
+            COMPARE(bitAt(andNotBits, i), bitAt(a, i) && !bitAt(b, i)) << i;
+            ones += bitAt(a, i);
+        }
+        COMPARE(bitmap::popcount(a.data(), n), ones) << n;
+
+        // in place
+        auto c = a;
+        bitmap::bit_and(c.data(), b.data(), c.data(), n);
+        VERIFY(c == andBits);
+    }
+}
+
+TEST(popcountIgnoresTail) //{{{1
+{
+    const std::uint64_t bits[2] = {~std::uint64_t(0), ~std::uint64_t(0)};
+    COMPARE(bitmap::popcount(bits, 0), 0u);
+    COMPARE(bitmap::popcount(bits, 5), 5u);
+    COMPARE(bitmap::popcount(bits, 64), 64u);
+    COMPARE(bitmap::popcount(bits, 100), 100u);
+}
+
+TEST(selection) //{{{1
+{
+    std::mt19937_64 rng(2);
+    for (int density : {1, 3, 8}) {
+        for (std::size_t n : {0, 1, 7, 8, 9, 63, 64, 65, 1000, 4099}) {
+            const auto bits = randomBitmap(n, rng, density);
+            std::vector<uint> expected;
+            for (std::size_t i = 0; i < n; ++i) {
+                if (bitAt(bits, i)) {
+                    expected.push_back(uint(i));
+                }
+            }
+
+            std::vector<uint> visited;
+            bitmap::for_each(bits.data(), n,
+                             [&](std::size_t i) { visited.push_back(uint(i)); });
+            VERIFY(visited == expected) << n;
+
+            // a guard entry past the end must survive
+            std::vector<uint> selection(n + 1, 0xdeadbeef);
+            const std::size_t count =
+                bitmap::to_selection(bits.data(), n, selection.data());
+            COMPARE(count, expected.size()) << n;
+            COMPARE(selection[n], 0xdeadbeefu) << n;
+            selection.resize(count);
+            VERIFY(selection == expected) << n;
+        }
+    }
+}
+
+TEST_TYPES(V, predicates, concat<AllVectors, SimdArrays<16>, OddSimdArrays<31>>) //{{{1
+{
+    // evaluate a predicate at unaligned offsets and combine it with another bitmap
+    using T = typename V::EntryType;
+    const std::size_t n = 5 * V::Size + 3;
+    std::vector<T> data(n + V::Size);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = T(i % 7);
+    }
+    std::vector<std::uint64_t> bits(bitmap::words(n) + 1, 0);
+    std::size_t i = 0;
+    for (; i + V::Size <= n; i += V::Size) {
+        (V(&data[i], Vc::Unaligned) < T(3)).storeBits(bits.data(), i);
+    }
+    for (; i < n; ++i) {
+        bits[i / 64] |= std::uint64_t(data[i] < T(3)) << (i % 64);
+    }
+    std::vector<uint> selection(n);
+    selection.resize(bitmap::to_selection(bits.data(), n, selection.data()));
+    COMPARE(selection.size(), bitmap::popcount(bits.data(), n));
+    for (uint k : selection) {
+        VERIFY(data[k] < T(3)) << k;
+    }
+    for (std::size_t j = 0; j + V::Size <= n; j += V::Size) {
+        COMPARE(V::Mask::fromBits(bits.data(), j), V(&data[j], Vc::Unaligned) < T(3));
+    }
+}
+
+// vim: foldmethod=marker
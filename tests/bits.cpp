@@ -0,0 +1,144 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/bit>
+
+using namespace Vc;
+
+template <typename V, typename F>  //{{{1
+void compareWithScalar(const V &x, const V &result, F &&f)
+{
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        COMPARE(result[i], f(x[i])) << "x = " << x << ", i = " << i;
+    }
+}
+
+template <typename V, typename F> void forRandomInputs(F &&f) //{{{1
+{
+    using T = typename V::EntryType;
+    f(V::Zero());
+    f(V(T(~T(0))));
+    f(V::IndexesFromZero());
+    f(V(T(1)) << (V::IndexesFromZero() & V(T(8 * sizeof(T) - 1))));
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        V x = V::Random();
+        // shift some entries right so that all leading-zero counts show up
+        x >>= V::IndexesFromZero() & V(T(8 * sizeof(T) - 1));
+        f(x);
+    }
+}
+
+template <typename T> using U = typename std::make_unsigned<T>::type;
+
+TEST_TYPES(V, popcount, IntVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    forRandomInputs<V>([](const V &x) {
+        compareWithScalar(x, Vc::popcount(x), [](T a) {
+            T n = 0;
+            for (U<T> u = a; u != 0; u &= u - 1) {
+                ++n;
+            }
+            return n;
+        });
+    });
+}
+
+TEST_TYPES(V, countZeros, IntVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    constexpr int Bits = 8 * sizeof(T);
+    forRandomInputs<V>([](const V &x) {
+        compareWithScalar(x, Vc::countl_zero(x), [](T a) {
+            int n = 0;
+            while (n < Bits && (U<T>(a) & (U<T>(1) << (Bits - 1 - n))) == 0) {
+                ++n;
+            }
+            return T(n);
+        });
+        compareWithScalar(x, Vc::countr_zero(x), [](T a) {
+            int n = 0;
+            while (n < Bits && (U<T>(a) & (U<T>(1) << n)) == 0) {
+                ++n;
+            }
+            return T(n);
+        });
+    });
+}
+
+TEST_TYPES(V, rotate, IntVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    constexpr int Bits = 8 * sizeof(T);
+    forRandomInputs<V>([](const V &x) {
+        for (int s = -Bits - 1; s <= Bits + 1; ++s) {
+            const auto rotl = [s](T a) {
+                const int r = ((s % Bits) + Bits) % Bits;
+                const U<T> u = a;
+                return T(r == 0 ? u : U<T>((u << r) | (u >> (Bits - r))));
+            };
+            compareWithScalar(x, Vc::rotl(x, s), rotl);
+            COMPARE(Vc::rotr(x, s), Vc::rotl(x, -s)) << "s = " << s;
+            COMPARE(Vc::rotr(Vc::rotl(x, s), s), x) << "s = " << s;
+        }
+    });
+}
+
+TEST_TYPES(V, byteswap, IntVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    forRandomInputs<V>([](const V &x) {
+        compareWithScalar(x, Vc::byteswap(x), [](T a) {
+            U<T> u = a, r = 0;
+            for (std::size_t i = 0; i < sizeof(T); ++i, u >>= 8) {
+                r = U<T>((r << 8) | (u & 0xff));
+            }
+            return T(r);
+        });
+        COMPARE(Vc::byteswap(Vc::byteswap(x)), x);
+    });
+}
+
+TEST_TYPES(V, bitReverse, IntVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    forRandomInputs<V>([](const V &x) {
+        compareWithScalar(x, Vc::bit_reverse(x), [](T a) {
+            U<T> u = a, r = 0;
+            for (std::size_t i = 0; i < 8 * sizeof(T); ++i, u >>= 1) {
+                r = U<T>((r << 1) | (u & 1));
+            }
+            return T(r);
+        });
+        COMPARE(Vc::bit_reverse(Vc::bit_reverse(x)), x);
+        COMPARE(Vc::popcount(Vc::bit_reverse(x)), Vc::popcount(x));
+        COMPARE(Vc::countr_zero(Vc::bit_reverse(x)), Vc::countl_zero(x));
+    });
+}
+
+// vim: foldmethod=marker
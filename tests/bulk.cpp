@@ -0,0 +1,145 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/algorithm>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace Vc;
+
+// the sizes cover empty ranges, partial vectors, and several cachelines
+static const std::size_t bulkSizes[] = {0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 64, 100, 1023};
+// 0 forces the streaming code path, SIZE_MAX disables it
+static const std::size_t thresholds[] = {0, std::numeric_limits<std::size_t>::max()};
+
+template <typename T> T bulkValue(std::size_t i) { return static_cast<T>((i * 7 + 3) % 101); }
+
+TEST_TYPES(V, copy, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    const std::size_t defaultThreshold = streaming_threshold();
+    VERIFY(defaultThreshold > 0);
+    for (std::size_t threshold : thresholds) {
+        set_streaming_threshold(threshold);
+        for (std::size_t n : bulkSizes) {
+            // the offsets misalign source and destination independently
+            for (std::size_t srcOffset : {0, 1, 3}) {
+                for (std::size_t dstOffset : {0, 1, 2}) {
+                    std::vector<T> src(n + srcOffset);
+                    for (std::size_t i = 0; i < n; ++i) {
+                        src[i + srcOffset] = bulkValue<T>(i);
+                    }
+                    Vc::Memory<V> dst(n + dstOffset + 1);
+                    dst.setZero();
+                    dst[n + dstOffset] = T(42);
+                    Vc::copy(src.data() + srcOffset, &dst[dstOffset], n);
+                    for (std::size_t i = 0; i < dstOffset; ++i) {
+                        COMPARE(dst[i], T(0));
+                    }
+                    for (std::size_t i = 0; i < n; ++i) {
+                        COMPARE(dst[i + dstOffset], bulkValue<T>(i))
+                            << "n: " << n << ", i: " << i << ", threshold: " << threshold;
+                    }
+                    COMPARE(dst[n + dstOffset], T(42));
+                }
+            }
+        }
+    }
+    set_streaming_threshold(defaultThreshold);
+}
+
+TEST_TYPES(V, fill, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    const std::size_t defaultThreshold = streaming_threshold();
+    for (std::size_t threshold : thresholds) {
+        set_streaming_threshold(threshold);
+        for (std::size_t n : bulkSizes) {
+            for (std::size_t offset : {0, 1, 2}) {
+                Vc::Memory<V> dst(n + offset + 1);
+                dst.setZero();
+                Vc::fill(&dst[offset], n, 7);
+                for (std::size_t i = 0; i < n + offset + 1; ++i) {
+                    const bool inside = i >= offset && i < n + offset;
+                    COMPARE(dst[i], inside ? T(7) : T(0)) << "n: " << n << ", i: " << i;
+                }
+            }
+        }
+    }
+    set_streaming_threshold(defaultThreshold);
+
+    // types without Vc::Vector use a scalar loop
+    std::vector<long long> ll(17);
+    Vc::fill(ll.data(), ll.size(), 5);
+    for (long long x : ll) {
+        COMPARE(x, 5ll);
+    }
+}
+
+template <typename To, typename From> void testConvert() //{{{1
+{
+    for (std::size_t threshold : thresholds) {
+        set_streaming_threshold(threshold);
+        for (std::size_t n : bulkSizes) {
+            for (std::size_t offset : {0, 1}) {
+                std::vector<From> src(n);
+                for (std::size_t i = 0; i < n; ++i) {
+                    src[i] = bulkValue<From>(i);
+                }
+                std::vector<To> dst(n + offset + 1, To(0));
+                dst[n + offset] = To(42);
+                Vc::convert(src.data(), dst.data() + offset, n);
+                for (std::size_t i = 0; i < n; ++i) {
+                    COMPARE(dst[i + offset], static_cast<To>(src[i]))
+                        << "n: " << n << ", i: " << i;
+                }
+                COMPARE(dst[n + offset], To(42));
+            }
+        }
+    }
+}
+
+TEST(convert)
+{
+    const std::size_t defaultThreshold = streaming_threshold();
+    testConvert<float, double>();
+    testConvert<double, float>();
+    testConvert<float, int>();
+    testConvert<int, float>();
+    testConvert<int, double>();
+    testConvert<double, int>();
+    testConvert<short, int>();
+    testConvert<int, short>();
+    testConvert<float, unsigned short>();
+    testConvert<short, float>();
+    testConvert<long long, int>();
+    set_streaming_threshold(defaultThreshold);
+}
+
+// vim: foldmethod=marker
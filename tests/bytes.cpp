@@ -0,0 +1,225 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/bytes>
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// The kernels work on whole blocks and finish with a scalar tail, therefore every test
+// runs on all subranges [offset, offset + n) of its input.
+template <typename F> void forAllSubranges(const std::string &data, F &&f)
+{
+    for (std::size_t offset = 0; offset < 33 && offset <= data.size(); ++offset) {
+        for (std::size_t n = 0; offset + n <= data.size(); n += n < 130 ? 1 : 29) {
+            f(data.data() + offset, data.data() + offset + n);
+        }
+    }
+}
+
+std::string textData()
+{
+    std::string s;
+    for (int i = 0; i < 300; ++i) {
+        s += "a,B\"c\n{}[]:x"[(i * 7 + i / 13) % 13];
+    }
+    s[150] = '\0';
+    s[151] = '\xe9';
+    return s;
+}
+
+TEST(find) //{{{1
+{
+    const auto data = textData();
+    forAllSubranges(data, [&](const char *first, const char *last) {
+        for (char c : {'a', ',', '\n', '\0', '\xe9', 'Q'}) {
+            COMPARE(Vc::bytes::find(first, last, c) - first,
+                    std::find(first, last, c) - first)
+                << "n: " << last - first << ", c: " << int(c);
+        }
+    });
+}
+
+TEST(findFirstOf) //{{{1
+{
+    const auto data = textData();
+    for (const auto &chars : {std::string(",\n"), std::string("{}[]:,\"\\"),
+                              std::string("Q"), std::string("\0\xe9", 2)}) {
+        const Vc::bytes::byte_set set(chars.data(), chars.size());
+        forAllSubranges(data, [&](const char *first, const char *last) {
+            COMPARE(Vc::bytes::find_first_of(first, last, set) - first,
+                    std::find_first_of(first, last, chars.begin(), chars.end()) - first)
+                << "n: " << last - first << ", set: " << chars;
+        });
+    }
+}
+
+TEST(byteSet) //{{{1
+{
+    const Vc::bytes::byte_set set("abcabc");
+    COMPARE(set.size(), 3u);
+    VERIFY(set.contains('b'));
+    VERIFY(!set.contains('d'));
+    VERIFY(!set.contains('\0'));
+    const Vc::bytes::byte_set full("0123456789abcdef");
+    COMPARE(full.size(), 16u);
+    VERIFY(full.contains('f'));
+    VERIFY(full.is_small());
+}
+
+TEST(largeByteSet) //{{{1
+{
+    // more members than byte_set::Capacity: the kernels fall back to the table lookup
+    const std::string chars = "{}[]:,\"\\ \t\r\n;|0123456789aeQ";
+    const Vc::bytes::byte_set set(chars.data(), chars.size());
+    COMPARE(set.size(), chars.size());
+    VERIFY(!set.is_small());
+    for (char c : chars) {
+        VERIFY(set.contains(c)) << int(c);
+    }
+    VERIFY(!set.contains('x'));
+    const auto data = textData();
+    forAllSubranges(data, [&](const char *first, const char *last) {
+        const std::size_t n = last - first;
+        COMPARE(Vc::bytes::find_first_of(first, last, set) - first,
+                std::find_first_of(first, last, chars.begin(), chars.end()) - first)
+            << "n: " << n;
+        std::vector<std::uint64_t> bits((n + 63) / 64, ~std::uint64_t());
+        Vc::bytes::match_bits(first, last, set, bits.data());
+        std::vector<std::uint64_t> reference((n + 63) / 64, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (chars.find(first[i]) != std::string::npos) {
+                reference[i / 64] |= std::uint64_t(1) << (i % 64);
+            }
+        }
+        for (std::size_t i = 0; i < bits.size(); ++i) {
+            COMPARE(bits[i], reference[i]) << "n: " << n << ", word: " << i;
+        }
+    });
+}
+
+TEST(count) //{{{1
+{
+    const auto data = textData();
+    forAllSubranges(data, [&](const char *first, const char *last) {
+        for (char c : {'a', '\n', '\0', 'Q'}) {
+            COMPARE(Vc::bytes::count(first, last, c), std::size_t(std::count(first, last, c)))
+                << "n: " << last - first << ", c: " << int(c);
+        }
+    });
+    // more than 255 blocks, so that the byte counters must be flushed
+    const std::string newlines(100000, '\n');
+    COMPARE(Vc::bytes::count(newlines.data(), newlines.data() + newlines.size(), '\n'),
+            newlines.size());
+}
+
+TEST(matchBits) //{{{1
+{
+    const auto data = textData();
+    const Vc::bytes::byte_set set("{}[]:,\"");
+    forAllSubranges(data, [&](const char *first, const char *last) {
+        const std::size_t n = last - first;
+        std::vector<std::uint64_t> bits((n + 63) / 64, ~std::uint64_t());
+        Vc::bytes::match_bits(first, last, set, bits.data());
+        std::vector<std::uint64_t> reference((n + 63) / 64, 0);
+        for (std::size_t i = 0; i < n; ++i) {
+            if (std::strchr("{}[]:,\"", first[i]) && first[i] != '\0') {
+                reference[i / 64] |= std::uint64_t(1) << (i % 64);
+            }
+        }
+        for (std::size_t i = 0; i < bits.size(); ++i) {
+            COMPARE(bits[i], reference[i]) << "n: " << n << ", word: " << i;
+        }
+    });
+}
+
+TEST(validateUtf8) //{{{1
+{
+    const std::string ascii(200, 'x');
+    const std::vector<std::string> valid = {
+        "\xc3\xa9", "\xe2\x82\xac", "\xf0\x9f\x98\x80", "\xed\x9f\xbf", "\xf4\x8f\xbf\xbf",
+        "\xc2\x80", "\xe0\xa0\x80", "\xf0\x90\x80\x80", "\xef\xbf\xbf"};
+    const std::vector<std::string> invalid = {
+        "\x80",          // lone continuation byte
+        "\xc0\xaf",      // overlong
+        "\xc1\xbf",      // overlong
+        "\xe0\x9f\xbf",  // overlong
+        "\xf0\x8f\xbf\xbf",  // overlong
+        "\xed\xa0\x80",  // surrogate
+        "\xf4\x90\x80\x80",  // > U+10FFFF
+        "\xf5\x80\x80\x80",
+        "\xff",
+        "\xc3",          // truncated
+        "\xe2\x82",
+        "\xe2\x28\xa1",  // bad continuation
+        "\xf0\x9f\x98\x28"};
+    for (std::size_t pos : {0u, 1u, 15u, 16u, 31u, 32u, 63u, 100u, 199u}) {
+        for (const auto &seq : valid) {
+            std::string s = ascii;
+            s.insert(pos, seq);
+            VERIFY(Vc::bytes::validate_utf8(s.data(), s.data() + s.size()))
+                << "pos: " << pos << ", length: " << seq.size();
+            s.insert(pos + seq.size(), seq);
+            VERIFY(Vc::bytes::validate_utf8(s.data(), s.data() + s.size()));
+        }
+        for (const auto &seq : invalid) {
+            std::string s = ascii;
+            s.insert(pos, seq);
+            VERIFY(!Vc::bytes::validate_utf8(s.data(), s.data() + s.size()))
+                << "pos: " << pos << ", length: " << seq.size();
+            s.resize(pos + seq.size());
+            VERIFY(!Vc::bytes::validate_utf8(s.data(), s.data() + s.size()));
+        }
+    }
+    VERIFY(Vc::bytes::validate_utf8(ascii.data(), ascii.data()));
+}
+
+TEST(convertCase) //{{{1
+{
+    std::string data;
+    for (int i = 0; i < 300; ++i) {
+        data += char(i * 3);
+    }
+    forAllSubranges(data, [&](const char *first, const char *last) {
+        const std::size_t n = last - first;
+        std::string lower(n, '\0'), upper(n, '\0');
+        Vc::bytes::to_lower(first, last, &lower[0]);
+        Vc::bytes::to_upper(first, last, &upper[0]);
+        for (std::size_t i = 0; i < n; ++i) {
+            const char c = first[i];
+            COMPARE(lower[i], c >= 'A' && c <= 'Z' ? char(c + 32) : c) << "i: " << i;
+            COMPARE(upper[i], c >= 'a' && c <= 'z' ? char(c - 32) : c) << "i: " << i;
+        }
+    });
+    std::string inPlace = "Hello, World! 0123456789 abcdefghijklmnopqrstuvwxyz";
+    Vc::bytes::to_upper(inPlace.data(), inPlace.data() + inPlace.size(), &inPlace[0]);
+    COMPARE(inPlace, std::string("HELLO, WORLD! 0123456789 ABCDEFGHIJKLMNOPQRSTUVWXYZ"));
+}
+
+// vim: foldmethod=marker
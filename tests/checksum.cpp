@@ -0,0 +1,215 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/checksum>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace Vc;
+
+// reference implementations{{{1
+static std::uint32_t crc32cReference(const unsigned char *p, std::size_t n,
+                                     std::uint32_t crc)
+{
+    crc = ~crc;
+    for (std::size_t i = 0; i < n; ++i) {
+        crc ^= p[i];
+        for (int b = 0; b < 8; ++b) {
+            crc = (crc >> 1) ^ (0x82f63b78u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+static std::uint32_t adler32Reference(const unsigned char *p, std::size_t n,
+                                      std::uint32_t adler)
+{
+    std::uint32_t a = adler & 0xffff, b = adler >> 16;
+    for (std::size_t i = 0; i < n; ++i) {
+        a = (a + p[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    return b << 16 | a;
+}
+
+// XXH64 as in the xxHash specification, reading the input byte by byte
+static std::uint64_t xxh64Read(const unsigned char *p, int bytes)
+{
+    std::uint64_t x = 0;
+    for (int i = bytes - 1; i >= 0; --i) {
+        x = x << 8 | p[i];
+    }
+    return x;
+}
+
+static std::uint64_t xxh64Rotl(std::uint64_t x, int r) { return x << r | x >> (64 - r); }
+
+static std::uint64_t xxh64Round(std::uint64_t acc, std::uint64_t input)
+{
+    return xxh64Rotl(acc + input * 0xc2b2ae3d27d4eb4full, 31) * 0x9e3779b185ebca87ull;
+}
+
+static std::uint64_t xxh64Reference(const unsigned char *p, std::size_t n,
+                                    std::uint64_t seed)
+{
+    const std::uint64_t P1 = 0x9e3779b185ebca87ull, P2 = 0xc2b2ae3d27d4eb4full,
+                        P3 = 0x165667b19e3779f9ull, P4 = 0x85ebca77c2b2ae63ull,
+                        P5 = 0x27d4eb2f165667c5ull;
+    const unsigned char *const end = p + n;
+    std::uint64_t h;
+    if (n >= 32) {
+        std::uint64_t v[4] = {seed + P1 + P2, seed + P2, seed, seed - P1};
+        for (; end - p >= 32; p += 32) {
+            for (int i = 0; i < 4; ++i) {
+                v[i] = xxh64Round(v[i], xxh64Read(p + 8 * i, 8));
+            }
+        }
+        h = xxh64Rotl(v[0], 1) + xxh64Rotl(v[1], 7) + xxh64Rotl(v[2], 12) +
+            xxh64Rotl(v[3], 18);
+        for (int i = 0; i < 4; ++i) {
+            h = (h ^ xxh64Round(0, v[i])) * P1 + P4;
+        }
+    } else {
+        h = seed + P5;
+    }
+    h += n;
+    for (; end - p >= 8; p += 8) {
+        h = xxh64Rotl(h ^ xxh64Round(0, xxh64Read(p, 8)), 27) * P1 + P4;
+    }
+    if (end - p >= 4) {
+        h = xxh64Rotl(h ^ xxh64Read(p, 4) * P1, 23) * P2 + P3;
+        p += 4;
+    }
+    for (; p != end; ++p) {
+        h = xxh64Rotl(h ^ *p * P5, 11) * P1;
+    }
+    h = (h ^ h >> 33) * P2;
+    h = (h ^ h >> 29) * P3;
+    return h ^ h >> 32;
+}
+
+static std::vector<unsigned char> randomBytes(std::size_t n, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::vector<unsigned char> data(n);
+    for (auto &c : data) {
+        c = static_cast<unsigned char>(rng());
+    }
+    return data;
+}
+
+// lengths around the block sizes of all kernels, at every alignment
+static std::vector<std::size_t> interestingLengths()
+{
+    std::vector<std::size_t> lengths;
+    for (std::size_t n = 0; n < 300; ++n) {
+        lengths.push_back(n);
+    }
+    for (std::size_t n : {1000, 4095, 4096, 5552, 5553, 65536, 100003}) {
+        lengths.push_back(n);
+    }
+    return lengths;
+}
+
+TEST(knownValues) //{{{1
+{
+    const char check[] = "123456789";
+    COMPARE(checksum::crc32c(check, 9), 0xe3069283u);
+    COMPARE(checksum::crc32c(check, 0), 0u);
+    COMPARE(checksum::adler32("Wikipedia", 9), 0x11e60398u);
+    COMPARE(checksum::adler32(check, 0), 1u);
+    COMPARE(checksum::xxh64(check, 0), 0xef46db3751d8e999ull);
+    COMPARE(checksum::xxh64("a", 1), 0xd24ec4f1a98c6e5bull);
+    COMPARE(checksum::xxh64("abc", 3), 0x44bc2cf5ad770999ull);
+    COMPARE(checksum::xxh64("Nobody inspects the spammish repetition", 39),
+            0xfbcea83c8a378bf1ull);
+    // the reference implementation of the xxh64 test below
+    const char text[] = "Nobody inspects the spammish repetition";
+    const auto *bytes = reinterpret_cast<const unsigned char *>(text);
+    COMPARE(xxh64Reference(bytes, 0, 0), 0xef46db3751d8e999ull);
+    COMPARE(xxh64Reference(bytes, 39, 0), 0xfbcea83c8a378bf1ull);
+}
+
+TEST(crc32c) //{{{1
+{
+    const auto data = randomBytes(100003 + 16, 1);
+    for (std::size_t offset = 0; offset < 16; offset += 3) {
+        const unsigned char *p = data.data() + offset;
+        for (std::size_t n : interestingLengths()) {
+            const std::uint32_t ref = crc32cReference(p, n, 0);
+            COMPARE(checksum::crc32c(p, n), ref) << "n = " << n << ", at " << offset;
+            COMPARE(checksum::Detail::crc32c_table(~0u, p, n), ~ref) << "n = " << n;
+#if defined __x86_64__ && defined Vc_GCC
+            if (CpuId::hasSse42()) {
+                COMPARE(checksum::Detail::crc32c_sse42(~0u, p, n), ~ref) << "n = " << n;
+            }
+#endif
+            // continuing a checksum
+            const std::size_t half = n / 3;
+            COMPARE(checksum::crc32c(p + half, n - half, checksum::crc32c(p, half)), ref);
+        }
+    }
+}
+
+TEST(adler32) //{{{1
+{
+    auto data = randomBytes(100003 + 16, 2);
+    for (int pass = 0; pass < 2; ++pass) {
+        for (std::size_t offset = 0; offset < 16; offset += 5) {
+            const unsigned char *p = data.data() + offset;
+            for (std::size_t n : interestingLengths()) {
+                const std::uint32_t ref = adler32Reference(p, n, 1);
+                COMPARE(checksum::adler32(p, n), ref) << "n = " << n;
+                const std::size_t half = n / 3;
+                COMPARE(checksum::adler32(p + half, n - half, checksum::adler32(p, half)),
+                        ref);
+            }
+        }
+        // all bytes 0xff maximize the intermediate sums
+        std::fill(data.begin(), data.end(), 0xff);
+    }
+}
+
+TEST(xxh64) //{{{1
+{
+    // all lengths up to 300 cover the 32-byte stripes combined with every 8-, 4- and
+    // 1-byte tail
+    const auto data = randomBytes(100003 + 16, 3);
+    for (std::size_t offset = 0; offset < 16; offset += 7) {
+        const unsigned char *p = data.data() + offset;
+        for (std::size_t n : interestingLengths()) {
+            for (std::uint64_t seed : {0ull, 42ull, 0x9e3779b185ebca87ull}) {
+                COMPARE(checksum::xxh64(p, n, seed), xxh64Reference(p, n, seed))
+                    << "n = " << n << ", seed = " << seed << ", at " << offset;
+            }
+        }
+    }
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,138 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/complex>
+#include <complex>
+#include <random>
+#include <vector>
+
+using namespace Vc;
+
+using ComplexTypes = vir::concat<RealVectors, RealSimdArrays<3>, RealSimdArrays<8>,
+                            RealSimdArrays<19>>;
+
+template <typename T>
+static void compareClose(std::complex<T> a, std::complex<T> b, T tolerance)
+{
+    const T scale = std::max(T(1), std::abs(b));
+    VERIFY(std::abs(a - b) <= tolerance * scale) << a << " vs " << b;
+}
+template <typename T> static T tolerance()
+{
+    return 64 * std::numeric_limits<T>::epsilon();
+}
+
+template <typename T> static std::vector<std::complex<T>> randomData(std::size_t n)
+{
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<T> dist(-4, 4);
+    std::vector<std::complex<T>> data(n);
+    for (auto &z : data) {
+        z = {dist(rng), dist(rng)};
+    }
+    return data;
+}
+
+TEST_TYPES(V, loadStore, ComplexTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    const auto data = randomData<T>(3 * V::Size + 1);
+    for (std::size_t offset : {std::size_t(0), std::size_t(1), V::Size}) {
+        const Vc::complex<V> z(&data[offset]);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(z.real()[i], data[offset + i].real());
+            COMPARE(z.imag()[i], data[offset + i].imag());
+            COMPARE(z[i], data[offset + i]);
+        }
+        std::vector<std::complex<T>> out(V::Size + 2, std::complex<T>(-1, -1));
+        z.store(&out[1]);
+        COMPARE(out[0], std::complex<T>(-1, -1));
+        COMPARE(out[V::Size + 1], std::complex<T>(-1, -1));
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(out[i + 1], data[offset + i]);
+        }
+    }
+}
+
+TEST_TYPES(V, arithmetic, ComplexTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    using C = Vc::complex<V>;
+    const auto data = randomData<T>(2 * V::Size);
+    const C a(&data[0]);
+    const C b(&data[V::Size]);
+    const V x = a.imag();
+    const std::complex<T> s(T(0.5), T(-2));
+
+    const C sum = a + b, diff = a - b, prod = a * b, quot = a / b;
+    const C scaled = a * x, divided = a / x, shifted = T(2) - a, mixed = a * s + x;
+    C acc = a;
+    acc *= b;
+    acc += a;
+    acc /= b;
+    acc -= x;
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        const std::complex<T> za = data[i], zb = data[V::Size + i];
+        const T xi = za.imag();
+        compareClose(sum[i], za + zb, tolerance<T>());
+        compareClose(diff[i], za - zb, tolerance<T>());
+        compareClose(prod[i], za * zb, tolerance<T>());
+        compareClose(quot[i], za / zb, tolerance<T>());
+        compareClose(scaled[i], za * xi, tolerance<T>());
+        compareClose(divided[i], za / xi, tolerance<T>());
+        compareClose(shifted[i], T(2) - za, tolerance<T>());
+        compareClose(mixed[i], za * s + xi, tolerance<T>());
+        compareClose(acc[i], (za * zb + za) / zb - xi, tolerance<T>());
+        compareClose((-a)[i], -za, T(0));
+    }
+    VERIFY(all_of(a == a));
+    VERIFY(none_of(a != a));
+    VERIFY(none_of(a == conj(a) && a.imag() != T(0)));
+}
+
+TEST_TYPES(V, math, ComplexTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    using C = Vc::complex<V>;
+    const auto data = randomData<T>(V::Size);
+    const C z(&data[0]);
+    const C c = conj(z), e = exp(z), p = polar(abs(z), arg(z));
+    const V n = norm(z), r = abs(z), phi = arg(z);
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        const std::complex<T> zi = data[i];
+        COMPARE(c[i], std::conj(zi));
+        FUZZY_COMPARE(n[i], std::norm(zi));
+        FUZZY_COMPARE(r[i], std::abs(zi));
+        compareClose(std::complex<T>(phi[i]), std::complex<T>(std::arg(zi)),
+                     tolerance<T>());
+        compareClose(e[i], std::exp(zi), tolerance<T>());
+        compareClose(p[i], zi, tolerance<T>());
+    }
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,158 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/convolution>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace Vc;
+
+using SampleTypes = vir::Typelist<float, double, short>;
+
+// full-scale samples, or taps whose absolute values sum to at most 1 (Q15 for short)
+template <typename T>
+static std::vector<T> randomSamples(std::size_t n, unsigned seed, bool taps = false)
+{
+    std::mt19937 rng(seed);
+    std::vector<T> x(n);
+    const double amplitude = (std::is_floating_point<T>::value ? 1 : 32767) /
+                             (taps ? double(n) : 1.);
+    std::uniform_real_distribution<double> dist(-amplitude, amplitude);
+    for (auto &v : x) {
+        v = T(dist(rng));
+    }
+    return x;
+}
+
+// y[i] = sum_j h[j] x[i - j], with the sum of |h[j] x[i - j]| as the error scale
+template <typename T>
+static void referenceConvolution(const std::vector<T> &x, const std::vector<T> &h,
+                                 std::vector<long double> &y,
+                                 std::vector<long double> &scale)
+{
+    const std::size_t n = x.size() + h.size() - 1;
+    y.assign(n, 0);
+    scale.assign(n, 0);
+    for (std::size_t i = 0; i < x.size(); ++i) {
+        for (std::size_t j = 0; j < h.size(); ++j) {
+            const long double p = static_cast<long double>(x[i]) * h[j];
+            y[i + j] += p;
+            scale[i + j] += std::abs(p);
+        }
+    }
+}
+
+template <typename T, typename R>
+static void verifyClose(const std::vector<R> &y, const std::vector<long double> &ref,
+                        const std::vector<long double> &scale, std::size_t nh)
+{
+    COMPARE(y.size(), ref.size());
+    // the rounding errors of overlap-save scale with the whole block, not with the
+    // terms of one output
+    const long double eps =
+        std::is_floating_point<T>::value ? std::numeric_limits<T>::epsilon() : 0;
+    const long double maxScale = *std::max_element(scale.begin(), scale.end());
+    for (std::size_t i = 0; i < y.size(); ++i) {
+        const long double err = std::abs(y[i] - ref[i]);
+        VERIFY(err <= 8 * eps * std::log2(4 * nh) * maxScale)
+            << "i = " << i << ", nh = " << nh << ": " << y[i] << " vs " << ref[i];
+    }
+}
+
+static const fir_method methods[] = {fir_method::automatic, fir_method::direct,
+                                     fir_method::fft};
+
+TEST_TYPES(T, convolution, SampleTypes) //{{{1
+{
+    using R = typename fir<T>::result_type;
+    for (std::size_t nh : {1u, 2u, 3u, 17u, 64u, 161u, 700u}) {
+        for (std::size_t nx : {1u, 5u, 100u, 5000u}) {
+            const auto x = randomSamples<T>(nx, nx);
+            const auto h = randomSamples<T>(nh, nh + 1, true);
+            std::vector<long double> ref, scale;
+            referenceConvolution(x, h, ref, scale);
+            for (fir_method method : methods) {
+                if (method == fir_method::fft && !std::is_floating_point<T>::value) {
+                    continue;
+                }
+                std::vector<R> y(nx + nh - 1);
+                convolve(x.data(), nx, h.data(), nh, y.data(), method);
+                verifyClose<T>(y, ref, scale, nh);
+            }
+        }
+    }
+}
+
+TEST_TYPES(T, correlation, SampleTypes) //{{{1
+{
+    using R = typename fir<T>::result_type;
+    for (std::size_t nh : {1u, 9u, 300u}) {
+        const std::size_t nx = 1000;
+        const auto x = randomSamples<T>(nx, 3);
+        const auto h = randomSamples<T>(nh, 4, true);
+        std::vector<long double> ref, scale;
+        referenceConvolution(x, std::vector<T>(h.rbegin(), h.rend()), ref, scale);
+        std::vector<R> y(nx + nh - 1);
+        correlate(x.data(), nx, h.data(), nh, y.data());
+        verifyClose<T>(y, ref, scale, nh);
+    }
+}
+
+TEST_TYPES(T, streaming, SampleTypes) //{{{1
+{
+    using R = typename fir<T>::result_type;
+    std::mt19937 rng(5);
+    for (std::size_t nh : {7u, 33u, 500u}) {
+        const std::size_t nx = 20000;
+        const auto x = randomSamples<T>(nx, 6);
+        const auto h = randomSamples<T>(nh, 7, true);
+        std::vector<long double> ref, scale;
+        referenceConvolution(x, h, ref, scale);
+        ref.resize(nx);
+        scale.resize(nx);
+
+        fir<T> filter(h.data(), nh);
+        COMPARE(filter.size(), nh);
+        VERIFY(filter.method() != fir_method::automatic);
+        for (int pass = 0; pass < 2; ++pass) {
+            std::vector<R> y(nx);
+            for (std::size_t i = 0; i < nx;) {
+                const std::size_t chunk = std::min<std::size_t>(rng() % 3000, nx - i);
+                filter.process(x.data() + i, chunk, y.data() + i);
+                i += chunk;
+            }
+            verifyClose<T>(y, ref, scale, nh);
+            filter.reset();
+        }
+    }
+}
+
+// vim: foldmethod=marker
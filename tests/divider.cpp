@@ -0,0 +1,123 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/divider>
+#include <limits>
+#include <vector>
+
+using namespace Vc;
+
+template <typename T> std::vector<T> interestingValues() //{{{1
+{
+    using L = std::numeric_limits<T>;
+    std::vector<T> values = {T(1), T(2), T(3), T(5), T(6), T(7), T(10), T(16), T(25),
+                             T(100), T(641), T(1000), T(L::max()), T(L::max() - 1),
+                             T(L::max() / 2), T(L::max() / 2 + 1), T(L::max() / 3)};
+    for (int shift = 4; shift < L::digits; shift += 3) {
+        values.push_back(T(T(1) << shift));
+        values.push_back(T((T(1) << shift) + 1));
+        values.push_back(T((T(1) << shift) - 1));
+    }
+    if (L::is_signed) {
+        const std::size_t n = values.size();
+        for (std::size_t i = 0; i < n; ++i) {
+            values.push_back(T(-values[i]));
+        }
+        values.push_back(L::min());
+        values.push_back(T(L::min() + 1));
+    }
+    return values;
+}
+
+TEST_TYPES(V, mulhi, IntVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    using W = typename std::conditional<std::is_signed<T>::value, long long,
+                                        unsigned long long>::type;
+    const auto values = interestingValues<T>();
+    withRandomMask<V>([&](typename V::Mask) {
+        const V a = V::Random();
+        for (T b : values) {
+            const V hi = Vc::mulhi(a, V(b));
+            for (std::size_t i = 0; i < V::Size; ++i) {
+                COMPARE(hi[i], T((W(a[i]) * W(b)) >> (8 * sizeof(T))))
+                    << "a: " << a[i] << ", b: " << b;
+            }
+        }
+    });
+}
+
+TEST_TYPES(V, divide, IntVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    const auto values = interestingValues<T>();
+    auto check = [&](const V &n, T d) {
+        const divider<T> dd(d);
+        COMPARE(dd.divisor(), d);
+        const V q = n / dd;
+        const V r = n % dd;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            if (L::is_signed && n[i] == L::min() && d == T(-1)) {
+                continue;  // overflows
+            }
+            COMPARE(q[i], T(n[i] / d)) << "n: " << n[i] << ", d: " << d;
+            COMPARE(r[i], T(n[i] % d)) << "n: " << n[i] << ", d: " << d;
+        }
+        V n2 = n;
+        n2 /= dd;
+        COMPARE(n2, q);
+        n2 = n;
+        n2 %= dd;
+        COMPARE(n2, r);
+    };
+    for (T d : values) {
+        // every value as numerator, then random numerators
+        for (std::size_t i = 0; i < values.size(); i += V::Size) {
+            check(V([&](std::size_t j) { return values[(i + j) % values.size()]; }), d);
+        }
+        for (int repeat = 0; repeat < 100; ++repeat) {
+            check(V::Random(), d);
+        }
+    }
+}
+
+TEST(scalarDivide) //{{{1
+{
+    for (int d : interestingValues<int>()) {
+        const divider<int> dd(d);
+        for (int n : {0, 1, -1, 12345, -12345, std::numeric_limits<int>::max()}) {
+            COMPARE(n / dd, n / d) << "n: " << n << ", d: " << d;
+            COMPARE(n % dd, n % d) << "n: " << n << ", d: " << d;
+        }
+    }
+    const divider<uint> by7(7u);
+    COMPARE(4000000000u / by7, 4000000000u / 7u);
+}
+
+// vim: foldmethod=marker
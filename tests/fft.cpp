@@ -0,0 +1,212 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/fft>
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+using namespace Vc;
+
+template <typename T> using ComplexVector = std::vector<std::complex<T>>;
+
+static const std::size_t sizes[] = {1,  2,  3,  4,   5,   6,   8,   12,  15,  16,  30,
+                                    32, 60, 64, 100, 128, 192, 240, 256, 360, 512, 1000,
+                                    1024, 1536, 2048};
+
+template <typename T> static ComplexVector<T> randomSignal(std::size_t n, unsigned seed)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<T> dist(-1, 1);
+    ComplexVector<T> x(n);
+    for (auto &z : x) {
+        z = {dist(rng), dist(rng)};
+    }
+    return x;
+}
+
+// O(n²) reference DFT in long double
+template <typename T>
+static std::vector<std::complex<long double>> dft(const ComplexVector<T> &x, bool inverse)
+{
+    using P = long double;
+    const std::size_t n = x.size();
+    const P sign = inverse ? 1 : -1;
+    std::vector<std::complex<P>> r(n);
+    for (std::size_t k = 0; k < n; ++k) {
+        std::complex<P> sum = 0;
+        for (std::size_t j = 0; j < n; ++j) {
+            const P phi = sign * 2 * P(3.141592653589793238462643383279502884L) *
+                          ((j * k) % n) / n;
+            sum += std::complex<P>(x[j]) * std::complex<P>(std::cos(phi), std::sin(phi));
+        }
+        r[k] = sum;
+    }
+    return r;
+}
+
+// relative L2 error of x against the reference
+template <typename T, typename U>
+static long double relativeError(const ComplexVector<T> &x,
+                                 const std::vector<std::complex<U>> &ref)
+{
+    long double err = 0, norm = 0;
+    for (std::size_t i = 0; i < ref.size(); ++i) {
+        const std::complex<long double> r = ref[i];
+        err += std::norm(std::complex<long double>(x[i]) - r);
+        norm += std::norm(r);
+    }
+    return norm == 0 ? std::sqrt(err) : std::sqrt(err / norm);
+}
+
+template <typename T> static long double tolerance(std::size_t n)
+{
+    return 8 * std::numeric_limits<T>::epsilon() * std::log2(2 * n);
+}
+
+TEST_TYPES(V, supportedSizes, RealVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    VERIFY(fft<T>::is_supported(1));
+    VERIFY(fft<T>::is_supported(2 * 3 * 4 * 5 * 8 * 9));
+    VERIFY(!fft<T>::is_supported(0));
+    VERIFY(!fft<T>::is_supported(7));
+    VERIFY(!fft<T>::is_supported(2 * 11));
+}
+
+TEST_TYPES(V, complexTransform, RealVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : sizes) {
+        fft<T> plan(n);
+        COMPARE(plan.size(), n);
+        const auto x = randomSignal<T>(n, n);
+        ComplexVector<T> y(n);
+        plan.forward(x.data(), y.data());
+        const long double errForward = relativeError(y, dft(x, false));
+        VERIFY(errForward <= tolerance<T>(n)) << "n = " << n << ", error " << errForward;
+
+        plan.inverse(x.data(), y.data());
+        const long double errInverse = relativeError(y, dft(x, true));
+        VERIFY(errInverse <= tolerance<T>(n)) << "n = " << n << ", error " << errInverse;
+    }
+}
+
+TEST_TYPES(V, roundTripInPlace, RealVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : {64u, 4096u, 3u * 5u * 1024u}) {
+        fft<T> plan(n);
+        const auto x = randomSignal<T>(n, 1);
+        auto y = x;
+        plan.forward(y.data(), y.data());
+        plan.inverse(y.data(), y.data());
+        for (auto &z : y) {
+            z /= T(n);
+        }
+        const long double err = relativeError(y, x);
+        VERIFY(err <= tolerance<T>(n)) << "n = " << n << ", error " << err;
+    }
+}
+
+TEST_TYPES(V, realTransform, RealVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : sizes) {
+        if (n % 2 != 0) {
+            continue;
+        }
+        fft<T> plan(n);
+        const auto noise = randomSignal<T>(n, n);
+        std::vector<T> x(n);
+        ComplexVector<T> xc(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            x[i] = noise[i].real();
+            xc[i] = x[i];
+        }
+        ComplexVector<T> y(n / 2 + 1);
+        plan.forward_real(x.data(), y.data());
+        auto ref = dft(xc, false);
+        ref.resize(n / 2 + 1);
+        const long double err = relativeError(y, ref);
+        VERIFY(err <= tolerance<T>(n)) << "n = " << n << ", error " << err;
+
+        std::vector<T> back(n);
+        plan.inverse_real(y.data(), back.data());
+        long double errBack = 0, norm = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const long double d = back[i] / static_cast<long double>(n) - x[i];
+            errBack += d * d;
+            norm += static_cast<long double>(x[i]) * x[i];
+        }
+        errBack = std::sqrt(errBack / norm);
+        VERIFY(errBack <= tolerance<T>(n)) << "n = " << n << ", error " << errBack;
+    }
+}
+
+TEST_TYPES(V, batched, RealVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    using C = Vc::complex<V>;
+    for (std::size_t n : {1u, 8u, 12u, 60u, 256u}) {
+        fft<T> plan(n);
+        std::vector<ComplexVector<T>> signals;
+        std::vector<C, Vc::Allocator<C>> data(n);
+        for (std::size_t l = 0; l < V::Size; ++l) {
+            signals.push_back(randomSignal<T>(n, 100 + l));
+        }
+        for (std::size_t j = 0; j < n; ++j) {
+            V re, im;
+            for (std::size_t l = 0; l < V::Size; ++l) {
+                re[l] = signals[l][j].real();
+                im[l] = signals[l][j].imag();
+            }
+            data[j] = C(re, im);
+        }
+        plan.forward(data.data());
+        for (std::size_t l = 0; l < V::Size; ++l) {
+            ComplexVector<T> lane(n);
+            for (std::size_t j = 0; j < n; ++j) {
+                lane[j] = data[j][l];
+            }
+            const long double err = relativeError(lane, dft(signals[l], false));
+            VERIFY(err <= tolerance<T>(n)) << "n = " << n << ", lane " << l;
+        }
+        plan.inverse(data.data());
+        for (std::size_t l = 0; l < V::Size; ++l) {
+            ComplexVector<T> lane(n);
+            for (std::size_t j = 0; j < n; ++j) {
+                lane[j] = data[j][l] / T(n);
+            }
+            VERIFY(relativeError(lane, signals[l]) <= tolerance<T>(n)) << "n = " << n;
+        }
+    }
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,184 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/filters>
+#include <cstdint>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+using namespace Vc;
+
+template <typename Key> static std::vector<Key> randomKeys(std::size_t n, int seed)
+{
+    std::mt19937_64 rng(seed);
+    std::vector<Key> keys(n);
+    for (auto &k : keys) {
+        k = static_cast<Key>(rng());
+    }
+    return keys;
+}
+
+static bool bitAt(const std::vector<std::uint64_t> &bits, std::size_t i)
+{
+    return (bits[i / 64] >> (i % 64)) & 1;
+}
+
+// Checks that the batched and the single-key contains agree, that no inserted key is
+// rejected, and returns the false positive rate on keys that were not inserted.
+template <typename Filter, typename Key>
+double checkFilter(const Filter &filter, const std::vector<Key> &inserted,
+                   const std::vector<Key> &other)
+{
+    for (std::size_t n : {inserted.size(), inserted.size() - 1, std::size_t(3)}) {
+        std::vector<std::uint64_t> bits((n + 63) / 64, ~std::uint64_t(0));
+        COMPARE(filter.contains(inserted.data(), n, bits.data()), n);
+        for (std::size_t i = 0; i < n; ++i) {
+            VERIFY(bitAt(bits, i)) << i;
+            VERIFY(filter.contains(inserted[i])) << i;
+        }
+        if (n % 64 != 0) {
+            COMPARE(bits.back() >> (n % 64), 0u);
+        }
+    }
+    std::unordered_set<Key> set(inserted.begin(), inserted.end());
+    std::vector<std::uint64_t> bits((other.size() + 63) / 64);
+    const std::size_t positives = filter.contains(other.data(), other.size(), bits.data());
+    std::size_t falsePositives = 0, count = 0;
+    for (std::size_t i = 0; i < other.size(); ++i) {
+        COMPARE(bitAt(bits, i), filter.contains(other[i])) << i;
+        count += bitAt(bits, i);
+        if (bitAt(bits, i) && set.count(other[i]) == 0) {
+            ++falsePositives;
+        }
+    }
+    COMPARE(positives, count);
+    return double(falsePositives) / other.size();
+}
+
+template <typename Key> void testBloom() //{{{1
+{
+    const auto keys = randomKeys<Key>(20001, 1);
+    const auto other = randomKeys<Key>(50000, 2);
+
+    blocked_bloom_filter<Key> filter(keys.size());
+    COMPARE(filter.size_in_bytes(), filter.block_count() * 64);
+    filter.insert(keys.data(), keys.size() / 2);
+    for (std::size_t i = keys.size() / 2; i < keys.size(); ++i) {
+        filter.insert(keys[i]);
+    }
+    const double fpr = checkFilter(filter, keys, other);
+    VERIFY(fpr < 0.01) << fpr;
+
+    blocked_bloom_filter<Key> small(keys.size(), 8);
+    small.insert(keys.data(), keys.size());
+    const double fpr8 = checkFilter(small, keys, other);
+    VERIFY(fpr8 < 0.05) << fpr8;
+    VERIFY(fpr8 > fpr) << fpr8 << ' ' << fpr;
+
+    const blocked_bloom_filter<Key> copy = filter;
+    filter.clear();
+    std::vector<std::uint64_t> bits((keys.size() + 63) / 64);
+    COMPARE(filter.contains(keys.data(), keys.size(), bits.data()), 0u);
+    COMPARE(copy.contains(keys.data(), keys.size(), bits.data()), keys.size());
+}
+
+TEST(bloomFilter)
+{
+    testBloom<int>();
+    testBloom<uint>();
+    testBloom<std::int64_t>();
+    testBloom<std::uint64_t>();
+}
+
+template <typename Key> void testCuckoo() //{{{1
+{
+    const auto keys = randomKeys<Key>(20001, 3);
+    const auto other = randomKeys<Key>(50000, 4);
+
+    cuckoo_filter<Key> filter(keys.size());
+    VERIFY(filter.capacity() * 9 >= keys.size() * 10);
+    const std::size_t added = filter.insert(keys.data(), keys.size() / 2);
+    COMPARE(added, keys.size() / 2);
+    for (std::size_t i = keys.size() / 2; i < keys.size(); ++i) {
+        VERIFY(filter.insert(keys[i])) << i;
+    }
+    COMPARE(filter.size(), keys.size());
+    const double fpr = checkFilter(filter, keys, other);
+    VERIFY(fpr < 0.001) << fpr;
+
+    // erase every other key; the rest must still be found
+    std::vector<Key> kept;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        if (i % 2 == 0) {
+            VERIFY(filter.erase(keys[i])) << i;
+        } else {
+            kept.push_back(keys[i]);
+        }
+    }
+    COMPARE(filter.size(), kept.size());
+    checkFilter(filter, kept, other);
+}
+
+TEST(cuckooFilter)
+{
+    testCuckoo<int>();
+    testCuckoo<uint>();
+    testCuckoo<std::int64_t>();
+    testCuckoo<std::uint64_t>();
+}
+
+TEST(cuckooFilterFull) //{{{1
+{
+    const auto keys = randomKeys<std::uint64_t>(1000, 5);
+    cuckoo_filter<std::uint64_t> filter(100);
+    VERIFY(!filter.full());
+    const std::size_t added = filter.insert(keys.data(), keys.size());
+    VERIFY(added < keys.size());
+    VERIFY(filter.full());
+    VERIFY(added * 100 >= filter.capacity() * 90) << added << '/' << filter.capacity();
+    COMPARE(filter.size(), added);
+    const std::size_t more = filter.insert(keys.data() + added, 1);
+    COMPARE(more, 0u);
+    const std::vector<std::uint64_t> stored(keys.begin(), keys.begin() + added);
+    checkFilter(filter, stored, keys);
+
+    // erasing makes room for the fingerprint that did not fit
+    VERIFY(filter.erase(keys[0]));
+    COMPARE(filter.size(), added - 1);
+    checkFilter(filter, std::vector<std::uint64_t>(stored.begin() + 1, stored.end()),
+                keys);
+
+    filter.clear();
+    COMPARE(filter.size(), 0u);
+    VERIFY(!filter.full());
+    VERIFY(filter.insert(keys[0]));
+    VERIFY(filter.contains(keys[0]));
+}
+
+// vim: foldmethod=marker
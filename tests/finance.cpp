@@ -0,0 +1,238 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/finance>
+#include <cmath>
+#include <limits>
+#include <random>
+
+using namespace Vc;
+using finance::option_type;
+
+using FloatTypes = vir::Typelist<float_v, double_v>;
+
+template <typename T> static double tolerance() { return sizeof(T) == 4 ? 2e-6 : 2e-14; }
+
+TEST_TYPES(V, normalCdfMatchesErfc, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    // the lower tail down to the smallest normal results
+    const double lowest = sizeof(T) == 4 ? -12.5 : -37;
+    for (double x0 = lowest; x0 < 9; x0 += 0.37 * V::Size) {
+        const V x = V(T(x0)) + V::IndexesFromZero() * V(T(0.37));
+        const V cdf = finance::normal_cdf(x), pdf = finance::normal_pdf(x);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            const double xi = x[i];
+            const double ref = 0.5 * std::erfc(-xi / std::sqrt(2.));
+            // Φ amplifies the rounding of x by |x|²
+            VERIFY(std::abs(cdf[i] - ref) <= tolerance<T>() * (1 + xi * xi) * ref)
+                << xi << ": " << cdf[i] << " vs " << ref;
+            const double density = std::exp(-0.5 * xi * xi) / std::sqrt(2 * M_PI);
+            VERIFY(std::abs(pdf[i] - density) <= 4 * tolerance<T>() * density) << xi;
+        }
+    }
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(finance::normal_cdf(V(-inf)), V::Zero());
+    COMPARE(finance::normal_cdf(V(inf)), V(T(1)));
+    COMPARE(finance::normal_cdf(V::Zero()), V(T(0.5)));
+    VERIFY(all_of(isnan(finance::normal_cdf(V(std::numeric_limits<T>::quiet_NaN())))));
+}
+
+TEST_TYPES(V, inverseNormalCdfInvertsCdf, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(finance::inverse_normal_cdf(V::Zero()), V(-inf));
+    COMPARE(finance::inverse_normal_cdf(V(T(1))), V(inf));
+    VERIFY(all_of(abs(finance::inverse_normal_cdf(V(T(0.5)))) < V(T(1e-15))));
+    const V q = finance::inverse_normal_cdf(V(T(0.975)));
+    VERIFY(std::abs(q[0] - 1.959963984540054) < 1e-6) << q;
+    // Acklam's approximation alone in single precision, refined in double precision
+    const double tol = sizeof(T) == 4 ? 2e-6 : 1e-14;
+    std::mt19937 rng(1);
+    const int decades = sizeof(T) == 4 ? 37 : 300;
+    for (int run = 0; run < 2000; ++run) {
+        V p;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            const double e = std::uniform_real_distribution<double>(-decades, 0)(rng);
+            const double u = std::pow(10., e);
+            p[i] = T(run % 2 ? u : 1 - u);
+        }
+        const V x = finance::inverse_normal_cdf(p);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            const double pi = p[i], xi = x[i];
+            if (pi == 1) {
+                COMPARE(xi, std::numeric_limits<double>::infinity());
+                continue;
+            }
+            // compare the probabilities of the smaller tail, which are both accurate
+            const double tail = std::min(pi, 1 - pi);
+            const double back = 0.5 * std::erfc(std::abs(xi) / std::sqrt(2.));
+            VERIFY((xi < 0) == (pi < 0.5) || pi == 0.5) << pi << ' ' << xi;
+            // |dp/dx| = φ(x): allow the rounding of x itself
+            const double slack = std::abs(xi) * std::numeric_limits<T>::epsilon() *
+                                 std::exp(-0.5 * xi * xi) / std::sqrt(2 * M_PI);
+            VERIFY(std::abs(back - tail) <= tol * tail + 4 * slack)
+                << pi << ": " << xi << ", " << back << " vs " << tail;
+        }
+    }
+}
+
+TEST(philoxKnownAnswers) //{{{1
+{
+    // from the known answer tests of Random123
+    const unsigned in[][6] = {
+        {0, 0, 0, 0, 0, 0},
+        {~0u, ~0u, ~0u, ~0u, ~0u, ~0u},
+        {0x243f6a88, 0x85a308d3, 0x13198a2e, 0x03707344, 0xa4093822, 0x299f31d0}};
+    const unsigned out[][4] = {{0x6627e8d5, 0xe169c58d, 0xbc57ac4c, 0x9b00dbd8},
+                               {0x408f276d, 0x41c83b0e, 0xa20bc7c6, 0x6d5451fd},
+                               {0xd16cfe09, 0x94fdcceb, 0x5001e420, 0x24126ea1}};
+    for (int t = 0; t < 3; ++t) {
+        uint_v c[4] = {uint_v(in[t][0]), uint_v(in[t][1]), uint_v(in[t][2]),
+                       uint_v(in[t][3])};
+        finance::Detail::philox4x32(c, uint_v(in[t][4]), uint_v(in[t][5]));
+        for (int w = 0; w < 4; ++w) {
+            COMPARE(c[w], uint_v(out[t][w])) << t << ' ' << w;
+        }
+    }
+}
+
+// Black-Scholes reference{{{1
+struct Greeks {
+    double price, delta, gamma, vega, theta, rho;
+};
+
+static Greeks reference(option_type type, double S, double K, double r, double q,
+                        double sigma, double T)
+{
+    const auto N = [](double x) { return 0.5 * std::erfc(-x / std::sqrt(2.)); };
+    const double s = type == option_type::call ? 1 : -1;
+    const double sd = sigma * std::sqrt(T);
+    const double d1 = (std::log(S / K) + (r - q + 0.5 * sigma * sigma) * T) / sd;
+    const double d2 = d1 - sd;
+    const double phi = std::exp(-0.5 * d1 * d1) / std::sqrt(2 * M_PI);
+    const double F = S * std::exp(-q * T), D = K * std::exp(-r * T);
+    return {s * (F * N(s * d1) - D * N(s * d2)),
+            s * std::exp(-q * T) * N(s * d1),
+            F * phi / (S * S * sd),
+            F * phi * std::sqrt(T),
+            -F * phi * sigma / (2 * std::sqrt(T)) +
+                s * (q * F * N(s * d1) - r * D * N(s * d2)),
+            s * T * D * N(s * d2)};
+}
+
+TEST_TYPES(V, blackScholesMatchesReference, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    const std::size_t n = 1000 + V::Size / 2;
+    finance::option_batch<T> options(n);
+    std::mt19937 rng(2);
+    const auto uniform = [&](double a, double b) {
+        return T(std::uniform_real_distribution<double>(a, b)(rng));
+    };
+    for (std::size_t i = 0; i < n; ++i) {
+        options.spot[i] = uniform(50, 150);
+        options.strike[i] = uniform(50, 150);
+        options.rate[i] = uniform(0, 0.08);
+        options.dividend[i] = uniform(0, 0.04);
+        options.volatility[i] = uniform(0.05, 0.8);
+        options.expiry[i] = uniform(0.02, 5);
+    }
+    // absolute errors relative to the spot price, which bounds all prices
+    const double tol = sizeof(T) == 4 ? 2e-5 : 1e-12;
+    for (option_type type : {option_type::call, option_type::put}) {
+        finance::option_greeks<T> greeks(n);
+        Memory<V> price(n);
+        finance::black_scholes(options, type, greeks);
+        finance::black_scholes(options, type, price, 1);
+        for (std::size_t i = 0; i < n; ++i) {
+            const double S = options.spot[i], sigma = options.volatility[i],
+                         Tx = options.expiry[i];
+            const Greeks ref = reference(type, S, options.strike[i], options.rate[i],
+                                         options.dividend[i], sigma, Tx);
+            COMPARE(price[i], greeks.price[i]) << i;
+            VERIFY(std::abs(greeks.price[i] - ref.price) <= tol * S)
+                << i << ": " << greeks.price[i] << " vs " << ref.price;
+            VERIFY(std::abs(greeks.delta[i] - ref.delta) <= tol) << i;
+            VERIFY(std::abs(greeks.gamma[i] - ref.gamma) * S <= tol) << i;
+            VERIFY(std::abs(greeks.vega[i] - ref.vega) <= tol * S) << i;
+            VERIFY(std::abs(greeks.theta[i] - ref.theta) <= tol * S * (1 + sigma / Tx))
+                << i;
+            VERIFY(std::abs(greeks.rho[i] - ref.rho) <= tol * S * Tx) << i;
+        }
+    }
+}
+
+TEST_TYPES(V, monteCarloConverges, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    const finance::gbm<T> model = {T(100), T(0.05), T(0.01), T(0.25)};
+    const T expiry = T(1.5);
+    for (option_type type : {option_type::call, option_type::put}) {
+        const finance::european<T> payoff = {type, T(105)};
+        const auto r = finance::monte_carlo(model, expiry, 1, 200001, payoff, 7);
+        const double ref = reference(type, 100, 105, 0.05, 0.01, 0.25, 1.5).price;
+        VERIFY(r.standard_error > 0 && r.standard_error < 0.05) << r.standard_error;
+        VERIFY(std::abs(r.price - ref) < 4 * r.standard_error)
+            << r.price << " vs " << ref << " ± " << r.standard_error;
+
+        // the discretized path ends in the same distribution
+        const auto r12 = finance::monte_carlo(model, expiry, 12, 50000, payoff, 8);
+        VERIFY(std::abs(r12.price - ref) < 4 * r12.standard_error)
+            << r12.price << " vs " << ref << " ± " << r12.standard_error;
+    }
+    // the average has less variance: an Asian option is cheaper than the European one
+    const finance::asian<T> asian = {option_type::call, T(100)};
+    const auto a = finance::monte_carlo(model, expiry, 24, 20000, asian, 9);
+    const double european =
+        reference(option_type::call, 100, 100, 0.05, 0.01, 0.25, 1.5).price;
+    VERIFY(a.price > 0.4 * european && a.price < 0.75 * european) << a.price;
+}
+
+TEST_TYPES(V, monteCarloIsReproducible, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    const finance::gbm<T> model = {T(40), T(0.03), T(0), T(0.4)};
+    const finance::asian<T> payoff = {option_type::put, T(42)};
+    const std::size_t paths = 3 * 4096 + 13;
+    const auto one = finance::monte_carlo(model, T(0.5), 7, paths, payoff, 11, 1);
+    const auto three = finance::monte_carlo(model, T(0.5), 7, paths, payoff, 11, 3);
+    COMPARE(one.price, three.price);
+    COMPARE(one.standard_error, three.standard_error);
+    const auto other = finance::monte_carlo(model, T(0.5), 7, paths, payoff, 12, 1);
+    VERIFY(one.price != other.price);
+    // a custom payoff: the lanes beyond paths must not count
+    const auto ones = finance::monte_carlo(
+        model, T(0.5), 3, 1001,
+        [](const Vector<T> *, std::size_t) { return Vector<T>(T(1)); }, 1);
+    VERIFY(std::abs(ones.price - std::exp(-0.03 * 0.5)) < 1e-6) << ones.price;
+    COMPARE(ones.standard_error, T(0));
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,260 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/hash>
+#include <Vc/hash_map>
+#include <cstdint>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+using namespace Vc;
+
+// reference implementations working on byte strings{{{1
+static uint rotl(uint x, int r) { return (x << r) | (x >> (32 - r)); }
+static uint load32(const unsigned char *p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | (uint(p[3]) << 24);
+}
+
+static uint murmur3Reference(const unsigned char *data, std::size_t len, uint seed)
+{
+    uint h = seed;
+    for (std::size_t i = 0; i + 4 <= len; i += 4) {
+        uint k = load32(data + i) * 0xcc9e2d51u;
+        h ^= rotl(k, 15) * 0x1b873593u;
+        h = rotl(h, 13) * 5 + 0xe6546b64u;
+    }
+    h ^= uint(len);
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    h *= 0xc2b2ae35u;
+    return h ^ (h >> 16);
+}
+
+static uint xxh32Reference(const unsigned char *data, std::size_t len, uint seed)
+{
+    const uint p2 = 2246822519u, p3 = 3266489917u, p4 = 668265263u, p5 = 374761393u;
+    uint h = seed + p5 + uint(len);
+    for (std::size_t i = 0; i + 4 <= len; i += 4) {
+        h = rotl(h + load32(data + i) * p3, 17) * p4;
+    }
+    h ^= h >> 15;
+    h *= p2;
+    h ^= h >> 13;
+    h *= p3;
+    return h ^ (h >> 16);
+}
+
+static uint crc32cReference(const unsigned char *data, std::size_t len, uint crc)
+{
+    crc = ~crc;
+    for (std::size_t i = 0; i < len; ++i) {
+        crc ^= data[i];
+        for (int b = 0; b < 8; ++b) {
+            crc = (crc >> 1) ^ (0x82f63b78u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+template <typename R> static uint referenceOf(R r, uint key, uint seed)
+{
+    unsigned char bytes[4];
+    for (int i = 0; i < 4; ++i) {
+        bytes[i] = key >> (8 * i);
+    }
+    return r(bytes, 4, seed);
+}
+
+template <typename R> static uint referenceOf(R r, uint lo, uint hi, uint seed)
+{
+    unsigned char bytes[8];
+    for (int i = 0; i < 4; ++i) {
+        bytes[i] = lo >> (8 * i);
+        bytes[i + 4] = hi >> (8 * i);
+    }
+    return r(bytes, 8, seed);
+}
+
+TEST(referenceValues) //{{{1
+{
+    const unsigned char check[] = "123456789";
+    COMPARE(crc32cReference(check, 9, 0), 0xe3069283u);
+    COMPARE(xxh32Reference(check, 0, 0), 0x02cc5d05u);
+    COMPARE(murmur3Reference(check, 0, 0), 0u);
+    COMPARE(murmur3Reference(check, 0, 1), 0x514e28b7u);
+}
+
+template <typename V> void testHashes() //{{{1
+{
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V lo = V::Random();
+        const V hi = V::Random();
+        const uint seed = repetition * 0x9e3779b9u;
+        const V h0 = murmur3_32(lo, seed), h1 = murmur3_32(lo, hi, seed);
+        const V x0 = xxh32(lo, seed), x1 = xxh32(lo, hi, seed);
+        const V c0 = crc32c(lo, seed), c1 = crc32c(lo, hi, seed);
+        const V f = fmix32(lo);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            const uint l = lo[i], h = hi[i];
+            COMPARE(uint(h0[i]), referenceOf(murmur3Reference, l, seed));
+            COMPARE(uint(h1[i]), referenceOf(murmur3Reference, l, h, seed));
+            COMPARE(uint(x0[i]), referenceOf(xxh32Reference, l, seed));
+            COMPARE(uint(x1[i]), referenceOf(xxh32Reference, l, h, seed));
+            COMPARE(uint(c0[i]), referenceOf(crc32cReference, l, seed));
+            COMPARE(uint(c1[i]), referenceOf(crc32cReference, l, h, seed));
+            COMPARE(uint(h0[i]), murmur3_32(l, seed));
+            const std::uint64_t k = l | std::uint64_t(h) << 32;
+            COMPARE(uint(h1[i]), murmur3_32(k, seed));
+            COMPARE(uint(x1[i]), xxh32(k, seed));
+            COMPARE(uint(c1[i]), crc32c(k, seed));
+            COMPARE(uint(f[i]), fmix32(l));
+        }
+    }
+}
+
+TEST(hashes) //{{{1
+{
+    testHashes<uint_v>();
+    testHashes<SimdArray<uint, 7>>();
+    testHashes<SimdArray<uint, uint_v::Size * 3>>();
+}
+
+template <typename Key> void testMap() //{{{1
+{
+    std::mt19937_64 rng(Key(0x1234));
+    // a small key range, so that the random operations hit existing keys
+    std::uniform_int_distribution<long long> keyDist(-2000, 2000);
+    const auto randomKey = [&]() {
+        return static_cast<Key>(keyDist(rng) * 0x100000001ll);
+    };
+    flat_hash_map<Key, int> map;
+    std::unordered_map<Key, int> reference;
+    for (int i = 0; i < 20000; ++i) {
+        const Key k = randomKey();
+        switch (rng() % 4) {
+        case 0:
+        case 1: {
+            const auto r = map.insert(k, i);
+            const auto s = reference.insert({k, i});
+            COMPARE(r.second, s.second);
+            COMPARE(*r.first, s.first->second);
+        } break;
+        case 2:
+            COMPARE(map.erase(k), reference.erase(k));
+            break;
+        case 3:
+            map[k] += 1;
+            reference[k] += 1;
+            break;
+        }
+        COMPARE(map.size(), reference.size());
+    }
+    VERIFY(map.size() <= map.capacity() - map.capacity() / 8);
+
+    std::size_t visited = 0;
+    map.for_each([&](const Key &k, int v) {
+        ++visited;
+        COMPARE(reference.at(k), v);
+    });
+    COMPARE(visited, map.size());
+
+    std::vector<Key> keys(1001);
+    for (auto &k : keys) {
+        k = randomKey();
+    }
+    std::vector<int> values(keys.size());
+    const std::size_t found = map.lookup(keys.data(), keys.size(), values.data(), -1);
+    std::size_t expected = 0;
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+        const auto it = reference.find(keys[i]);
+        COMPARE(map.contains(keys[i]), it != reference.end());
+        if (it == reference.end()) {
+            COMPARE(values[i], -1);
+        } else {
+            COMPARE(values[i], it->second);
+            COMPARE(*map.find(keys[i]), it->second);
+            ++expected;
+        }
+    }
+    COMPARE(found, expected);
+
+    map.clear();
+    COMPARE(map.size(), 0u);
+    VERIFY(map.find(keys[0]) == nullptr);
+}
+
+TEST(flatHashMap) //{{{1
+{
+    testMap<int>();
+    testMap<uint>();
+    testMap<std::int64_t>();
+    testMap<std::uint64_t>();
+}
+
+TEST(flatHashMapGrowth) //{{{1
+{
+    flat_hash_map<uint, uint> map(1000);
+    const std::size_t capacity = map.capacity();
+    VERIFY(capacity >= 1000);
+    for (uint i = 0; i < 1000; ++i) {
+        VERIFY(map.insert(i, 2 * i).second);
+    }
+    COMPARE(map.capacity(), capacity);
+    // erasing and reinserting different keys must not grow the table without bounds
+    for (uint round = 1; round < 50; ++round) {
+        for (uint i = 0; i < 1000; ++i) {
+            COMPARE(map.erase((round - 1) * 1000 + i), 1u);
+            VERIFY(map.insert(round * 1000 + i, i).second);
+        }
+    }
+    COMPARE(map.size(), 1000u);
+    COMPARE(map.capacity(), capacity);
+    for (uint i = 0; i < 1000; ++i) {
+        COMPARE(*map.find(49000 + i), i);
+    }
+    // the batched lookup must step over the tombstones left behind by the erasures
+    std::vector<uint> keys(2000), values(keys.size());
+    for (uint i = 0; i < keys.size(); ++i) {
+        keys[i] = 48500 + i;
+    }
+    COMPARE(map.lookup(keys.data(), keys.size(), values.data(), ~0u), 1000u);
+    for (uint i = 0; i < keys.size(); ++i) {
+        COMPARE(values[i], keys[i] >= 49000 && keys[i] < 50000 ? keys[i] - 49000 : ~0u);
+    }
+
+    flat_hash_map<std::uint64_t, int> empty;
+    std::uint64_t k = 1;
+    int v = 0;
+    COMPARE(empty.lookup(&k, 1, &v, 7), 0u);
+    COMPARE(v, 7);
+}
+
+// vim: foldmethod=marker
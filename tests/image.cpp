@@ -0,0 +1,266 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/image>
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Vc;
+
+using PlaneTypes = vir::Typelist<uchar_v, short_v, ushort_v, float_v>;
+
+template <typename T> static T random_pixel(std::mt19937 &rng, std::false_type)
+{
+    using L = std::numeric_limits<T>;
+    const int lo = L::min() < 0 ? -2000 : 0;
+    const int hi = L::max() > 255 ? 4000 : 255;
+    return static_cast<T>(std::uniform_int_distribution<int>(lo, hi)(rng));
+}
+template <typename T> static T random_pixel(std::mt19937 &rng, std::true_type)
+{
+    return std::uniform_real_distribution<T>(0, 1)(rng);
+}
+
+template <typename V> static void randomize(PaddedMemory<V> &p, std::mt19937 &rng)
+{
+    using T = typename V::EntryType;
+    for (std::size_t y = 0; y < p.rowsCount(); ++y) {
+        for (std::size_t x = 0; x < p.columnsCount(); ++x) {
+            p(y, x) = random_pixel<T>(rng, std::is_floating_point<T>());
+        }
+    }
+}
+
+// The largest difference of out to ref (row-major), after rounding and saturating ref.
+template <typename V>
+static double max_error(const PaddedMemory<V> &out, const std::vector<double> &ref)
+{
+    using T = typename V::EntryType;
+    using L = std::numeric_limits<T>;
+    double err = 0;
+    for (std::size_t y = 0; y < out.rowsCount(); ++y) {
+        for (std::size_t x = 0; x < out.columnsCount(); ++x) {
+            double r = ref[y * out.columnsCount() + x];
+            if (L::is_integer) {
+                r = std::min<double>(L::max(), std::max<double>(L::min(), r));
+            }
+            err = std::max(err, std::abs(out(y, x) - r));
+        }
+    }
+    return err;
+}
+
+template <typename V> static double tolerance()
+{
+    // integers are rounded to nearest; the 8-bit fixed point adds less than 1/4
+    return std::is_floating_point<typename V::EntryType>::value ? 2e-5 : 0.75;
+}
+
+static int clamp_index(long i, std::size_t n)
+{
+    return static_cast<int>(std::min<long>(long(n) - 1, std::max(0l, i)));
+}
+
+template <typename V>
+static std::vector<double> reference_filter(const PaddedMemory<V> &in,
+                                            const image::kernel &h,
+                                            const image::kernel &v)
+{
+    const std::size_t rows = in.rowsCount(), cols = in.columnsCount();
+    std::vector<double> tmp(rows * cols), out(rows * cols);
+    for (std::size_t y = 0; y < rows; ++y) {
+        for (std::size_t x = 0; x < cols; ++x) {
+            double sum = 0;
+            for (std::size_t k = 0; k < h.size(); ++k) {
+                sum += h[k] * in(y, clamp_index(long(x + k) - long(h.radius()), cols));
+            }
+            tmp[y * cols + x] = sum;
+        }
+    }
+    for (std::size_t y = 0; y < rows; ++y) {
+        for (std::size_t x = 0; x < cols; ++x) {
+            double sum = 0;
+            for (std::size_t k = 0; k < v.size(); ++k) {
+                const int row = clamp_index(long(y + k) - long(v.radius()), rows);
+                sum += v[k] * tmp[row * cols + x];
+            }
+            out[y * cols + x] = sum;
+        }
+    }
+    return out;
+}
+
+TEST_TYPES(V, separableMatchesReference, PlaneTypes) //{{{1
+{
+    std::mt19937 rng(1);
+    const image::kernel kernels[] = {
+        image::kernel::gaussian(1.5f), image::kernel::box(2), image::kernel({1.f}),
+        image::kernel({0.125f, 0.5f, 0.375f}),
+        // negative weights and a gain above 1 take the float path for 8-bit pixels
+        image::kernel({-0.5f, 2.f, -0.5f}), image::kernel({0.5f, 1.f, 0.5f})};
+    const std::size_t extents[][2] = {{37, 53}, {5, 3}, {70, 1}, {1, 70}};
+    for (const auto &e : extents) {
+        PaddedMemory<V> in(e[0], e[1]), out(e[0], e[1]);
+        randomize(in, rng);
+        for (const auto &h : kernels) {
+            for (const auto &v : kernels) {
+                image::separable_filter(in, out, h, v);
+                const double err = max_error(out, reference_filter(in, h, v));
+                VERIFY(err <= tolerance<V>())
+                    << "error " << err << " for " << e[0] << "x" << e[1] << ", taps "
+                    << h.size() << "/" << v.size();
+            }
+        }
+        image::separable_filter(in, out, image::kernel({1.f}), image::kernel({1.f}));
+        for (std::size_t y = 0; y < e[0]; ++y) {
+            for (std::size_t x = 0; x < e[1]; ++x) {
+                COMPARE(out(y, x), in(y, x)) << "identity at " << y << ", " << x;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, blursAreThreadInvariant, PlaneTypes) //{{{1
+{
+    // tall enough to be split over several threads
+    std::mt19937 rng(2);
+    PaddedMemory<V> in(411, 300), one(411, 300), many(411, 300);
+    randomize(in, rng);
+    image::gaussian_blur(in, one, 2.f, 1);
+    image::gaussian_blur(in, many, 2.f, 4);
+    for (std::size_t y = 0; y < in.rowsCount(); ++y) {
+        for (std::size_t x = 0; x < in.columnsCount(); ++x) {
+            COMPARE(many(y, x), one(y, x)) << "at " << y << ", " << x;
+        }
+    }
+    image::box_blur(in, one, 3, 1);
+    image::box_blur(in, many, 3, 3);
+    for (std::size_t y = 0; y < in.rowsCount(); ++y) {
+        for (std::size_t x = 0; x < in.columnsCount(); ++x) {
+            COMPARE(many(y, x), one(y, x)) << "at " << y << ", " << x;
+        }
+    }
+    VERIFY(max_error(one, reference_filter(in, image::kernel::box(3),
+                                           image::kernel::box(3))) <= tolerance<V>());
+}
+
+// The resampling weights of output pixel i, straight from the definition.
+static std::vector<std::pair<int, double>> reference_taps(std::size_t in, std::size_t out,
+                                                          std::size_t i, bool cubic)
+{
+    const double scale = double(in) / out, widen = std::max(1., scale);
+    const double center = (i + 0.5) * scale, support = (cubic ? 2 : 1) * widen;
+    std::vector<std::pair<int, double>> taps;
+    double sum = 0;
+    for (long j = long(center - support) - 2; j <= long(center + support) + 2; ++j) {
+        const double t = std::abs(j + 0.5 - center) / widen;
+        double w = 0;
+        if (!cubic) {
+            w = std::max(0., 1 - t);
+        } else if (t < 1) {
+            w = 1.5 * t * t * t - 2.5 * t * t + 1;
+        } else if (t < 2) {
+            w = -0.5 * t * t * t + 2.5 * t * t - 4 * t + 2;
+        }
+        if (w != 0) {
+            taps.emplace_back(clamp_index(j, in), w);
+            sum += w;
+        }
+    }
+    for (auto &t : taps) {
+        t.second /= sum;
+    }
+    return taps;
+}
+
+template <typename V>
+static std::vector<double> reference_resize(const PaddedMemory<V> &in, std::size_t rows,
+                                            std::size_t cols, bool cubic)
+{
+    std::vector<double> out(rows * cols);
+    for (std::size_t y = 0; y < rows; ++y) {
+        const auto ty = reference_taps(in.rowsCount(), rows, y, cubic);
+        for (std::size_t x = 0; x < cols; ++x) {
+            const auto tx = reference_taps(in.columnsCount(), cols, x, cubic);
+            double sum = 0;
+            for (const auto &a : ty) {
+                for (const auto &b : tx) {
+                    sum += a.second * b.second * in(a.first, b.first);
+                }
+            }
+            out[y * cols + x] = sum;
+        }
+    }
+    return out;
+}
+
+TEST_TYPES(V, resizeMatchesReference, PlaneTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    std::mt19937 rng(3);
+    PaddedMemory<V> in(37, 53);
+    randomize(in, rng);
+    const std::size_t extents[][2] = {{37, 53}, {12, 20}, {80, 101}, {1, 1}, {37, 9},
+                                      {3, 160}, {300, 2}};
+    using image::interpolation;
+    for (const auto method : {interpolation::bilinear, interpolation::bicubic}) {
+        const bool cubic = method == interpolation::bicubic;
+        for (const auto &e : extents) {
+            PaddedMemory<V> out(e[0], e[1]);
+            image::resize(in, out, method);
+            const double err = max_error(out, reference_resize(in, e[0], e[1], cubic));
+            VERIFY(err <= tolerance<V>())
+                << "error " << err << " for " << e[0] << "x" << e[1]
+                << (cubic ? ", bicubic" : ", bilinear");
+        }
+        // same extents: both filters interpolate, i.e. reproduce the source exactly
+        PaddedMemory<V> same(in.rowsCount(), in.columnsCount());
+        image::resize(in, same, method);
+        for (std::size_t y = 0; y < in.rowsCount(); ++y) {
+            for (std::size_t x = 0; x < in.columnsCount(); ++x) {
+                COMPARE(same(y, x), in(y, x)) << "at " << y << ", " << x;
+            }
+        }
+        // flat areas stay flat
+        PaddedMemory<V> flat(64, 48), small(7, 5);
+        for (std::size_t y = 0; y < flat.rowsCount(); ++y) {
+            std::fill_n(flat.entries(y), flat.columnsCount(), T(100));
+        }
+        image::resize(flat, small, method);
+        for (std::size_t y = 0; y < small.rowsCount(); ++y) {
+            for (std::size_t x = 0; x < small.columnsCount(); ++x) {
+                VERIFY(std::abs(small(y, x) - T(100)) <= tolerance<V>() * 100)
+                    << small(y, x);
+            }
+        }
+    }
+}
+
+// vim: foldmethod=marker
@@ -26,6 +26,11 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include "unittest.h"
+#include <vector>
+#ifdef __linux__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 using namespace Vc;
 
@@ -220,3 +225,49 @@ TEST_TYPES(
         }
     }
 }
+
+TEST_TYPES(Vec, partialLoad, AllTypes)
+{
+    typedef typename Vec::EntryType T;
+    std::vector<T> data(3 * Vec::Size);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<T>(i + 1);
+    }
+    for (size_t offset = 0; offset < Vec::Size; ++offset) {
+        for (size_t n = 0; n <= Vec::Size + 1; ++n) {
+            Vec v = Vec::Random();
+            v.load_partial(&data[offset], n);
+            for (size_t j = 0; j < Vec::Size; ++j) {
+                COMPARE(v[j], j < n ? data[offset + j] : T(0))
+                    << "offset: " << offset << ", n: " << n << ", j: " << j;
+            }
+        }
+    }
+}
+
+#ifdef __linux__
+// load_partial must not fault on the last entries before an inaccessible page
+TEST_TYPES(Vec, partialLoadAtPageBoundary, AllTypes)
+{
+    typedef typename Vec::EntryType T;
+    const std::size_t page = sysconf(_SC_PAGESIZE);
+    char *mem = static_cast<char *>(
+        mmap(nullptr, 2 * page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    VERIFY(mem != MAP_FAILED);
+    VERIFY(mprotect(mem + page, page, PROT_NONE) == 0);
+    T *end = reinterpret_cast<T *>(mem + page);
+    for (size_t n = 0; n < Vec::Size; ++n) {
+        T *first = end - n;
+        for (size_t j = 0; j < n; ++j) {
+            first[j] = static_cast<T>(j + 1);
+        }
+        Vec v;
+        v.load_partial(first, n);
+        for (size_t j = 0; j < Vec::Size; ++j) {
+            COMPARE(v[j], j < n ? first[j] : T(0)) << "n: " << n << ", j: " << j;
+        }
+        v.store_partial(first, n);
+    }
+    munmap(mem, 2 * page);
+}
+#endif
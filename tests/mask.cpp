@@ -315,6 +315,38 @@ TEST_TYPES(V, shifted, concat<AllVectors, SimdArrays<16>, OddSimdArrays<31>>) /*
 }
 /*}}}*/
 
+TEST_TYPES(V, packedBits, concat<AllVectors, SimdArrays<16>, OddSimdArrays<31>>) /*{{{*/
+{
+    using M = typename V::Mask;
+    std::default_random_engine engine;
+    std::uniform_int_distribution<std::uint64_t> dist;
+    for (int repetition = 0; repetition < 4; ++repetition) {
+        std::uint64_t bits[4];
+        for (auto &w : bits) {
+            w = dist(engine);
+        }
+        const auto bitAt = [](const std::uint64_t *b, std::size_t i) {
+            return ((b[i / 64] >> (i % 64)) & 1) != 0;
+        };
+        // every offset in the first two words, so that masks straddle a word boundary
+        for (std::size_t offset = 0; offset < 128; ++offset) {
+            const M k = M::fromBits(bits, offset);
+            for (std::size_t i = 0; i < V::Size; ++i) {
+                COMPARE(k[i], bitAt(bits, offset + i)) << "offset: " << offset;
+            }
+
+            std::uint64_t out[4] = {~bits[0], ~bits[1], ~bits[2], ~bits[3]};
+            k.storeBits(out, offset);
+            for (std::size_t i = 0; i < 256; ++i) {
+                const bool inside = i >= offset && i < offset + V::Size;
+                COMPARE(bitAt(out, i), inside ? k[i - offset] : !bitAt(bits, i))
+                    << "offset: " << offset << ", i: " << i;
+            }
+        }
+    }
+}
+/*}}}*/
+
 template<typename M1, typename M2> void testLogicalOperatorsImpl()/*{{{*/
 {
     VERIFY((M1(true) && M2(true)).isFull());
@@ -26,6 +26,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include "unittest.h"
+#include <Vc/array_expression>
 
 using namespace Vc;
 
@@ -319,3 +320,185 @@ TEST_TYPES(V, testCopyAssignment, AllVectors)
         COMPARE(m1[i], T(1));
     }
 }
+
+TEST_TYPES(V, paddedMemory2D, AllVectors)
+{
+    using T = typename V::EntryType;
+    for (size_t columns : {1, 3, 4, 7, 8, 15, 16, 17, 33}) {
+        const size_t rows = 5;
+        PaddedMemory<V> m(rows, columns);
+        COMPARE(m.rowsCount(), rows);
+        COMPARE(m.columnsCount(), columns);
+        VERIFY(m.rowStride() >= columns);
+        COMPARE(m.rowStride() % V::Size, 0u);
+        COMPARE(m.vectorsPerRow(), (columns + V::Size - 1) / V::Size);
+        for (size_t i = 0; i < rows; ++i) {
+            COMPARE(reinterpret_cast<std::uintptr_t>(m.entries(i)) % V::MemoryAlignment,
+                    0u);
+            COMPARE(m[i].entriesCount(), columns);
+            // the padding is zero-initialized
+            for (size_t j = columns; j < m[i].vectorsCount() * V::Size; ++j) {
+                COMPARE(m.entries(i)[j], T(0));
+            }
+            for (size_t j = 0; j < columns; ++j) {
+                m(i, j) = T(i * 100 + j);
+            }
+        }
+        for (size_t i = 0; i < rows; ++i) {
+            auto row = m[i];
+            for (size_t v = 0; v < row.vectorsCount(); ++v) {
+                row.vector(v) += V(1);
+            }
+        }
+        const PaddedMemory<V> &cm = m;
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < columns; ++j) {
+                COMPARE(cm.scalar(i, j), T(i * 100 + j + 1));
+                COMPARE(cm[i][j], T(i * 100 + j + 1));
+            }
+        }
+
+        PaddedMemory<V> copy(m);
+        m.setZero();
+        COMPARE(copy(rows - 1, columns - 1), T((rows - 1) * 100 + columns));
+        COMPARE(m(rows - 1, columns - 1), T(0));
+        m = copy;
+        COMPARE(m(rows - 1, columns - 1), T((rows - 1) * 100 + columns));
+
+        // whole-row expressions
+        m[0] = copy[1] + copy[2];
+        for (size_t j = 0; j < columns; ++j) {
+            COMPARE(m(0, j), T(copy(1, j) + copy(2, j)));
+        }
+        m[1] *= copy[1];
+        for (size_t j = 0; j < columns; ++j) {
+            COMPARE(m(1, j), T(copy(1, j) * copy(1, j)));
+        }
+
+        PaddedMemory<V> moved(std::move(copy));
+        COMPARE(copy.rowsCount(), 0u);
+        COMPARE(moved(2, 0), T(201));
+    }
+}
+
+TEST_TYPES(V, paddedMemorySubViews, AllVectors)
+{
+    using T = typename V::EntryType;
+    const size_t rows = 9, columns = 4 * V::Size + 3;
+    PaddedMemory<V> m(rows, columns);
+    m.setZero();
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < columns; ++j) {
+            m(i, j) = T(i * 64 + j);
+        }
+    }
+
+    // every other row, starting at row 1
+    auto odd = m.rows(1, 4, 2);
+    COMPARE(odd.rowsCount(), 4u);
+    for (size_t i = 0; i < odd.rowsCount(); ++i) {
+        COMPARE(odd(i, 3), T((2 * i + 1) * 64 + 3));
+    }
+
+    // an aligned column block in the middle of the rows
+    auto block = m.columns(V::Size, 2 * V::Size).rows(2, 3);
+    COMPARE(block.columnsCount(), 2 * V::Size);
+    for (size_t i = 0; i < block.rowsCount(); ++i) {
+        COMPARE(reinterpret_cast<std::uintptr_t>(block.entries(i)) % V::MemoryAlignment,
+                0u);
+        COMPARE(block[i].vectorsCount(), 2u);
+        for (auto &v : block[i]) {
+            v = V(-1);
+        }
+    }
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < columns; ++j) {
+            const bool inBlock = i >= 2 && i < 5 && j >= V::Size && j < 3 * V::Size;
+            COMPARE(m(i, j), inBlock ? T(-1) : T(i * 64 + j)) << i << ", " << j;
+        }
+    }
+
+    // the trailing column block may end with a partial vector; its padding is the row's
+    auto tail = m.columns(4 * V::Size, 3);
+    COMPARE(tail[0].vectorsCount(), (3 + V::Size - 1) / V::Size);
+    COMPARE(tail(0, 2), T(4 * V::Size + 2));
+
+    // wrapping external memory
+    MemoryView<V, 2> view(m.entries(), rows, columns, m.rowStride());
+    COMPARE(view(8, columns - 1), m(8, columns - 1));
+}
+
+TEST_TYPES(V, paddedMemory3D, AllVectors)
+{
+    using T = typename V::EntryType;
+    const size_t planes = 3, rows = 4, columns = V::Size + 1;
+    PaddedMemory<V, 3> m(planes, rows, columns);
+    COMPARE(m.entriesCount(), planes * rows * columns);
+    COMPARE(m.planeStride() % V::Size, 0u);
+    for (size_t k = 0; k < planes; ++k) {
+        for (size_t i = 0; i < rows; ++i) {
+            if (V::Size > 1) {
+                COMPARE(m.row(k, i).lastVector()[V::Size - 1], T(0));
+            }
+            for (size_t j = 0; j < columns; ++j) {
+                m(k, i, j) = T(k * 50 + i * 10 + j);
+            }
+        }
+    }
+    auto plane = m[2];
+    COMPARE(plane.rowsCount(), rows);
+    COMPARE(plane(3, 1), T(131));
+    plane[3] = V(7);
+    COMPARE(m(2, 3, 0), T(7));
+    COMPARE(m(2, 3, columns - 1), T(7));
+
+    auto sub = m.planes(0, 2, 2).rows(1, 2, 2);
+    COMPARE(sub.planesCount(), 2u);
+    COMPARE(sub.rowsCount(), 2u);
+    COMPARE(sub(1, 0, 0), T(110));
+    COMPARE(sub(1, 1, 0), T(7));
+
+    PaddedMemory<V, 3> copy(m);
+    COMPARE(copy(1, 2, columns - 1), m(1, 2, columns - 1));
+}
+
+TEST_TYPES(V, paddedMemorySkewed, AllVectors)
+{
+    using T = typename V::EntryType;
+    // 4 KiB rows would otherwise put all rows at the same offset modulo 4096
+    const size_t columns = 4096 / sizeof(T);
+    PaddedMemory<V> plain(4, columns);
+    PaddedMemory<V> skewed(4, columns, RowLayout::Skewed);
+    COMPARE(plain.rowStride(), columns);
+    VERIFY(skewed.rowStride() > columns);
+    COMPARE(skewed.rowStride() % V::Size, 0u);
+    VERIFY(skewed.rowStride() * sizeof(T) % 4096 != 0);
+    for (size_t i = 0; i < skewed.rowsCount(); ++i) {
+        COMPARE(reinterpret_cast<std::uintptr_t>(skewed.entries(i)) % V::MemoryAlignment,
+                0u);
+        // the extra vectors are padding as well
+        for (size_t j = columns; j < skewed.rowStride(); ++j) {
+            COMPARE(skewed.entries(i)[j], T(0)) << "row " << i << ", entry " << j;
+        }
+    }
+
+    // row sizes that do not alias are left alone
+    PaddedMemory<V> odd(4, 3 * V::Size, RowLayout::Skewed);
+    if (3 * V::Size * sizeof(T) % 512 != 0) {
+        COMPARE(odd.rowStride(), 3 * V::Size);
+    }
+
+    PaddedMemory<V, 3> volume(2, 64, columns, RowLayout::Skewed);
+    VERIFY(volume.planeStride() * sizeof(T) % 512 != 0);
+    for (size_t k = 0; k < volume.planesCount(); ++k) {
+        for (size_t i = 0; i < volume.rowsCount(); ++i) {
+            for (size_t j = columns; j < volume.rowStride(); ++j) {
+                COMPARE(volume.entries(k, i)[j], T(0));
+            }
+        }
+        const T *planePadding = volume.entries(k, volume.rowsCount());
+        for (size_t j = 0; j < volume.planeStride() - 64 * volume.rowStride(); ++j) {
+            COMPARE(planePadding[j], T(0)) << "plane " << k << ", entry " << j;
+        }
+    }
+}
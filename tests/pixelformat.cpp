@@ -0,0 +1,367 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/image>
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace Vc;
+using image::pixel_format;
+using image::yuv_matrix;
+using image::yuv_range;
+
+using Image = PaddedMemory<uchar_v>;
+
+static void randomize(Image &p, std::mt19937 &rng)
+{
+    std::uniform_int_distribution<int> dist(0, 255);
+    for (std::size_t y = 0; y < p.rowsCount(); ++y) {
+        for (std::size_t x = 0; x < p.columnsCount(); ++x) {
+            p(y, x) = static_cast<unsigned char>(dist(rng));
+        }
+    }
+}
+
+static bool equal(const Image &a, const Image &b)
+{
+    for (std::size_t y = 0; y < a.rowsCount(); ++y) {
+        if (!std::equal(&a(y, 0), &a(y, 0) + a.columnsCount(), &b(y, 0))) {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST_TYPES(V, interleaveRoundTrip, vir::Typelist<short_v, ushort_v>) //{{{1
+{
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> dist(0, 255);
+    unsigned char bytes[4 * V::Size], out[4 * V::Size + 1];
+    for (int run = 0; run < 20; ++run) {
+        for (auto &b : bytes) {
+            b = static_cast<unsigned char>(dist(rng));
+        }
+        V c[4];
+        image::deinterleave(bytes, c[0], c[1]);
+        image::deinterleave(bytes, c[0], c[1], c[2]);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            for (int k = 0; k < 3; ++k) {
+                COMPARE(int(c[k][i]), int(bytes[3 * i + k])) << i << ' ' << k;
+            }
+        }
+        std::fill_n(out, sizeof(out), 0x55);
+        image::interleave(out, c[0], c[1], c[2]);
+        VERIFY(std::equal(out, out + 3 * V::Size, bytes));
+        COMPARE(int(out[3 * V::Size]), 0x55);
+
+        image::deinterleave(bytes, c[0], c[1], c[2], c[3]);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            for (int k = 0; k < 4; ++k) {
+                COMPARE(int(c[k][i]), int(bytes[4 * i + k])) << i << ' ' << k;
+            }
+        }
+        image::interleave(out, c[0], c[1], c[2], c[3]);
+        VERIFY(std::equal(out, out + 4 * V::Size, bytes));
+
+        image::deinterleave(bytes, c[0], c[1]);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(int(c[0][i]), int(bytes[2 * i]));
+            COMPARE(int(c[1][i]), int(bytes[2 * i + 1]));
+        }
+        image::interleave(out, c[1], c[0]);
+        for (std::size_t i = 0; i < 2 * V::Size; ++i) {
+            COMPARE(int(out[i]), int(bytes[i ^ 1]));
+        }
+    }
+}
+
+TEST(interleaveSaturates) //{{{1
+{
+    const short_v x = short_v::IndexesFromZero() * short_v(97) - short_v(300);
+    unsigned char out[4 * short_v::Size];
+    image::interleave(out, x, -x, x, short_v(1000));
+    for (std::size_t i = 0; i < short_v::Size; ++i) {
+        const int v = x[i];
+        COMPARE(int(out[4 * i]), std::min(255, std::max(0, v)));
+        COMPARE(int(out[4 * i + 1]), std::min(255, std::max(0, -v)));
+        COMPARE(int(out[4 * i + 3]), 255);
+    }
+}
+
+TEST(convertReordersChannels) //{{{1
+{
+    std::mt19937 rng(2);
+    for (std::size_t n : {1, 5, 37, 100}) {
+        Image rgb(13, 3 * n), bgra(13, 4 * n), back(13, 3 * n);
+        randomize(rgb, rng);
+        image::convert(rgb, pixel_format::rgb, bgra, pixel_format::bgra);
+        for (std::size_t y = 0; y < 13; ++y) {
+            for (std::size_t x = 0; x < n; ++x) {
+                COMPARE(int(bgra(y, 4 * x)), int(rgb(y, 3 * x + 2)));
+                COMPARE(int(bgra(y, 4 * x + 1)), int(rgb(y, 3 * x + 1)));
+                COMPARE(int(bgra(y, 4 * x + 2)), int(rgb(y, 3 * x)));
+                COMPARE(int(bgra(y, 4 * x + 3)), 255);
+            }
+        }
+        image::convert(bgra, pixel_format::bgra, back, pixel_format::rgb, 3);
+        VERIFY(equal(rgb, back)) << n;
+    }
+}
+
+// YCbCr reference{{{1
+struct Yuv {
+    double kr, kb, ys, cs, yo;
+    Yuv(yuv_matrix m, yuv_range r)
+        : kr(m == yuv_matrix::bt601 ? 0.299 : 0.2126)
+        , kb(m == yuv_matrix::bt601 ? 0.114 : 0.0722)
+        , ys(r == yuv_range::full ? 1 : 219. / 255.)
+        , cs(r == yuv_range::full ? 1 : 224. / 255.)
+        , yo(r == yuv_range::full ? 0 : 16)
+    {
+    }
+    double luma(double r, double g, double b) const
+    {
+        return kr * r + (1 - kr - kb) * g + kb * b;
+    }
+    void forward(const double (&rgb)[3], double (&yuv)[3]) const
+    {
+        const double l = luma(rgb[0], rgb[1], rgb[2]);
+        yuv[0] = yo + ys * l;
+        yuv[1] = 128 + cs * (rgb[2] - l) / (2 * (1 - kb));
+        yuv[2] = 128 + cs * (rgb[0] - l) / (2 * (1 - kr));
+    }
+    void inverse(const double (&yuv)[3], double (&rgb)[3]) const
+    {
+        const double l = (yuv[0] - yo) / ys;
+        rgb[0] = l + 2 * (1 - kr) * (yuv[2] - 128) / cs;
+        rgb[2] = l + 2 * (1 - kb) * (yuv[1] - 128) / cs;
+        rgb[1] = (l - kr * rgb[0] - kb * rgb[2]) / (1 - kr - kb);
+    }
+};
+
+static int saturate(double x)
+{
+    return int(std::lround(std::min(255., std::max(0., x))));
+}
+
+static const yuv_matrix matrices[] = {yuv_matrix::bt601, yuv_matrix::bt709};
+static const yuv_range ranges[] = {yuv_range::limited, yuv_range::full};
+
+TEST(rgbToYuv420MatchesReference) //{{{1
+{
+    std::mt19937 rng(3);
+    const std::size_t sizes[][2] = {{1, 1}, {2, 2}, {3, 1}, {7, 37}, {16, 64}, {9, 70}};
+    for (auto size : sizes) {
+        const std::size_t rows = size[0], n = size[1], crows = (rows + 1) / 2,
+                          cn = (n + 1) / 2;
+        for (pixel_format f : {pixel_format::rgb, pixel_format::bgra}) {
+            const std::size_t C = image::channels(f);
+            const bool bgr = f == pixel_format::bgra;
+            Image rgb(rows, C * n);
+            randomize(rgb, rng);
+            const auto at = [&](std::size_t y, std::size_t x, int k) {
+                y = std::min(y, rows - 1);
+                x = std::min(x, n - 1);
+                return double(rgb(y, C * x + (bgr ? 2 - k : k)));
+            };
+            for (auto m : matrices) {
+                for (auto r : ranges) {
+                    const Yuv ref(m, r);
+                    Image y(rows, n), u(crows, cn), v(crows, cn), y2(rows, n),
+                        uv(crows, 2 * cn);
+                    image::rgb_to_i420(rgb, f, y, u, v, m, r);
+                    image::rgb_to_nv12(rgb, f, y2, uv, m, r, 1);
+                    VERIFY(equal(y, y2));
+                    for (std::size_t i = 0; i < rows; ++i) {
+                        for (std::size_t j = 0; j < n; ++j) {
+                            double p[3] = {at(i, j, 0), at(i, j, 1), at(i, j, 2)}, q[3];
+                            ref.forward(p, q);
+                            VERIFY(std::abs(y(i, j) - q[0]) <= 1)
+                                << i << ' ' << j << ": " << int(y(i, j)) << " vs "
+                                << q[0];
+                        }
+                    }
+                    for (std::size_t i = 0; i < crows; ++i) {
+                        for (std::size_t j = 0; j < cn; ++j) {
+                            double p[3], q[3];
+                            for (int k = 0; k < 3; ++k) {
+                                const double sum =
+                                    at(2 * i, 2 * j, k) + at(2 * i, 2 * j + 1, k) +
+                                    at(2 * i + 1, 2 * j, k) + at(2 * i + 1, 2 * j + 1, k);
+                                p[k] = std::floor((sum + 2) / 4);
+                            }
+                            ref.forward(p, q);
+                            VERIFY(std::abs(u(i, j) - q[1]) <= 1) << i << ' ' << j;
+                            VERIFY(std::abs(v(i, j) - q[2]) <= 1) << i << ' ' << j;
+                            COMPARE(uv(i, 2 * j), u(i, j));
+                            COMPARE(uv(i, 2 * j + 1), v(i, j));
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(yuv420ToRgbMatchesReference) //{{{1
+{
+    std::mt19937 rng(4);
+    const std::size_t sizes[][2] = {{1, 1}, {2, 3}, {5, 37}, {16, 64}, {11, 71}};
+    for (auto size : sizes) {
+        const std::size_t rows = size[0], n = size[1], crows = (rows + 1) / 2,
+                          cn = (n + 1) / 2;
+        Image y(rows, n), u(crows, cn), v(crows, cn), uv(crows, 2 * cn);
+        randomize(y, rng);
+        randomize(u, rng);
+        randomize(v, rng);
+        for (std::size_t i = 0; i < crows; ++i) {
+            for (std::size_t j = 0; j < cn; ++j) {
+                uv(i, 2 * j) = u(i, j);
+                uv(i, 2 * j + 1) = v(i, j);
+            }
+        }
+        for (pixel_format f : {pixel_format::bgr, pixel_format::rgba}) {
+            const std::size_t C = image::channels(f);
+            const bool bgr = f == pixel_format::bgr;
+            for (auto m : matrices) {
+                for (auto r : ranges) {
+                    const Yuv ref(m, r);
+                    Image rgb(rows, C * n), rgb2(rows, C * n);
+                    image::i420_to_rgb(y, u, v, rgb, f, m, r);
+                    image::nv12_to_rgb(y, uv, rgb2, f, m, r, 1);
+                    VERIFY(equal(rgb, rgb2));
+                    for (std::size_t i = 0; i < rows; ++i) {
+                        for (std::size_t j = 0; j < n; ++j) {
+                            const double p[3] = {double(y(i, j)), double(u(i / 2, j / 2)),
+                                                 double(v(i / 2, j / 2))};
+                            double q[3];
+                            ref.inverse(p, q);
+                            for (int k = 0; k < 3; ++k) {
+                                const int out = rgb(i, C * j + (bgr ? 2 - k : k));
+                                VERIFY(std::abs(out - saturate(q[k])) <= 1)
+                                    << i << ' ' << j << ' ' << k << ": " << out << " vs "
+                                    << q[k];
+                            }
+                            if (C == 4) {
+                                COMPARE(int(rgb(i, C * j + 3)), 255);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(yuv420IsThreadInvariant) //{{{1
+{
+    std::mt19937 rng(5);
+    const std::size_t rows = 301, n = 411;
+    Image rgb(rows, 3 * n), y1(rows, n), y4(rows, n), uv1(151, 412), uv4(151, 412),
+        out1(rows, 4 * n), out4(rows, 4 * n);
+    randomize(rgb, rng);
+    image::rgb_to_nv12(rgb, pixel_format::rgb, y1, uv1, yuv_matrix::bt709,
+                       yuv_range::limited, 1);
+    image::rgb_to_nv12(rgb, pixel_format::rgb, y4, uv4, yuv_matrix::bt709,
+                       yuv_range::limited, 4);
+    VERIFY(equal(y1, y4));
+    VERIFY(equal(uv1, uv4));
+    image::nv12_to_rgb(y1, uv1, out1, pixel_format::rgba, yuv_matrix::bt709,
+                       yuv_range::limited, 1);
+    image::nv12_to_rgb(y1, uv1, out4, pixel_format::rgba, yuv_matrix::bt709,
+                       yuv_range::limited, 4);
+    VERIFY(equal(out1, out4));
+}
+
+TEST(yuv420RoundTrip) //{{{1
+{
+    // with constant 2x2 blocks, subsampling is lossless and only quantization remains
+    std::mt19937 rng(6);
+    const std::size_t rows = 24, n = 50;
+    Image rgb(rows, 3 * n), y(rows, n), u(rows / 2, n / 2), v(rows / 2, n / 2),
+        back(rows, 3 * n);
+    std::uniform_int_distribution<int> dist(0, 255);
+    for (std::size_t i = 0; i < rows; i += 2) {
+        for (std::size_t j = 0; j < n; j += 2) {
+            for (int k = 0; k < 3; ++k) {
+                const auto c = static_cast<unsigned char>(dist(rng));
+                rgb(i, 3 * j + k) = rgb(i, 3 * j + 3 + k) = c;
+                rgb(i + 1, 3 * j + k) = rgb(i + 1, 3 * j + 3 + k) = c;
+            }
+        }
+    }
+    for (auto m : matrices) {
+        for (auto r : ranges) {
+            image::rgb_to_i420(rgb, pixel_format::rgb, y, u, v, m, r);
+            image::i420_to_rgb(y, u, v, back, pixel_format::rgb, m, r);
+            int err = 0;
+            for (std::size_t i = 0; i < rows; ++i) {
+                for (std::size_t j = 0; j < 3 * n; ++j) {
+                    err = std::max(err, std::abs(rgb(i, j) - back(i, j)));
+                }
+            }
+            VERIFY(err <= (r == yuv_range::full ? 2 : 3)) << err;
+        }
+    }
+}
+
+TEST(premultiplyAndBlendAreExact) //{{{1
+{
+    std::mt19937 rng(7);
+    for (std::size_t n : {1, 9, 64, 77}) {
+        Image src(5, 4 * n), pre(5, 4 * n), dst(5, 4 * n), out(5, 4 * n);
+        randomize(src, rng);
+        randomize(dst, rng);
+        image::premultiply(src, pre);
+        for (std::size_t y = 0; y < 5; ++y) {
+            for (std::size_t x = 0; x < n; ++x) {
+                const int a = src(y, 4 * x + 3);
+                for (int k = 0; k < 3; ++k) {
+                    const int c = src(y, 4 * x + k);
+                    COMPARE(int(pre(y, 4 * x + k)), int(std::lround(c * a / 255.)));
+                }
+                COMPARE(int(pre(y, 4 * x + 3)), a);
+            }
+        }
+        out = dst;
+        image::blend_over(pre, out);
+        for (std::size_t y = 0; y < 5; ++y) {
+            for (std::size_t x = 0; x < n; ++x) {
+                const int t = 255 - pre(y, 4 * x + 3);
+                for (int k = 0; k < 4; ++k) {
+                    const int s = pre(y, 4 * x + k), d = dst(y, 4 * x + k);
+                    COMPARE(int(out(y, 4 * x + k)), int(s + std::lround(d * t / 255.)))
+                        << y << ' ' << x << ' ' << k;
+                }
+            }
+        }
+    }
+}
+
+// vim: foldmethod=marker
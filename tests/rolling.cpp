@@ -0,0 +1,307 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+#include "unittest.h"
+#include <Vc/rolling>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Vc;
+
+using FloatTypes = vir::Typelist<float_v, double_v>;
+
+template <typename T> std::vector<T> randomData(std::size_t n, T lo, T hi, int seed)
+{
+    std::mt19937 rng(seed);
+    std::vector<T> data(n);
+    std::uniform_real_distribution<double> dist(lo, hi);
+    for (auto &x : data) {
+        x = static_cast<T>(dist(rng));
+    }
+    return data;
+}
+
+// The window sums, means and variances in long double, each window on its own.
+struct Reference {
+    long double sum, abs_sum, mean, m2;
+};
+template <typename T>
+Reference reference(const std::vector<T> &data, std::size_t i, std::size_t w)
+{
+    Reference r = {0, 0, 0, 0};
+    for (std::size_t j = i; j < i + w; ++j) {
+        r.sum += data[j];
+        r.abs_sum += std::abs(data[j]);
+    }
+    r.mean = r.sum / w;
+    for (std::size_t j = i; j < i + w; ++j) {
+        r.m2 += (data[j] - r.mean) * (data[j] - r.mean);
+    }
+    return r;
+}
+
+const std::size_t windows[] = {1, 2, 3, 5, 8, 9, 16, 17, 31, 100, 1000, 5000};
+
+TEST_TYPES(V, sumAndMean, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    const T eps = std::numeric_limits<T>::epsilon();
+    for (T offset : {T(0), T(100)}) {
+        const auto data = randomData<T>(12000, offset - 1, offset + 1, 1);
+        std::vector<T> sums(data.size()), means(data.size());
+        for (std::size_t w : windows) {
+            const auto end = rolling_sum(data.begin(), data.end(), w, sums.begin());
+            COMPARE(std::size_t(end - sums.begin()), data.size() - w + 1);
+            rolling_mean(data.begin(), data.end(), w, means.begin());
+            for (std::size_t i = 0; i + w <= data.size(); ++i) {
+                const auto r = reference(data, i, w);
+                const long double tol = 4 * eps * r.abs_sum;
+                VERIFY(std::abs(sums[i] - r.sum) <= tol)
+                    << "w: " << w << ", i: " << i << ", sum: " << sums[i]
+                    << ", exact: " << double(r.sum);
+                VERIFY(std::abs(means[i] - r.mean) <= tol / w)
+                    << "w: " << w << ", i: " << i << ", mean: " << means[i];
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, sumDoesNotDrift, FloatTypes) //{{{1
+{
+    // a running sum that is never restarted accumulates an error that grows with the
+    // square root of the number of updates; the restarts and the compensated carry keep
+    // it independent of the length of the input
+    using T = typename V::EntryType;
+    const T eps = std::numeric_limits<T>::epsilon();
+    const auto data = randomData<T>(1 << 20, -1, 1, 2);
+    const std::size_t w = 40;
+    std::vector<T> sums(data.size());
+    rolling_sum(data.begin(), data.end(), w, sums.begin());
+    long double worst = 0;
+    for (std::size_t i = 0; i + w <= data.size(); ++i) {
+        const auto r = reference(data, i, w);
+        worst = std::max(worst, std::abs(sums[i] - r.sum) / r.abs_sum);
+    }
+    VERIFY(worst <= 4 * eps) << "relative error: " << double(worst);
+}
+
+TEST_TYPES(V, variance, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    const T eps = std::numeric_limits<T>::epsilon();
+    // a large mean relative to the spread cancels catastrophically without the shift
+    for (T offset : {T(0), T(1000)}) {
+        const auto data = randomData<T>(12000, offset - 1, offset + 1, 3);
+        std::vector<T> out(data.size());
+        for (std::size_t w : windows) {
+            for (std::size_t ddof : {0, 1}) {
+                if (w <= ddof) {
+                    continue;
+                }
+                rolling_variance(data.begin(), data.end(), w, out.begin(), ddof);
+                for (std::size_t i = 0; i + w <= data.size(); ++i) {
+                    const auto r = reference(data, i, w);
+                    const long double expected = r.m2 / (w - ddof);
+                    // the shifted samples are exact, their squares have an error of
+                    // eps relative to the variance
+                    const long double tol = 16 * eps * (expected + 1) * w / (w - ddof);
+                    VERIFY(std::abs(out[i] - expected) <= tol)
+                        << "w: " << w << ", ddof: " << ddof << ", i: " << i
+                        << ", var: " << out[i] << ", exact: " << double(expected);
+                }
+            }
+        }
+    }
+    const std::vector<T> data(10, T(1));
+    std::vector<T> out(10);
+    COMPARE(rolling_variance(data.begin(), data.end(), 1, out.begin(), 1) - out.begin(),
+            10);
+    for (T x : out) {
+        VERIFY(std::isnan(x));
+    }
+    rolling_variance(data.begin(), data.end(), 4, out.begin());
+    COMPARE(out[0], T(0));
+}
+
+TEST_TYPES(V, minAndMax, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    std::mt19937 rng(4);
+    std::uniform_int_distribution<int> dist(0, 10000);
+    const T scale = std::is_signed<T>::value ? T(-1) : T(1);
+    std::vector<T> data(7000);
+    for (auto &x : data) {
+        x = T(dist(rng)) * scale;
+    }
+    std::vector<T> mins(data.size()), maxs(data.size());
+    std::vector<std::size_t> ws(windows, windows + sizeof(windows) / sizeof(*windows));
+    for (std::size_t w = 4; w < 70; ++w) {
+        ws.push_back(w);
+    }
+    for (std::size_t w : ws) {
+        for (std::size_t offset : {0, 1, 5}) {
+            const auto first = data.begin() + offset;
+            const std::size_t n = data.size() - offset;
+            COMPARE(std::size_t(rolling_min(first, data.end(), w, mins.begin()) -
+                                mins.begin()),
+                    n - w + 1);
+            rolling_max(first, data.end(), w, maxs.begin());
+            for (std::size_t i = 0; i + w <= n; ++i) {
+                const auto mm = std::minmax_element(first + i, first + i + w);
+                COMPARE(mins[i], *mm.first) << "w: " << w << ", i: " << i;
+                COMPARE(maxs[i], *mm.second) << "w: " << w << ", i: " << i;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, minMaxExtremes, FloatTypes) //{{{1
+{
+    // the identity elements of the scans must not leak into the results
+    using T = typename V::EntryType;
+    const T inf = std::numeric_limits<T>::infinity();
+    std::vector<T> data(300, T(0));
+    data[17] = -inf;
+    data[200] = inf;
+    data[201] = std::numeric_limits<T>::lowest();
+    std::vector<T> out(data.size());
+    for (std::size_t w : {3, 40}) {
+        rolling_min(data.begin(), data.end(), w, out.begin());
+        for (std::size_t i = 0; i + w <= data.size(); ++i) {
+            COMPARE(out[i], i <= 17 && 17 < i + w ? -inf
+                            : i <= 201 && 201 < i + w ? std::numeric_limits<T>::lowest()
+                                                      : T(0))
+                << "w: " << w << ", i: " << i;
+        }
+        rolling_max(data.begin(), data.end(), w, out.begin());
+        for (std::size_t i = 0; i + w <= data.size(); ++i) {
+            COMPARE(out[i], i <= 200 && 200 < i + w ? inf : T(0));
+        }
+    }
+}
+
+TEST_TYPES(V, streaming, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    const T eps = std::numeric_limits<T>::epsilon();
+    const auto data = randomData<T>(30000, -3, 5, 5);
+    std::mt19937 rng(6);
+    for (std::size_t w : {1, 6, 40, 1000}) {
+        std::vector<T> sum(data.size()), var(data.size()), min(data.size()),
+            max(data.size());
+        rolling_sum(data.begin(), data.end(), w, sum.begin());
+        rolling_variance(data.begin(), data.end(), w, var.begin(), 1);
+        rolling_min(data.begin(), data.end(), w, min.begin());
+        rolling_max(data.begin(), data.end(), w, max.begin());
+
+        RollingSum<T> rsum(w);
+        RollingVariance<T> rvar(w, 1);
+        RollingMin<T> rmin(w);
+        RollingMax<T> rmax(w);
+        COMPARE(rvar.window(), w);
+        std::vector<T> osum, ovar, omin, omax;
+        std::uniform_int_distribution<std::size_t> chunk(0, 3 * w + 10);
+        for (auto it = data.begin(); it != data.end();) {
+            const std::size_t k =
+                std::min<std::size_t>(chunk(rng), std::distance(it, data.end()));
+            std::vector<T> buf(k);
+            osum.insert(osum.end(), buf.begin(), rsum.push(it, it + k, buf.begin()));
+            ovar.insert(ovar.end(), buf.begin(), rvar.push(it, it + k, buf.begin()));
+            omin.insert(omin.end(), buf.begin(), rmin.push(it, it + k, buf.begin()));
+            omax.insert(omax.end(), buf.begin(), rmax.push(it, it + k, buf.begin()));
+            it += k;
+        }
+        const std::size_t count = data.size() - w + 1;
+        COMPARE(osum.size(), count);
+        COMPARE(ovar.size(), count);
+        COMPARE(omin.size(), count);
+        COMPARE(omax.size(), count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const auto r = reference(data, i, w);
+            VERIFY(std::abs(osum[i] - sum[i]) <= 8 * eps * r.abs_sum)
+                << "w: " << w << ", i: " << i;
+            if (w > 1) {
+                VERIFY(std::abs(ovar[i] - var[i]) <= 64 * eps * var[i] * w)
+                    << "w: " << w << ", i: " << i;
+            }
+            COMPARE(omin[i], min[i]);
+            COMPARE(omax[i], max[i]);
+        }
+    }
+}
+
+TEST(streamingReset) //{{{1
+{
+    RollingMax<int> rmax(4);
+    const int a[] = {5, 1, 2};
+    const int b[] = {0, 7, 3, 1, 1, 1};
+    int out[8];
+    int *end = rmax.push(a, a + 3, out);
+    COMPARE(end - out, 0);
+    end = rmax.push(b, b + 1, out);
+    COMPARE(end - out, 1);
+    COMPARE(out[0], 5);
+    end = rmax.push(b + 1, b + 6, out);
+    COMPARE(end - out, 5);
+    COMPARE(out[0], 7);
+    COMPARE(out[4], 3);
+    rmax.reset();
+    end = rmax.push(b, b + 3, out);
+    COMPARE(end - out, 0);
+    end = rmax.push(b + 3, b + 6, out);
+    COMPARE(end - out, 3);
+    COMPARE(out[0], 7);
+    COMPARE(out[2], 3);
+    // inputs shorter than the window produce no output
+    const float c[] = {1, 2, 3};
+    float fout[3];
+    COMPARE(rolling_sum(c, c + 3, 4, fout) - fout, 0);
+}
+
+TEST(scalarFallback) //{{{1
+{
+    std::vector<long double> data(2000);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = (i * 37 + 11) % 101;
+    }
+    std::vector<long double> out(data.size());
+    for (std::size_t w : {3, 50, 600}) {
+        rolling_sum(data.begin(), data.end(), w, out.begin());
+        const auto r = reference(data, 7, w);
+        COMPARE(out[7], r.sum);
+        rolling_variance(data.begin(), data.end(), w, out.begin());
+        VERIFY(std::abs(out[7] - r.m2 / w) <= 1e-12L * r.m2 / w);
+        rolling_min(data.begin(), data.end(), w, out.begin());
+        COMPARE(out[7], *std::min_element(data.begin() + 7, data.begin() + 7 + w));
+        rolling_max(data.begin(), data.end(), w, out.begin());
+        COMPARE(out[7], *std::max_element(data.begin() + 7, data.begin() + 7 + w));
+    }
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,142 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <numeric>
+#include <vector>
+
+using namespace Vc;
+
+// the sizes cover empty ranges, partial vectors, and ranges with scalar tails
+static const std::size_t scanSizes[] = {0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 64, 100, 1023};
+
+template <typename T> std::vector<T> scanInput(std::size_t n)
+{
+    std::vector<T> data(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        data[i] = static_cast<T>((i * 7 + 3) % 11);
+    }
+    return data;
+}
+
+TEST_TYPES(V, inclusiveScan, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : scanSizes) {
+        const auto in = scanInput<T>(n);
+        std::vector<T> out(n), ref(n);
+        std::partial_sum(in.begin(), in.end(), ref.begin(),
+                         [](T a, T b) { return static_cast<T>(a + b); });
+        VERIFY(Vc::inclusive_scan(in.begin(), in.end(), out.begin()) == out.end());
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], ref[i]) << "n: " << n << ", i: " << i;
+        }
+
+        Vc::inclusive_scan(in.begin(), in.end(), out.begin(), 5);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], static_cast<T>(ref[i] + 5)) << "n: " << n << ", i: " << i;
+        }
+
+        auto inplace = in;
+        Vc::inclusive_scan(inplace.begin(), inplace.end(), inplace.begin());
+        VERIFY(inplace == ref) << "n: " << n;
+    }
+}
+
+TEST_TYPES(V, exclusiveScan, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : scanSizes) {
+        const auto in = scanInput<T>(n);
+        std::vector<T> out(n), ref(n);
+        T sum = 2;
+        for (std::size_t i = 0; i < n; ++i) {
+            ref[i] = sum;
+            sum = static_cast<T>(sum + in[i]);
+        }
+        VERIFY(Vc::exclusive_scan(in.begin(), in.end(), out.begin(), 2) == out.end());
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], ref[i]) << "n: " << n << ", i: " << i;
+        }
+    }
+}
+
+TEST_TYPES(V, segmentedScan, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t n : scanSizes) {
+        for (std::size_t period : {1, 2, 3, 5, 13, 1000}) {
+            const auto in = scanInput<T>(n);
+            std::unique_ptr<bool[]> flags(new bool[n + 1]);
+            std::vector<T> out(n), ref(n);
+            T sum = 0;
+            for (std::size_t i = 0; i < n; ++i) {
+                flags[i] = (i * 3 + 1) % period == 0;
+                sum = flags[i] ? in[i] : static_cast<T>(sum + in[i]);
+                ref[i] = sum;
+            }
+            const bool *f = flags.get();
+            VERIFY(Vc::segmented_scan(in.data(), in.data() + n, f, out.data()) ==
+                   out.data() + n);
+            for (std::size_t i = 0; i < n; ++i) {
+                COMPARE(out[i], ref[i]) << "n: " << n << ", period: " << period
+                                        << ", i: " << i;
+            }
+        }
+    }
+}
+
+TEST_TYPES(T, scalarFallback, vir::Typelist<long long, unsigned long>) //{{{1
+{
+    const auto in = scanInput<T>(37);
+    std::vector<T> out(in.size()), ref(in.size());
+    std::partial_sum(in.begin(), in.end(), ref.begin());
+    Vc::inclusive_scan(in.begin(), in.end(), out.begin());
+    VERIFY(out == ref);
+}
+
+// long double has no Vc::Vector and uses the scalar kernels
+TEST_TYPES(T, parallelScan,
+           vir::Typelist<float, int, unsigned short, long double>) //{{{1
+{
+    for (std::size_t n : {std::size_t(100), std::size_t(1) << 18, (std::size_t(1) << 18) + 7}) {
+        const auto in = scanInput<T>(n);
+        std::vector<T> out(n), ref(n);
+        Vc::inclusive_scan(in.begin(), in.end(), ref.begin(), 1);
+        Vc::parallel_inclusive_scan(in.begin(), in.end(), out.begin(), 1, 4);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], ref[i]) << "n: " << n << ", i: " << i;
+        }
+        Vc::exclusive_scan(in.begin(), in.end(), ref.begin(), 3);
+        Vc::parallel_exclusive_scan(in.begin(), in.end(), out.begin(), 3, 3);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(out[i], ref[i]) << "n: " << n << ", i: " << i;
+        }
+    }
+}
+
+// vim: foldmethod=marker
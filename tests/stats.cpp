@@ -0,0 +1,203 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/stats>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace Vc;
+
+using FloatTypes = vir::Typelist<float_v, double_v>;
+
+template <typename T> using Data = std::vector<T, Vc::Allocator<T>>;
+
+// Subranges [offset, offset + n) exercise every alignment of heads and tails.
+template <typename F> void forAllSubranges(std::size_t maxSize, F &&f)
+{
+    for (std::size_t offset = 0; offset < 9; ++offset) {
+        for (std::size_t n = 1; n < maxSize; n += n < 40 ? 1 : 17) {
+            f(offset, n);
+        }
+    }
+}
+
+template <typename T> Data<T> randomData(std::size_t n, double mean, double stddev)
+{
+    std::mt19937 rng(n);
+    std::normal_distribution<double> dist(mean, stddev);
+    Data<T> data(n);
+    for (auto &x : data) {
+        x = static_cast<T>(dist(rng));
+    }
+    return data;
+}
+
+TEST_TYPES(V, sumMatchesAccumulate, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    Data<T> data(300);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<T>((i * 37 + 11) % 101);
+    }
+    COMPARE(stats::sum(data.begin(), data.begin()), T(0));
+    forAllSubranges(290, [&](std::size_t offset, std::size_t n) {
+        const auto first = data.begin() + offset;
+        COMPARE(stats::sum(first, first + n), std::accumulate(first, first + n, T()))
+            << "offset: " << offset << ", n: " << n;
+    });
+}
+
+TEST_TYPES(V, describeIsStable, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    // a large mean and a small spread: the naive sum-of-squares formula fails here
+    for (std::size_t n : {1, 2, 7, 100, 1000, 33333, 300000}) {
+        const auto data = randomData<T>(n + 3, 1e4, 0.5);
+        for (std::size_t offset : {0, 3}) {
+            const auto first = data.begin() + offset, last = first + n;
+            long double mean = 0, m2 = 0;
+            for (auto it = first; it != last; ++it) {
+                mean += *it;
+            }
+            mean /= n;
+            for (auto it = first; it != last; ++it) {
+                m2 += (*it - mean) * (*it - mean);
+            }
+            const auto m = stats::describe(first, last);
+            const T eps = std::numeric_limits<T>::epsilon();
+            COMPARE(m.count, n);
+            VERIFY(std::abs(m.mean - mean) <= 4 * eps * T(mean)) << m.mean << " " << n;
+            VERIFY(std::abs(m.m2 - m2) <= T(64) * eps * T(1e4 * n + m2))
+                << m.m2 << " " << double(m2) << " " << n;
+            // a plain sum: the error grows with the length of the accumulator chains
+            VERIFY(std::abs(stats::mean(first, last) - mean) <=
+                   eps * T(n + 32) / 4 * T(mean));
+            FUZZY_COMPARE(stats::variance(first, last), m.variance());
+        }
+    }
+    const Data<T> empty;
+    COMPARE(stats::describe(empty.begin(), empty.end()).count, 0u);
+    VERIFY(std::isnan(stats::mean(empty.begin(), empty.end())));
+    VERIFY(std::isnan(stats::variance(empty.begin(), empty.end(), 1)));
+}
+
+TEST_TYPES(V, momentsMerge, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    const auto data = randomData<T>(5000, 3, 2);
+    const auto whole = stats::describe(data.begin(), data.end());
+    const T eps = std::numeric_limits<T>::epsilon();
+    for (std::size_t split : {0, 1, 17, 2500, 4999, 5000}) {
+        const auto m = stats::describe(data.begin(), data.begin() + split) +
+                       stats::describe(data.begin() + split, data.end());
+        COMPARE(m.count, whole.count);
+        VERIFY(std::abs(m.mean - whole.mean) <= 16 * eps * std::abs(whole.mean));
+        VERIFY(std::abs(m.m2 - whole.m2) <= 16 * eps * std::abs(whole.m2));
+    }
+    stats::moments<T> pushed;
+    for (T x : data) {
+        pushed.push(x);
+    }
+    VERIFY(std::abs(pushed.mean - whole.mean) <= 64 * eps * std::abs(whole.mean));
+    VERIFY(std::abs(pushed.stddev(1) - whole.stddev(1)) <= 64 * eps * whole.stddev(1));
+}
+
+TEST_TYPES(V, extrema, AllVectors) //{{{1
+{
+    using T = typename V::EntryType;
+    Data<T> data(2000);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<T>((i * 37 + 11) % 101);
+    }
+    data[1500] = 120;
+    data[1700] = 120;
+    forAllSubranges(1990, [&](std::size_t offset, std::size_t n) {
+        const auto first = data.begin() + offset, last = first + n;
+        const auto mm = stats::minmax(first, last);
+        COMPARE(mm.first, *std::min_element(first, last)) << "n: " << n;
+        COMPARE(mm.second, *std::max_element(first, last)) << "n: " << n;
+        COMPARE(stats::argmin(first, last),
+                std::size_t(std::min_element(first, last) - first));
+        COMPARE(stats::argmax(first, last),
+                std::size_t(std::max_element(first, last) - first));
+    });
+}
+
+TEST_TYPES(V, quantilesWithinOneBin, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    const std::vector<double> p = {0, 0.01, 0.25, 0.5, 0.9, 0.999, 1};
+    for (std::size_t n : {1, 2, 5, 1000, 100001}) {
+        auto data = randomData<T>(n, -2, 10);
+        if (n > 2) {
+            data[n / 2] = 1000;  // an outlier widens the bins
+        }
+        for (std::size_t bins : {1, 16, 4096}) {
+            const auto q = stats::quantiles(data.begin(), data.end(), p, bins);
+            auto sorted = data;
+            std::sort(sorted.begin(), sorted.end());
+            const double width = (double(sorted.back()) - sorted.front()) / bins;
+            for (std::size_t j = 0; j < p.size(); ++j) {
+                const double rank = p[j] * (n - 1);
+                const std::size_t k = static_cast<std::size_t>(rank);
+                double exact = sorted[k];
+                if (k + 1 < n) {
+                    exact += (rank - k) * (double(sorted[k + 1]) - sorted[k]);
+                }
+                VERIFY(std::abs(q[j] - exact) <= width * 1.0001 + 1e-4 * std::abs(exact))
+                    << "n: " << n << ", bins: " << bins << ", p: " << p[j] << ", " << q[j]
+                    << " vs. " << exact;
+            }
+        }
+    }
+    const Data<T> constant(100, T(3));
+    COMPARE(stats::median(constant.begin(), constant.end()), T(3));
+    const Data<T> empty;
+    VERIFY(std::isnan(stats::quantile(empty.begin(), empty.end(), 0.5)));
+}
+
+TEST(scalarFallback) //{{{1
+{
+    std::vector<long double> data(1000);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = 1 + (i * 37 + 11) % 101;
+    }
+    const auto m = stats::describe(data.begin(), data.end());
+    FUZZY_COMPARE(double(m.mean), double(stats::mean(data.begin(), data.end())));
+    COMPARE(stats::sum(data.begin(), data.end()),
+            std::accumulate(data.begin(), data.end(), 0.0L));
+    COMPARE(stats::argmax(data.begin(), data.end()),
+            std::size_t(std::max_element(data.begin(), data.end()) - data.begin()));
+    const auto med = stats::median(data.begin(), data.end(), 1000);
+    VERIFY(std::abs(med - 51) <= 0.1L) << double(med);
+}
+
+// vim: foldmethod=marker
@@ -176,4 +176,34 @@ TEST_TYPES(V, simdForEach, AllVectors)
         for_each(test3);
     }
 }
+
+TEST_TYPES(V, simdForEachMaskedTail, AllVectors)
+{
+    typedef typename V::EntryType T;
+    for (std::size_t size : {0u, 1u, 15u, 16u, 17u, 100u}) {
+        std::vector<T> data(size + 1);
+        std::iota(data.begin(), data.end(), T(1));
+        const auto first = std::next(data.begin());
+
+        // the functor is called with full vectors only, one per started chunk
+        std::size_t calls = 0;
+        T sum = 0;
+        Vc::simd_for_each(first, data.end(), [&](auto x) {
+            static_assert(std::is_same<decltype(x), V>::value, "");
+            ++calls;
+            sum += x.sum();  // lanes past the end are zero
+        }, Vc::MaskedTail);
+        COMPARE(calls, (size + V::Size - 1) / V::Size) << "size: " << size;
+        COMPARE(sum, std::accumulate(first, data.end(), T(0))) << "size: " << size;
+
+        // the mutating variant writes back the active lanes only
+        data.push_back(T(0));
+        Vc::simd_for_each_n(std::next(data.begin()), size, [](auto &x) { x += 1; },
+                            Vc::MaskedTail);
+        for (std::size_t i = 0; i < data.size(); ++i) {
+            const T expected = i == 0 ? T(1) : i <= size ? T(i + 2) : T(0);
+            COMPARE(data[i], expected) << "size: " << size << ", i: " << i;
+        }
+    }
+}
 #endif
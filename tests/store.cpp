@@ -195,3 +195,24 @@ TEST_TYPES(Vec, maskedStore, AllVectors)
         }
     }
 }
+
+TEST_TYPES(Vec, partialStore, AllTypes)
+{
+    typedef typename Vec::EntryType T;
+    const T sentinel = 42;
+    std::vector<T> data(3 * Vec::Size);
+    const Vec x = Vec(IndexesFromZero) + 1;
+    for (size_t offset = 0; offset < Vec::Size; ++offset) {
+        for (size_t n = 0; n <= Vec::Size + 1; ++n) {
+            for (size_t i = 0; i < data.size(); ++i) {
+                data[i] = sentinel;
+            }
+            x.store_partial(&data[offset], n);
+            for (size_t i = 0; i < data.size(); ++i) {
+                const bool written = i >= offset && i < offset + std::min(n, Vec::Size);
+                COMPARE(data[i], written ? x[i - offset] : sentinel)
+                    << "offset: " << offset << ", n: " << n << ", i: " << i;
+            }
+        }
+    }
+}
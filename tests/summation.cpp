@@ -0,0 +1,231 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/summation>
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace Vc;
+
+using FloatTypes = vir::Typelist<float_v, double_v>;
+
+template <typename T> using Data = std::vector<T, Vc::Allocator<T>>;
+
+// Pairs of large values that cancel exactly, mixed with small integers: the exact sum is
+// the sum of the integers, while a plain sum loses it to rounding.
+template <typename T> Data<T> cancellingData(std::size_t pairs, T &exact)
+{
+    std::mt19937 rng(pairs);
+    std::uniform_real_distribution<T> big(-1, 1);
+    std::uniform_int_distribution<int> small(-8, 8);
+    const T scale = std::ldexp(T(1), std::numeric_limits<T>::digits / 2 + 4);
+    Data<T> data;
+    exact = 0;
+    for (std::size_t i = 0; i < pairs; ++i) {
+        const T x = big(rng) * scale;
+        const T k = small(rng);
+        data.push_back(x);
+        data.push_back(-x);
+        data.push_back(k);
+        exact += k;
+    }
+    std::shuffle(data.begin(), data.end(), rng);
+    return data;
+}
+
+TEST_TYPES(V, accurateSumIsExact, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    for (std::size_t pairs : {1, 3, 10, 100, 3333, 50000}) {
+        T exact;
+        const auto data = cancellingData<T>(pairs, exact);
+        COMPARE(accurate_sum(data), exact) << "pairs: " << pairs;
+        COMPARE(accurate_sum(data.begin() + 1, data.end()), exact - data[0]);
+    }
+    const Data<T> empty;
+    COMPARE(accurate_sum(empty), T(0));
+}
+
+TEST_TYPES(V, accurateSumTails, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    Data<T> data(300);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        data[i] = T((i * 37 + 11) % 101);
+    }
+    for (std::size_t offset = 0; offset < 9; ++offset) {
+        for (std::size_t n = 0; n + offset < data.size(); n += n < 40 ? 1 : 17) {
+            const auto first = data.begin() + offset;
+            const T expected = std::accumulate(first, first + n, T());
+            COMPARE(accurate_sum(first, first + n), expected) << "n: " << n;
+            COMPARE(pairwise_sum(first, first + n), expected) << "n: " << n;
+            COMPARE(accurate_dot(first, first + n, data.begin()),
+                    std::inner_product(first, first + n, data.begin(), T()))
+                << "n: " << n;
+        }
+    }
+}
+
+TEST_TYPES(V, twoProductIsExact, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    // the error term must be exact even where the compiler contracts multiply-adds
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<T> dist(-1e3, 1e3);
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        V a, b;
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            a[i] = dist(rng);
+            b[i] = dist(rng) / T(3);
+        }
+        V err;
+        const V p = Common::two_product(a, b, err);
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            COMPARE(err[i], std::fma(a[i], b[i], -p[i])) << a[i] << " * " << b[i];
+            T scalarErr;
+            const T scalarP = Common::two_product(T(a[i]), T(b[i]), scalarErr);
+            COMPARE(scalarP, p[i]);
+            COMPARE(scalarErr, err[i]);
+        }
+    }
+}
+
+TEST_TYPES(V, accurateDotIsExact, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    // a · b = Σ x y - x y + k · 1: the rounded products cancel, their errors must not
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<T> dist(1, 2);
+    for (std::size_t pairs : {1, 5, 100, 10000}) {
+        Data<T> a, b;
+        T exact = 0;
+        for (std::size_t i = 0; i < pairs; ++i) {
+            const T x = dist(rng) * T(1e3), y = dist(rng) / T(3);
+            const T k = T(int(i % 7) - 3);
+            a.insert(a.end(), {x, x, k});
+            b.insert(b.end(), {y, -y, 1});
+            exact += k;
+        }
+        COMPARE(accurate_dot(a, b), exact) << "pairs: " << pairs;
+        // the products themselves carry rounding errors that must be compensated
+        Data<T> c(a.size());
+        for (std::size_t i = 0; i < a.size(); i += 3) {
+            c[i] = b[i];
+            c[i + 1] = b[i];
+            c[i + 2] = 1;
+        }
+        long double ref = 0;
+        for (std::size_t i = 0; i < a.size(); i += 3) {
+            ref += 2.L * a[i] * c[i] + a[i + 2];
+        }
+        const T result = accurate_dot(a, c);
+        const long double eps = std::numeric_limits<T>::epsilon();
+        VERIFY(std::abs(result - ref) <= std::abs(ref) * eps)
+            << result << " vs. " << double(ref);
+    }
+}
+
+TEST_TYPES(V, pairwiseErrorBound, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<T> dist(0, 1);
+    for (std::size_t n : {1000, 100000, 1000000}) {
+        Data<T> data(n), other(n);
+        long double exact = 0, exactDot = 0, magnitude = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            data[i] = dist(rng);
+            other[i] = dist(rng) - T(0.5);
+            exact += data[i];
+            exactDot += static_cast<long double>(data[i]) * other[i];
+            magnitude += std::abs(static_cast<long double>(data[i]) * other[i]);
+        }
+        const long double eps = std::numeric_limits<T>::epsilon();
+        const long double bound = (8 + std::log2(double(n))) * eps;
+        VERIFY(std::abs(pairwise_sum(data) - exact) <= bound * exact) << "n: " << n;
+        VERIFY(std::abs(pairwise_dot(data, other) - exactDot) <= bound * magnitude)
+            << "n: " << n;
+        VERIFY(std::abs(accurate_sum(data) - exact) <= eps * exact) << "n: " << n;
+        VERIFY(std::abs(accurate_dot(data, other) - exactDot) <=
+               eps * std::abs(exactDot) + eps * eps * magnitude)
+            << "n: " << n;
+    }
+}
+
+TEST_TYPES(V, compensatedAccumulator, FloatTypes) //{{{1
+{
+    using T = typename V::EntryType;
+    // 0.1 is not representable: a plain float sum of 10^6 copies is off by about 1%
+    const V x = T(0.1);
+    const std::size_t n = 1000000 / V::Size;
+    CompensatedAccumulator<V> acc, half1, half2;
+    V plain = V::Zero();
+    for (std::size_t i = 0; i < n; ++i) {
+        acc += x;
+        plain += x;
+        (i < n / 2 ? half1 : half2) += x;
+    }
+    const long double eps = std::numeric_limits<T>::epsilon();
+    const long double exact = static_cast<long double>(T(0.1)) * n;
+    const long double bound = eps * exact + (n * eps) * (n * eps) * exact;
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        VERIFY(std::abs(acc.value()[i] - exact) <= bound) << acc.value()[i];
+        VERIFY(std::abs(acc.value()[i] - exact) * 100 < std::abs(plain[i] - exact) ||
+               std::abs(plain[i] - exact) <= bound);
+    }
+    half1 += half2;
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        VERIFY(std::abs(half1.value()[i] - exact) <= bound) << half1.value()[i];
+    }
+    const T total = acc.sum();
+    VERIFY(std::abs(total - exact * V::Size) <= bound * V::Size);
+
+    CompensatedAccumulator<V> products;
+    products.add_product(V(T(3)), V(T(1) / T(3)));
+    products -= V(T(1));
+    // the rounding error of 3 · (1/3) survives the cancellation
+    COMPARE(products.value(), V(std::fma(T(3), T(1) / T(3), T(-1))));
+}
+
+TEST(scalarFallback) //{{{1
+{
+    long double exact;
+    const auto data = cancellingData<long double>(1000, exact);
+    COMPARE(accurate_sum(data), exact);
+    std::vector<long double> ones(data.size(), 1);
+    COMPARE(accurate_dot(data, ones), exact);
+    std::vector<long double> counts(1000);
+    std::iota(counts.begin(), counts.end(), 1);
+    COMPARE(pairwise_sum(counts), 500500.L);
+    COMPARE(pairwise_dot(counts, counts), 333833500.L);
+}
+
+// vim: foldmethod=marker